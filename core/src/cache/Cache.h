@@ -12,21 +12,30 @@
 #pragma once
 
 #include "LRU.h"
+#include "metrics/Metrics.h"
 #include "utils/Log.h"
 
+#include <algorithm>
 #include <atomic>
+#include <functional>
+#include <memory>
 #include <mutex>
-#include <set>
 #include <string>
+#include <utility>
+#include <vector>
 
 namespace milvus {
 namespace cache {
 
+// The cache is split into shards by key hash, each shard has its own lock, so concurrent lookups of different
+// keys don't contend. Every shard is a segmented LRU: new items enter the probation segment and are promoted
+// to the protected segment on their second hit. Eviction always drains probation first, so a one-pass scan
+// (a full table search or a PreloadTable) can't push the frequently used items out of the cache.
 template <typename ItemObj>
 class Cache {
  public:
     // mem_capacity, units:GB
-    Cache(int64_t capacity_gb, uint64_t cache_max_count);
+    Cache(int64_t capacity_gb, uint64_t cache_max_count, const std::string& name = "cache");
     ~Cache() = default;
 
     int64_t
@@ -40,6 +49,11 @@ class Cache {
         return capacity_;
     }
 
+    const std::string&
+    name() const {
+        return name_;
+    }
+
     // unit: BYTE
     void
     set_capacity(int64_t capacity);
@@ -75,17 +89,57 @@ class Cache {
     void
     clear();
 
+    // keys of the resident items, hottest first: protected items before probation ones, most recently used first
+    void
+    hot_keys(std::vector<std::string>& keys);
+
  private:
+    struct Entry {
+        ItemObj item_;
+        int64_t size_ = 0;  // size when inserted, the item may change its Size() later
+        uint64_t tick_ = 0;
+    };
+
+    struct Shard {
+        explicit Shard(uint64_t cache_max_count) : probation_(cache_max_count), protected_(cache_max_count) {
+        }
+
+        LRU<std::string, Entry> probation_;
+        LRU<std::string, Entry> protected_;
+        std::mutex mutex_;
+    };
+
+    Shard&
+    shard(const std::string& key);
+
+    // remove key from the shard, return released bytes, the shard lock must be held
+    int64_t
+    erase_no_lock(Shard& shard, const std::string& key);
+
+    // move protected items back to probation while protected segment is too large, the shard lock must be held
     void
-    free_memory();
+    demote_no_lock(Shard& shard);
+
+    // evict items until usage drops below threshold, the item of skip_key is kept
+    void
+    free_memory(const std::string& skip_key = "");
+
+    // pick the least recently used item of all shards, probation items go first
+    bool
+    pick_victim(const std::string& skip_key, size_t& shard_index, std::string& key, uint64_t& tick);
 
  private:
-    int64_t usage_;
-    int64_t capacity_;
+    std::string name_;
+    std::atomic<int64_t> usage_;
+    std::atomic<int64_t> protected_usage_;
+    std::atomic<int64_t> capacity_;
+    std::atomic<uint64_t> count_;
+    std::atomic<uint64_t> tick_;
+    uint64_t max_count_;
     double freemem_percent_;
 
-    LRU<std::string, ItemObj> lru_;
-    mutable std::mutex mutex_;
+    std::vector<std::unique_ptr<Shard>> shards_;
+    std::mutex free_mutex_;
 };
 
 }  // namespace cache
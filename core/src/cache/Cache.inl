@@ -13,11 +13,41 @@ namespace milvus {
 namespace cache {
 
 constexpr double DEFAULT_THRESHHOLD_PERCENT = 0.85;
+constexpr double PROTECTED_PERCENT = 0.8;
+constexpr size_t CACHE_SHARD_NUM = 16;
+
+// cache keys are file paths like <db_path>/tables/<table_id>/..., the table id is used as metric label
+inline std::string
+CacheKeyTableId(const std::string& key) {
+    static const std::string tables_folder = "/tables/";
+    auto begin = key.find(tables_folder);
+    if (begin == std::string::npos) {
+        return "";
+    }
+    begin += tables_folder.size();
+    auto end = key.find('/', begin);
+    return key.substr(begin, end == std::string::npos ? std::string::npos : end - begin);
+}
+
+template <typename ItemObj>
+Cache<ItemObj>::Cache(int64_t capacity, uint64_t cache_max_count, const std::string& name)
+    : name_(name),
+      usage_(0),
+      protected_usage_(0),
+      capacity_(capacity),
+      count_(0),
+      tick_(0),
+      max_count_(cache_max_count),
+      freemem_percent_(DEFAULT_THRESHHOLD_PERCENT) {
+    for (size_t i = 0; i < CACHE_SHARD_NUM; ++i) {
+        shards_.emplace_back(std::make_unique<Shard>(cache_max_count));
+    }
+}
 
 template <typename ItemObj>
-Cache<ItemObj>::Cache(int64_t capacity, uint64_t cache_max_count)
-    : usage_(0), capacity_(capacity), freemem_percent_(DEFAULT_THRESHHOLD_PERCENT), lru_(cache_max_count) {
-    //    AGENT_LOG_DEBUG << "Construct Cache with capacity " << std::to_string(mem_capacity)
+typename Cache<ItemObj>::Shard&
+Cache<ItemObj>::shard(const std::string& key) {
+    return *shards_[std::hash<std::string>()(key) % shards_.size()];
 }
 
 template <typename ItemObj>
@@ -32,26 +62,46 @@ Cache<ItemObj>::set_capacity(int64_t capacity) {
 template <typename ItemObj>
 size_t
 Cache<ItemObj>::size() const {
-    std::lock_guard<std::mutex> lock(mutex_);
-    return lru_.size();
+    return count_;
 }
 
 template <typename ItemObj>
 bool
 Cache<ItemObj>::exists(const std::string& key) {
-    std::lock_guard<std::mutex> lock(mutex_);
-    return lru_.exists(key);
+    auto& s = shard(key);
+    std::lock_guard<std::mutex> lock(s.mutex_);
+    return s.protected_.exists(key) || s.probation_.exists(key);
 }
 
 template <typename ItemObj>
 ItemObj
 Cache<ItemObj>::get(const std::string& key) {
-    std::lock_guard<std::mutex> lock(mutex_);
-    if (!lru_.exists(key)) {
-        return nullptr;
+    ItemObj item = nullptr;
+    {
+        auto& s = shard(key);
+        std::lock_guard<std::mutex> lock(s.mutex_);
+        Entry* entry = s.protected_.try_get(key);
+        if (entry != nullptr) {
+            entry->tick_ = ++tick_;
+            item = entry->item_;
+        } else if ((entry = s.probation_.try_get(key)) != nullptr) {
+            // second hit, promote to protected segment
+            Entry promoted = *entry;
+            promoted.tick_ = ++tick_;
+            s.probation_.erase(key);
+            s.protected_.put(key, promoted);
+            protected_usage_ += promoted.size_;
+            demote_no_lock(s);
+            item = promoted.item_;
+        }
     }
 
-    return lru_.get(key);
+    if (item == nullptr) {
+        server::Metrics::GetInstance().CacheMissTotalIncrement(name_, CacheKeyTableId(key));
+    } else {
+        server::Metrics::GetInstance().CacheHitTotalIncrement(name_, CacheKeyTableId(key));
+    }
+    return item;
 }
 
 template <typename ItemObj>
@@ -61,104 +111,196 @@ Cache<ItemObj>::insert(const std::string& key, const ItemObj& item) {
         return;
     }
 
-    //    if(item->size() > capacity_) {
-    //        SERVER_LOG_ERROR << "Item size " << item->size()
-    //                        << " is too large to insert into cache, capacity " << capacity_;
-    //        return;
-    //    }
-
-    // calculate usage
+    Entry entry;
+    entry.item_ = item;
+    entry.size_ = item->Size();
     {
-        std::lock_guard<std::mutex> lock(mutex_);
+        auto& s = shard(key);
+        std::lock_guard<std::mutex> lock(s.mutex_);
 
         // if key already exist, subtract old item size
-        if (lru_.exists(key)) {
-            const ItemObj& old_item = lru_.get(key);
-            usage_ -= old_item->Size();
-        }
+        erase_no_lock(s, key);
 
-        // plus new item size
-        usage_ += item->Size();
+        entry.tick_ = ++tick_;
+        s.probation_.put(key, entry);
+        usage_ += entry.size_;
+        ++count_;
     }
 
-    // if usage exceed capacity, free some items
-    if (usage_ > capacity_) {
+    SERVER_LOG_DEBUG << "Insert " << key << " size: " << entry.size_ << " bytes into cache, usage: " << usage_
+                     << " bytes," << " capacity: " << capacity_ << " bytes";
+
+    // if usage exceed capacity, free some items, but never the new one
+    if (usage_ > capacity_ || count_ > max_count_) {
         SERVER_LOG_DEBUG << "Current usage " << usage_ << " exceeds cache capacity " << capacity_
                          << ", start free memory";
-        free_memory();
+        free_memory(key);
     }
+}
 
-    // insert new item
+template <typename ItemObj>
+void
+Cache<ItemObj>::erase(const std::string& key) {
+    int64_t released = 0;
     {
-        std::lock_guard<std::mutex> lock(mutex_);
+        auto& s = shard(key);
+        std::lock_guard<std::mutex> lock(s.mutex_);
+        released = erase_no_lock(s, key);
+    }
 
-        lru_.put(key, item);
-        SERVER_LOG_DEBUG << "Insert " << key << " size: " << item->Size() << " bytes into cache, usage: " << usage_
+    if (released > 0) {
+        SERVER_LOG_DEBUG << "Erase " << key << " size: " << released << " bytes from cache, usage: " << usage_
                          << " bytes," << " capacity: " << capacity_ << " bytes";
     }
 }
 
 template <typename ItemObj>
-void
-Cache<ItemObj>::erase(const std::string& key) {
-    std::lock_guard<std::mutex> lock(mutex_);
-    if (!lru_.exists(key)) {
-        return;
+int64_t
+Cache<ItemObj>::erase_no_lock(Shard& s, const std::string& key) {
+    Entry* entry = s.protected_.try_get(key);
+    if (entry != nullptr) {
+        int64_t size = entry->size_;
+        protected_usage_ -= size;
+        usage_ -= size;
+        --count_;
+        s.protected_.erase(key);
+        return size;
     }
 
-    const ItemObj& old_item = lru_.get(key);
-    usage_ -= old_item->Size();
+    entry = s.probation_.try_get(key);
+    if (entry != nullptr) {
+        int64_t size = entry->size_;
+        usage_ -= size;
+        --count_;
+        s.probation_.erase(key);
+        return size;
+    }
 
-    SERVER_LOG_DEBUG << "Erase " << key << " size: " << old_item->Size() << " bytes from cache, usage: " << usage_
-                     << " bytes," << " capacity: " << capacity_ << " bytes";
+    return 0;
+}
 
-    lru_.erase(key);
+template <typename ItemObj>
+void
+Cache<ItemObj>::demote_no_lock(Shard& s) {
+    // keep at least one item so a promoted item isn't demoted immediately
+    int64_t protected_capacity = capacity_ * PROTECTED_PERCENT;
+    while (protected_usage_ > protected_capacity && s.protected_.size() > 1) {
+        auto last = s.protected_.rbegin();
+        std::string key = last->first;
+        Entry entry = last->second;
+        s.protected_.erase(key);
+        protected_usage_ -= entry.size_;
+        s.probation_.put(key, entry);
+    }
 }
 
 template <typename ItemObj>
 void
 Cache<ItemObj>::clear() {
-    std::lock_guard<std::mutex> lock(mutex_);
-    lru_.clear();
-    usage_ = 0;
+    for (auto& s : shards_) {
+        std::lock_guard<std::mutex> lock(s->mutex_);
+        for (auto it = s->protected_.begin(); it != s->protected_.end(); ++it) {
+            protected_usage_ -= it->second.size_;
+            usage_ -= it->second.size_;
+        }
+        for (auto it = s->probation_.begin(); it != s->probation_.end(); ++it) {
+            usage_ -= it->second.size_;
+        }
+        count_ -= s->protected_.size() + s->probation_.size();
+        s->protected_.clear();
+        s->probation_.clear();
+    }
     SERVER_LOG_DEBUG << "Clear cache !";
 }
 
-/* free memory space when CACHE occupation exceed its capacity */
 template <typename ItemObj>
 void
-Cache<ItemObj>::free_memory() {
-    if (usage_ <= capacity_)
-        return;
+Cache<ItemObj>::hot_keys(std::vector<std::string>& keys) {
+    keys.clear();
+    for (int segment = 0; segment < 2; ++segment) {
+        std::vector<std::pair<uint64_t, std::string>> ticked_keys;
+        for (auto& s : shards_) {
+            std::lock_guard<std::mutex> lock(s->mutex_);
+            auto& lru = (segment == 0) ? s->protected_ : s->probation_;
+            for (auto it = lru.begin(); it != lru.end(); ++it) {
+                ticked_keys.emplace_back(it->second.tick_, it->first);
+            }
+        }
+        std::sort(ticked_keys.begin(), ticked_keys.end(),
+                  [](const std::pair<uint64_t, std::string>& l, const std::pair<uint64_t, std::string>& r) {
+                      return l.first > r.first;
+                  });
+        for (auto& pair : ticked_keys) {
+            keys.emplace_back(std::move(pair.second));
+        }
+    }
+}
 
-    int64_t threshhold = capacity_ * freemem_percent_;
-    int64_t delta_size = usage_ - threshhold;
-    if (delta_size <= 0) {
-        delta_size = 1;  // ensure at least one item erased
+template <typename ItemObj>
+bool
+Cache<ItemObj>::pick_victim(const std::string& skip_key, size_t& shard_index, std::string& key, uint64_t& tick) {
+    bool found = false;
+    for (int segment = 0; segment < 2 && !found; ++segment) {
+        for (size_t i = 0; i < shards_.size(); ++i) {
+            auto& s = *shards_[i];
+            std::lock_guard<std::mutex> lock(s.mutex_);
+            auto& lru = (segment == 0) ? s.probation_ : s.protected_;
+            for (auto it = lru.rbegin(); it != lru.rend(); ++it) {
+                if (it->first == skip_key) {
+                    continue;
+                }
+                if (!found || it->second.tick_ < tick) {
+                    found = true;
+                    shard_index = i;
+                    key = it->first;
+                    tick = it->second.tick_;
+                }
+                break;
+            }
+        }
     }
 
-    std::set<std::string> key_array;
-    int64_t released_size = 0;
+    return found;
+}
 
-    {
-        std::lock_guard<std::mutex> lock(mutex_);
+/* free memory space when CACHE occupation exceed its capacity */
+template <typename ItemObj>
+void
+Cache<ItemObj>::free_memory(const std::string& skip_key) {
+    // only one thread evicts at a time, others return once the usage is back under capacity
+    std::lock_guard<std::mutex> free_lock(free_mutex_);
+    if (usage_ <= capacity_ && count_ <= max_count_) {
+        return;
+    }
 
-        auto it = lru_.rbegin();
-        while (it != lru_.rend() && released_size < delta_size) {
-            auto& key = it->first;
-            auto& obj_ptr = it->second;
+    int64_t threshhold = capacity_ * freemem_percent_;
+    int64_t released_size = 0;
+    do {
+        size_t shard_index = 0;
+        std::string key;
+        uint64_t tick = 0;
+        if (!pick_victim(skip_key, shard_index, key, tick)) {
+            break;
+        }
 
-            key_array.emplace(key);
-            released_size += obj_ptr->Size();
-            ++it;
+        // the victim may have been hit since it was picked, then pick again
+        auto& s = *shards_[shard_index];
+        bool evicted = false;
+        {
+            std::lock_guard<std::mutex> lock(s.mutex_);
+            Entry* entry = s.probation_.exists(key) ? s.probation_.try_get(key) : s.protected_.try_get(key);
+            if (entry != nullptr && entry->tick_ == tick) {
+                released_size += erase_no_lock(s, key);
+                evicted = true;
+            }
         }
-    }
 
-    SERVER_LOG_DEBUG << "to be released memory size: " << released_size;
+        if (evicted) {
+            server::Metrics::GetInstance().CacheEvictionTotalIncrement(name_, CacheKeyTableId(key));
+        }
+    } while (usage_ > threshhold || count_ > max_count_);
 
-    for (auto& key : key_array) {
-        erase(key);
-    }
+    SERVER_LOG_DEBUG << "Released memory size: " << released_size;
 
     print();
 }
@@ -166,19 +308,9 @@ Cache<ItemObj>::free_memory() {
 template <typename ItemObj>
 void
 Cache<ItemObj>::print() {
-    size_t cache_count = 0;
-    {
-        std::lock_guard<std::mutex> lock(mutex_);
-        cache_count = lru_.size();
-#if 0
-        for (auto it = lru_.begin(); it != lru_.end(); ++it) {
-            SERVER_LOG_DEBUG << it->first;
-        }
-#endif
-    }
-
-    SERVER_LOG_DEBUG << "[Cache item count]: " << cache_count;
+    SERVER_LOG_DEBUG << "[Cache item count]: " << count_;
     SERVER_LOG_DEBUG << "[Cache usage]: " << usage_ << " bytes";
+    SERVER_LOG_DEBUG << "[Cache protected usage]: " << protected_usage_ << " bytes";
     SERVER_LOG_DEBUG << "[Cache capacity]: " << capacity_ << " bytes";
 }
 
@@ -17,6 +17,7 @@
 
 #include <memory>
 #include <string>
+#include <vector>
 
 namespace milvus {
 namespace cache {
@@ -45,6 +46,10 @@ class CacheMgr {
     virtual void
     ClearCache();
 
+    // keys of the cached items, hottest first
+    std::vector<std::string>
+    HotKeys();
+
     int64_t
     CacheUsage() const;
 
@@ -99,6 +99,19 @@ CacheMgr<ItemObj>::ClearCache() {
     cache_->clear();
 }
 
+template <typename ItemObj>
+std::vector<std::string>
+CacheMgr<ItemObj>::HotKeys() {
+    std::vector<std::string> keys;
+    if (cache_ == nullptr) {
+        SERVER_LOG_ERROR << "Cache doesn't exist";
+        return keys;
+    }
+
+    cache_->hot_keys(keys);
+    return keys;
+}
+
 template <typename ItemObj>
 int64_t
 CacheMgr<ItemObj>::CacheUsage() const {
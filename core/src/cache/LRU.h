@@ -59,6 +59,17 @@ class LRU {
         }
     }
 
+    // same as get(), but returns nullptr instead of throwing when the key doesn't exist
+    value_t*
+    try_get(const key_t& key) {
+        auto it = cache_items_map_.find(key);
+        if (it == cache_items_map_.end()) {
+            return nullptr;
+        }
+        cache_items_list_.splice(cache_items_list_.begin(), cache_items_list_, it->second);
+        return &(it->second->second);
+    }
+
     void
     erase(const key_t& key) {
         auto it = cache_items_map_.find(key);
@@ -0,0 +1,105 @@
+// Copyright (C) 2019-2020 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License.
+
+#include "cache/SegmentCacheMgr.h"
+#include "server/Config.h"
+#include "utils/Log.h"
+
+#include <utility>
+
+namespace milvus {
+namespace cache {
+
+namespace {
+constexpr int64_t unit = 1024 * 1024 * 1024;
+}
+
+SegmentCacheMgr::SegmentCacheMgr() {
+    // All config values have been checked in Config::ValidateConfig()
+    server::Config& config = server::Config::GetInstance();
+
+    int64_t segment_cache_cap;
+    config.GetCacheConfigSegmentCacheCapacity(segment_cache_cap);
+    int64_t cap = segment_cache_cap * unit;
+    cache_ = std::make_shared<Cache<DataObjPtr>>(cap, 1UL << 32, "segment");
+
+    float cpu_cache_threshold;
+    config.GetCacheConfigCpuCacheThreshold(cpu_cache_threshold);
+    cache_->set_freemem_percent(cpu_cache_threshold);
+}
+
+SegmentCacheMgr*
+SegmentCacheMgr::GetInstance() {
+    static SegmentCacheMgr s_mgr;
+    return &s_mgr;
+}
+
+std::string
+SegmentCacheMgr::UidsKey(const std::string& segment_dir) {
+    return segment_dir + ":uids";
+}
+
+std::string
+SegmentCacheMgr::DeletedDocsKey(const std::string& segment_dir) {
+    return segment_dir + ":deleted_docs";
+}
+
+std::string
+SegmentCacheMgr::BloomFilterKey(const std::string& segment_dir) {
+    return segment_dir + ":bloom_filter";
+}
+
+std::string
+SegmentCacheMgr::IdIndexKey(const std::string& segment_dir) {
+    return segment_dir + ":id_index";
+}
+
+std::string
+SegmentCacheMgr::VectorsSummaryKey(const std::string& segment_dir) {
+    return segment_dir + ":vectors_summary";
+}
+
+uint64_t
+SegmentCacheMgr::Epoch() {
+    std::lock_guard<std::mutex> lock(epoch_mutex_);
+    return epoch_;
+}
+
+void
+SegmentCacheMgr::InsertComponent(const std::string& key, const DataObjPtr& data, uint64_t epoch) {
+    std::lock_guard<std::mutex> lock(epoch_mutex_);
+    if (epoch != epoch_) {
+        // something was written while the component was read, it may be stale
+        return;
+    }
+    InsertItem(key, data);
+}
+
+void
+SegmentCacheMgr::EraseComponent(const std::string& key) {
+    std::lock_guard<std::mutex> lock(epoch_mutex_);
+    ++epoch_;
+    EraseItem(key);
+}
+
+void
+SegmentCacheMgr::EraseSegment(const std::string& segment_dir) {
+    std::lock_guard<std::mutex> lock(epoch_mutex_);
+    ++epoch_;
+    EraseItem(UidsKey(segment_dir));
+    EraseItem(DeletedDocsKey(segment_dir));
+    EraseItem(BloomFilterKey(segment_dir));
+    EraseItem(IdIndexKey(segment_dir));
+    EraseItem(VectorsSummaryKey(segment_dir));
+}
+
+}  // namespace cache
+}  // namespace milvus
@@ -0,0 +1,69 @@
+// Copyright (C) 2019-2020 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License.
+
+#pragma once
+
+#include "CacheMgr.h"
+#include "DataObj.h"
+
+#include <memory>
+#include <mutex>
+#include <string>
+
+namespace milvus {
+namespace cache {
+
+// Caches the small per segment components (uids, deleted docs, bloom filter, uid index, vectors summary) with a
+// capacity budget separated from the index cache. A component read from disk is only inserted if no component was
+// invalidated since the read started, so that a concurrent write of the segment never leaves a stale entry behind.
+class SegmentCacheMgr : public CacheMgr<DataObjPtr> {
+ private:
+    SegmentCacheMgr();
+
+ public:
+    static SegmentCacheMgr*
+    GetInstance();
+
+    static std::string
+    UidsKey(const std::string& segment_dir);
+
+    static std::string
+    DeletedDocsKey(const std::string& segment_dir);
+
+    static std::string
+    BloomFilterKey(const std::string& segment_dir);
+
+    static std::string
+    IdIndexKey(const std::string& segment_dir);
+
+    static std::string
+    VectorsSummaryKey(const std::string& segment_dir);
+
+    // take before reading a component from disk
+    uint64_t
+    Epoch();
+
+    void
+    InsertComponent(const std::string& key, const DataObjPtr& data, uint64_t epoch);
+
+    void
+    EraseComponent(const std::string& key);
+
+    void
+    EraseSegment(const std::string& segment_dir);
+
+ private:
+    std::mutex epoch_mutex_;
+    uint64_t epoch_ = 0;
+};
+
+}  // namespace cache
+}  // namespace milvus
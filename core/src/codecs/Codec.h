@@ -24,6 +24,7 @@
 #include "IdIndexFormat.h"
 #include "VectorsFormat.h"
 #include "VectorsIndexFormat.h"
+#include "VectorsSummaryFormat.h"
 
 namespace milvus {
 namespace codec {
@@ -39,6 +40,9 @@ class Codec {
     virtual IdBloomFilterFormatPtr
     GetIdBloomFilterFormat() = 0;
 
+    virtual VectorsSummaryFormatPtr
+    GetVectorsSummaryFormat() = 0;
+
     // TODO(zhiru)
     /*
     virtual AttrsFormat
@@ -20,6 +20,7 @@
 #include <memory>
 #include <vector>
 
+#include "segment/MappedVectors.h"
 #include "segment/Vectors.h"
 #include "store/Directory.h"
 
@@ -40,6 +41,9 @@ class VectorsFormat {
     virtual void
     read_vectors(const store::DirectoryPtr& directory_ptr, off_t offset, size_t num_bytes,
                  std::vector<uint8_t>& raw_vectors) = 0;
+
+    virtual void
+    read_vectors_mapped(const store::DirectoryPtr& directory_ptr, segment::MappedVectorsPtr& mapped_vectors) = 0;
 };
 
 using VectorsFormatPtr = std::shared_ptr<VectorsFormat>;
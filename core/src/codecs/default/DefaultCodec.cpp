@@ -22,6 +22,7 @@
 #include "DefaultDeletedDocsFormat.h"
 #include "DefaultIdBloomFilterFormat.h"
 #include "DefaultVectorsFormat.h"
+#include "DefaultVectorsSummaryFormat.h"
 
 namespace milvus {
 namespace codec {
@@ -30,6 +31,7 @@ DefaultCodec::DefaultCodec() {
     vectors_format_ptr_ = std::make_shared<DefaultVectorsFormat>();
     deleted_docs_format_ptr_ = std::make_shared<DefaultDeletedDocsFormat>();
     id_bloom_filter_format_ptr_ = std::make_shared<DefaultIdBloomFilterFormat>();
+    vectors_summary_format_ptr_ = std::make_shared<DefaultVectorsSummaryFormat>();
 }
 
 VectorsFormatPtr
@@ -47,5 +49,10 @@ DefaultCodec::GetIdBloomFilterFormat() {
     return id_bloom_filter_format_ptr_;
 }
 
+VectorsSummaryFormatPtr
+DefaultCodec::GetVectorsSummaryFormat() {
+    return vectors_summary_format_ptr_;
+}
+
 }  // namespace codec
 }  // namespace milvus
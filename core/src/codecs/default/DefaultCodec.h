@@ -35,10 +35,14 @@ class DefaultCodec : public Codec {
     IdBloomFilterFormatPtr
     GetIdBloomFilterFormat() override;
 
+    VectorsSummaryFormatPtr
+    GetVectorsSummaryFormat() override;
+
  private:
     VectorsFormatPtr vectors_format_ptr_;
     DeletedDocsFormatPtr deleted_docs_format_ptr_;
     IdBloomFilterFormatPtr id_bloom_filter_format_ptr_;
+    VectorsSummaryFormatPtr vectors_summary_format_ptr_;
 };
 
 }  // namespace codec
@@ -20,11 +20,17 @@
 #include <fcntl.h>
 #include <unistd.h>
 
+#include <algorithm>
+#include <array>
 #include <boost/filesystem.hpp>
+#include <cstring>
+#include <functional>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <vector>
 
+#include "codecs/default/ReadOnlyFile.h"
 #include "segment/Types.h"
 #include "utils/Exception.h"
 #include "utils/Log.h"
@@ -32,65 +38,225 @@
 namespace milvus {
 namespace codec {
 
+namespace {
+
+// The deleted docs file holds a header followed by the containers of the offsets, as in a roaring bitmap:
+// offsets sharing their high 16 bits go to one container, kept as a sorted array of the low 16 bits while it is
+// sparse and as a 65536 bits bitmap once it holds more than ARRAY_CONTAINER_MAX_SIZE offsets.
+// Files written before this format are plain arrays of offsets. The magic is negative as an offset, so it never
+// starts a legacy file, and a legacy file is rewritten in this format by the next write of the segment.
+constexpr uint32_t DELETED_DOCS_MAGIC = 0xDE1D0C5B;
+constexpr uint32_t DELETED_DOCS_VERSION = 1;
+
+constexpr uint16_t ARRAY_CONTAINER = 0;
+constexpr uint16_t BITMAP_CONTAINER = 1;
+constexpr uint32_t CONTAINER_BITS = 1 << 16;
+constexpr uint32_t BITMAP_CONTAINER_WORDS = CONTAINER_BITS / 64;
+constexpr uint32_t ARRAY_CONTAINER_MAX_SIZE = 4096;  // an array of 4096 uint16 is as large as the bitmap
+
+struct DeletedDocsHeader {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t container_count;
+    uint32_t cardinality;
+};
+
+struct ContainerHeader {
+    uint16_t key;
+    uint16_t type;
+    uint32_t cardinality;
+};
+
 void
-DefaultDeletedDocsFormat::read(const store::DirectoryPtr& directory_ptr, segment::DeletedDocsPtr& deleted_docs) {
-    const std::lock_guard<std::mutex> lock(mutex_);
+ThrowReadError(const std::string& file_path, const std::string& reason) {
+    std::string err_msg = "Failed to read from file: " + file_path + ", " + reason;
+    ENGINE_LOG_ERROR << err_msg;
+    throw Exception(SERVER_UNEXPECTED_ERROR, err_msg);
+}
 
-    std::string dir_path = directory_ptr->GetDirPath();
-    const std::string del_file_path = dir_path + "/" + deleted_docs_filename_;
+// offsets must be sorted and unique
+void
+Encode(const std::vector<segment::offset_t>& offsets, std::vector<uint8_t>& buffer) {
+    auto append = [&buffer](const void* data, size_t size) {
+        auto bytes = reinterpret_cast<const uint8_t*>(data);
+        buffer.insert(buffer.end(), bytes, bytes + size);
+    };
 
-    int del_fd = open(del_file_path.c_str(), O_RDONLY, 00664);
-    if (del_fd == -1) {
-        std::string err_msg = "Failed to open file: " + del_file_path;
-        ENGINE_LOG_ERROR << err_msg;
-        throw Exception(SERVER_CANNOT_CREATE_FILE, err_msg);
+    DeletedDocsHeader header{DELETED_DOCS_MAGIC, DELETED_DOCS_VERSION, 0, static_cast<uint32_t>(offsets.size())};
+    append(&header, sizeof(header));
+
+    std::vector<uint16_t> lows;
+    std::vector<uint64_t> words;
+    for (size_t begin = 0; begin < offsets.size();) {
+        uint16_t key = static_cast<uint32_t>(offsets[begin]) >> 16;
+        size_t end = begin;
+        while (end < offsets.size() && (static_cast<uint32_t>(offsets[end]) >> 16) == key) {
+            ++end;
+        }
+
+        ContainerHeader container{key, ARRAY_CONTAINER, static_cast<uint32_t>(end - begin)};
+        if (container.cardinality <= ARRAY_CONTAINER_MAX_SIZE) {
+            lows.clear();
+            for (size_t i = begin; i < end; ++i) {
+                lows.push_back(static_cast<uint16_t>(offsets[i] & 0xFFFF));
+            }
+            append(&container, sizeof(container));
+            append(lows.data(), lows.size() * sizeof(uint16_t));
+        } else {
+            container.type = BITMAP_CONTAINER;
+            words.assign(BITMAP_CONTAINER_WORDS, 0);
+            for (size_t i = begin; i < end; ++i) {
+                uint32_t low = offsets[i] & 0xFFFF;
+                words[low >> 6] |= (uint64_t)1 << (low & 63);
+            }
+            append(&container, sizeof(container));
+            append(words.data(), words.size() * sizeof(uint64_t));
+        }
+
+        ++header.container_count;
+        begin = end;
     }
 
-    auto file_size = boost::filesystem::file_size(boost::filesystem::path(del_file_path));
-    auto deleted_docs_size = file_size / sizeof(segment::offset_t);
-    std::vector<segment::offset_t> deleted_docs_list;
-    deleted_docs_list.resize(deleted_docs_size);
+    memcpy(buffer.data(), &header, sizeof(header));
+}
 
-    if (::read(del_fd, deleted_docs_list.data(), file_size) == -1) {
-        std::string err_msg = "Failed to read from file: " + del_file_path + ", error: " + std::strerror(errno);
-        ENGINE_LOG_ERROR << err_msg;
-        throw Exception(SERVER_WRITE_ERROR, err_msg);
+void
+Decode(const std::string& file_path, const std::vector<uint8_t>& buffer, std::vector<segment::offset_t>& offsets) {
+    size_t pos = 0;
+    auto take = [&](void* data, size_t size) {
+        if (pos + size > buffer.size()) {
+            ThrowReadError(file_path, "deleted docs file is truncated");
+        }
+        memcpy(data, buffer.data() + pos, size);
+        pos += size;
+    };
+
+    DeletedDocsHeader header;
+    take(&header, sizeof(header));
+    if (header.version != DELETED_DOCS_VERSION) {
+        ThrowReadError(file_path, "unknown deleted docs version " + std::to_string(header.version));
     }
 
-    deleted_docs = std::make_shared<segment::DeletedDocs>(deleted_docs_list);
+    offsets.clear();
+    offsets.reserve(header.cardinality);
+    std::vector<uint16_t> lows;
+    std::vector<uint64_t> words(BITMAP_CONTAINER_WORDS);
+    for (uint32_t c = 0; c < header.container_count; ++c) {
+        ContainerHeader container;
+        take(&container, sizeof(container));
+        uint32_t high = static_cast<uint32_t>(container.key) << 16;
+        if (container.type == ARRAY_CONTAINER) {
+            lows.resize(container.cardinality);
+            take(lows.data(), lows.size() * sizeof(uint16_t));
+            for (auto low : lows) {
+                offsets.push_back(static_cast<segment::offset_t>(high | low));
+            }
+        } else if (container.type == BITMAP_CONTAINER) {
+            take(words.data(), words.size() * sizeof(uint64_t));
+            for (uint32_t w = 0; w < BITMAP_CONTAINER_WORDS; ++w) {
+                uint64_t word = words[w];
+                while (word != 0) {
+                    uint32_t bit = __builtin_ctzll(word);
+                    offsets.push_back(static_cast<segment::offset_t>(high | (w << 6) | bit));
+                    word &= word - 1;
+                }
+            }
+        } else {
+            ThrowReadError(file_path, "unknown deleted docs container type " + std::to_string(container.type));
+        }
+    }
+}
 
-    if (::close(del_fd) == -1) {
-        std::string err_msg = "Failed to close file: " + del_file_path + ", error: " + std::strerror(errno);
-        ENGINE_LOG_ERROR << err_msg;
-        throw Exception(SERVER_WRITE_ERROR, err_msg);
+// a write merges with the file on disk and replaces it through a fixed temp file, so two writes of one segment must
+// not interleave. Codec instances are created for every read or write, so the lock is picked by the file path
+std::mutex&
+WriteLock(const std::string& file_path) {
+    static std::array<std::mutex, 64> locks;
+    return locks[std::hash<std::string>()(file_path) % locks.size()];
+}
+
+// reads the file in either format, offsets are returned sorted and unique
+void
+ReadOffsets(const std::string& file_path, std::vector<segment::offset_t>& offsets) {
+    offsets.clear();
+
+    ReadOnlyFile del_file(file_path);
+    std::vector<uint8_t> buffer(del_file.Size());
+    del_file.ReadAt(buffer.data(), buffer.size(), 0);
+
+    uint32_t magic = 0;
+    if (buffer.size() >= sizeof(magic)) {
+        memcpy(&magic, buffer.data(), sizeof(magic));
+    }
+
+    if (magic == DELETED_DOCS_MAGIC) {
+        Decode(file_path, buffer, offsets);
+    } else {
+        // legacy format, offsets appended by every write, may have duplicates
+        offsets.resize(buffer.size() / sizeof(segment::offset_t));
+        memcpy(offsets.data(), buffer.data(), offsets.size() * sizeof(segment::offset_t));
+        std::sort(offsets.begin(), offsets.end());
+        offsets.erase(std::unique(offsets.begin(), offsets.end()), offsets.end());
     }
 }
 
+}  // namespace
+
 void
-DefaultDeletedDocsFormat::write(const store::DirectoryPtr& directory_ptr, const segment::DeletedDocsPtr& deleted_docs) {
-    const std::lock_guard<std::mutex> lock(mutex_);
+DefaultDeletedDocsFormat::read(const store::DirectoryPtr& directory_ptr, segment::DeletedDocsPtr& deleted_docs) {
+    // the file is replaced by rename on write, a read sees either the old or the new file and needs no lock
+    std::string dir_path = directory_ptr->GetDirPath();
+    const std::string del_file_path = dir_path + "/" + deleted_docs_filename_;
+
+    std::vector<segment::offset_t> deleted_docs_list;
+    ReadOffsets(del_file_path, deleted_docs_list);
+
+    deleted_docs = std::make_shared<segment::DeletedDocs>(deleted_docs_list);
+}
 
+void
+DefaultDeletedDocsFormat::write(const store::DirectoryPtr& directory_ptr, const segment::DeletedDocsPtr& deleted_docs) {
     std::string dir_path = directory_ptr->GetDirPath();
     const std::string del_file_path = dir_path + "/" + deleted_docs_filename_;
+    const std::string temp_path = del_file_path + ".temp";
+
+    const std::lock_guard<std::mutex> lock(WriteLock(del_file_path));
+
+    // merge with the offsets on disk, the file is then replaced as a whole so readers never see a partial write
+    std::vector<segment::offset_t> deleted_docs_list;
+    if (boost::filesystem::exists(del_file_path)) {
+        ReadOffsets(del_file_path, deleted_docs_list);
+    }
+    auto& new_offsets = deleted_docs->GetDeletedDocs();
+    deleted_docs_list.insert(deleted_docs_list.end(), new_offsets.begin(), new_offsets.end());
+    std::sort(deleted_docs_list.begin(), deleted_docs_list.end());
+    deleted_docs_list.erase(std::unique(deleted_docs_list.begin(), deleted_docs_list.end()), deleted_docs_list.end());
+
+    std::vector<uint8_t> buffer;
+    Encode(deleted_docs_list, buffer);
 
-    // TODO(zhiru): append mode
-    int del_fd = open(del_file_path.c_str(), O_WRONLY | O_APPEND | O_CREAT, 00664);
+    int del_fd = open(temp_path.c_str(), O_WRONLY | O_TRUNC | O_CREAT, 00664);
     if (del_fd == -1) {
-        std::string err_msg = "Failed to open file: " + del_file_path;
+        std::string err_msg = "Failed to open file: " + temp_path;
         ENGINE_LOG_ERROR << err_msg;
         throw Exception(SERVER_CANNOT_CREATE_FILE, err_msg);
     }
 
-    auto deleted_docs_list = deleted_docs->GetDeletedDocs();
-
-    if (::write(del_fd, deleted_docs_list.data(), sizeof(segment::offset_t) * deleted_docs->GetSize()) == -1) {
-        std::string err_msg = "Failed to write to file" + del_file_path + ", error: " + std::strerror(errno);
+    if (::write(del_fd, buffer.data(), buffer.size()) != static_cast<ssize_t>(buffer.size())) {
+        std::string err_msg = "Failed to write to file" + temp_path + ", error: " + std::strerror(errno);
         ENGINE_LOG_ERROR << err_msg;
+        ::close(del_fd);
         throw Exception(SERVER_WRITE_ERROR, err_msg);
     }
 
     if (::close(del_fd) == -1) {
-        std::string err_msg = "Failed to close file: " + del_file_path + ", error: " + std::strerror(errno);
+        std::string err_msg = "Failed to close file: " + temp_path + ", error: " + std::strerror(errno);
+        ENGINE_LOG_ERROR << err_msg;
+        throw Exception(SERVER_WRITE_ERROR, err_msg);
+    }
+
+    if (::rename(temp_path.c_str(), del_file_path.c_str()) == -1) {
+        std::string err_msg = "Failed to rename file: " + temp_path + ", error: " + std::strerror(errno);
         ENGINE_LOG_ERROR << err_msg;
         throw Exception(SERVER_WRITE_ERROR, err_msg);
     }
@@ -17,34 +17,89 @@
 
 #include "codecs/default/DefaultIdBloomFilterFormat.h"
 
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <cstring>
+#include <functional>
 #include <memory>
 #include <string>
+#include <thread>
+#include <utility>
+#include <vector>
 
+#include "codecs/default/DefaultVectorsFormat.h"
+#include "codecs/default/ReadOnlyFile.h"
 #include "utils/Exception.h"
 #include "utils/Log.h"
 
 namespace milvus {
 namespace codec {
 
-constexpr unsigned int bloom_filter_capacity = 500000;
-constexpr double bloom_filter_error_rate = 0.01;
+namespace {
+
+// The bloom filter file holds a header followed by the blocks of the filter. Files without the magic were written
+// by the dablooms filter used before, such a filter is rebuilt from the uids of the segment when it is read.
+constexpr uint32_t BLOOM_FILTER_MAGIC = 0xB100F11EU;
+constexpr uint32_t BLOOM_FILTER_VERSION = 1;
+
+struct BloomFilterHeader {
+    uint32_t magic;
+    uint32_t version;
+    uint64_t num_words;
+};
+
+void
+ThrowIOError(const std::string& action, const std::string& file_path) {
+    std::string err_msg = "Failed to " + action + " bloom filter file: " + file_path + ". " + std::strerror(errno);
+    ENGINE_LOG_ERROR << err_msg;
+    throw Exception(SERVER_UNEXPECTED_ERROR, err_msg);
+}
+
+}  // namespace
 
 void
 DefaultIdBloomFilterFormat::read(const store::DirectoryPtr& directory_ptr,
                                  segment::IdBloomFilterPtr& id_bloom_filter_ptr) {
-    const std::lock_guard<std::mutex> lock(mutex_);
-
+    // the file is replaced by rename on write, a read sees either the old or the new file and needs no lock
     std::string dir_path = directory_ptr->GetDirPath();
     const std::string bloom_filter_file_path = dir_path + "/" + bloom_filter_filename_;
-    scaling_bloom_t* bloom_filter =
-        new_scaling_bloom_from_file(bloom_filter_capacity, bloom_filter_error_rate, bloom_filter_file_path.c_str());
-    if (bloom_filter == nullptr) {
-        std::string err_msg =
-            "Failed to read bloom filter from file: " + bloom_filter_file_path + ". " + std::strerror(errno);
+
+    ReadOnlyFile file(bloom_filter_file_path);
+    BloomFilterHeader header;
+    memset(&header, 0, sizeof(header));
+    if (file.Size() >= sizeof(header)) {
+        file.ReadAt(&header, sizeof(header), 0);
+    }
+
+    if (header.magic != BLOOM_FILTER_MAGIC) {
+        // legacy dablooms filter, rebuild it from the uids and replace the file
+        ENGINE_LOG_DEBUG << "Rebuilding legacy bloom filter of segment " << dir_path;
+        std::vector<segment::doc_id_t> uids;
+        DefaultVectorsFormat vectors_format;
+        vectors_format.read_uids(directory_ptr, uids);
+
+        id_bloom_filter_ptr = std::make_shared<segment::IdBloomFilter>(uids.size());
+        for (auto uid : uids) {
+            id_bloom_filter_ptr->Add(uid);
+        }
+
+        const std::lock_guard<std::mutex> lock(mutex_);
+        WriteFile(bloom_filter_file_path, id_bloom_filter_ptr);
+        return;
+    }
+
+    if (header.version != BLOOM_FILTER_VERSION ||
+        sizeof(header) + header.num_words * sizeof(uint32_t) != file.Size()) {
+        std::string err_msg = "Bloom filter file is damaged: " + bloom_filter_file_path;
         ENGINE_LOG_ERROR << err_msg;
         throw Exception(SERVER_UNEXPECTED_ERROR, err_msg);
     }
-    id_bloom_filter_ptr = std::make_shared<segment::IdBloomFilter>(bloom_filter);
+
+    std::vector<uint32_t> blocks(header.num_words);
+    file.ReadAt(blocks.data(), blocks.size() * sizeof(uint32_t), sizeof(header));
+
+    id_bloom_filter_ptr = std::make_shared<segment::IdBloomFilter>(std::move(blocks));
 }
 
 void
@@ -54,28 +109,42 @@ DefaultIdBloomFilterFormat::write(const store::DirectoryPtr& directory_ptr,
 
     std::string dir_path = directory_ptr->GetDirPath();
     const std::string bloom_filter_file_path = dir_path + "/" + bloom_filter_filename_;
-    if (scaling_bloom_flush(id_bloom_filter_ptr->GetBloomFilter()) == -1) {
-        std::string err_msg =
-            "Failed to write bloom filter to file: " + bloom_filter_file_path + ". " + std::strerror(errno);
-        ENGINE_LOG_ERROR << err_msg;
-        throw Exception(SERVER_UNEXPECTED_ERROR, err_msg);
-    }
+    WriteFile(bloom_filter_file_path, id_bloom_filter_ptr);
 }
 
 void
-DefaultIdBloomFilterFormat::create(const store::DirectoryPtr& directory_ptr,
-                                   segment::IdBloomFilterPtr& id_bloom_filter_ptr) {
-    std::string dir_path = directory_ptr->GetDirPath();
-    const std::string bloom_filter_file_path = dir_path + "/" + bloom_filter_filename_;
-    scaling_bloom_t* bloom_filter =
-        new_scaling_bloom(bloom_filter_capacity, bloom_filter_error_rate, bloom_filter_file_path.c_str());
-    if (bloom_filter == nullptr) {
-        std::string err_msg =
-            "Failed to read bloom filter from file: " + bloom_filter_file_path + ". " + std::strerror(errno);
-        ENGINE_LOG_ERROR << err_msg;
-        throw Exception(SERVER_UNEXPECTED_ERROR, err_msg);
+DefaultIdBloomFilterFormat::create(uint64_t capacity, segment::IdBloomFilterPtr& id_bloom_filter_ptr) {
+    id_bloom_filter_ptr = std::make_shared<segment::IdBloomFilter>(capacity);
+}
+
+void
+DefaultIdBloomFilterFormat::WriteFile(const std::string& file_path,
+                                      const segment::IdBloomFilterPtr& id_bloom_filter_ptr) {
+    // write to a temp file and rename, the file may be read meanwhile. Readers of a legacy file may rebuild it at
+    // the same time, so the temp file is private to the thread
+    auto thread_hash = std::hash<std::thread::id>()(std::this_thread::get_id());
+    const std::string temp_path = file_path + ".temp" + std::to_string(thread_hash);
+    auto& blocks = id_bloom_filter_ptr->GetBlocks();
+    BloomFilterHeader header{BLOOM_FILTER_MAGIC, BLOOM_FILTER_VERSION, blocks.size()};
+
+    int fd = open(temp_path.c_str(), O_WRONLY | O_TRUNC | O_CREAT, 00664);
+    if (fd == -1) {
+        ThrowIOError("open", temp_path);
+    }
+
+    auto num_bytes = static_cast<ssize_t>(blocks.size() * sizeof(uint32_t));
+    if (::write(fd, &header, sizeof(header)) != sizeof(header) || ::write(fd, blocks.data(), num_bytes) != num_bytes) {
+        ::close(fd);
+        ThrowIOError("write", temp_path);
+    }
+
+    if (::close(fd) == -1) {
+        ThrowIOError("close", temp_path);
+    }
+
+    if (::rename(temp_path.c_str(), file_path.c_str()) == -1) {
+        ThrowIOError("rename", temp_path);
     }
-    id_bloom_filter_ptr = std::make_shared<segment::IdBloomFilter>(bloom_filter);
 }
 
 }  // namespace codec
@@ -38,7 +38,7 @@ class DefaultIdBloomFilterFormat : public IdBloomFilterFormat {
     write(const store::DirectoryPtr& directory_ptr, const segment::IdBloomFilterPtr& id_bloom_filter_ptr) override;
 
     void
-    create(const store::DirectoryPtr& directory_ptr, segment::IdBloomFilterPtr& id_bloom_filter_ptr) override;
+    create(uint64_t capacity, segment::IdBloomFilterPtr& id_bloom_filter_ptr) override;
 
     // No copy and move
     DefaultIdBloomFilterFormat(const DefaultIdBloomFilterFormat&) = delete;
@@ -49,6 +49,10 @@ class DefaultIdBloomFilterFormat : public IdBloomFilterFormat {
     DefaultIdBloomFilterFormat&
     operator=(DefaultIdBloomFilterFormat&&) = delete;
 
+ private:
+    void
+    WriteFile(const std::string& file_path, const segment::IdBloomFilterPtr& id_bloom_filter_ptr);
+
  private:
     std::mutex mutex_;
 
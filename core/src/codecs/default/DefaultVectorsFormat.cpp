@@ -18,10 +18,13 @@
 #include "codecs/default/DefaultVectorsFormat.h"
 
 #include <fcntl.h>
+#include <sys/mman.h>
 #include <unistd.h>
 
 #include <boost/filesystem.hpp>
+#include <utility>
 
+#include "codecs/default/ReadOnlyFile.h"
 #include "utils/Exception.h"
 #include "utils/Log.h"
 
@@ -30,8 +33,6 @@ namespace codec {
 
 void
 DefaultVectorsFormat::read(const store::DirectoryPtr& directory_ptr, segment::VectorsPtr& vectors_read) {
-    const std::lock_guard<std::mutex> lock(mutex_);
-
     std::string dir_path = directory_ptr->GetDirPath();
     if (!boost::filesystem::is_directory(dir_path)) {
         std::string err_msg = "Directory: " + dir_path + "does not exist";
@@ -47,54 +48,19 @@ DefaultVectorsFormat::read(const store::DirectoryPtr& directory_ptr, segment::Ve
     for (; it != it_end; ++it) {
         const auto& path = it->path();
         if (path.extension().string() == raw_vector_extension_) {
-            int rv_fd = open(path.c_str(), O_RDONLY, 00664);
-            if (rv_fd == -1) {
-                std::string err_msg = "Failed to open file: " + path.string() + ", error: " + std::strerror(errno);
-                ENGINE_LOG_ERROR << err_msg;
-                throw Exception(SERVER_CANNOT_CREATE_FILE, err_msg);
-            }
-            size_t num_bytes = boost::filesystem::file_size(path);
-            std::vector<uint8_t> vector_list;
-            vector_list.resize(num_bytes);
-            if (::read(rv_fd, vector_list.data(), num_bytes) == -1) {
-                std::string err_msg = "Failed to read from file: " + path.string() + ", error: " + std::strerror(errno);
-                ENGINE_LOG_ERROR << err_msg;
-                throw Exception(SERVER_WRITE_ERROR, err_msg);
-            }
-
-            vectors_read->AddData(vector_list);
-            vectors_read->SetName(path.stem().string());
+            ReadOnlyFile rv_file(path.string());
+            std::vector<uint8_t> vector_list(rv_file.Size());
+            rv_file.ReadAt(vector_list.data(), vector_list.size(), 0);
 
-            if (::close(rv_fd) == -1) {
-                std::string err_msg = "Failed to close file: " + path.string() + ", error: " + std::strerror(errno);
-                ENGINE_LOG_ERROR << err_msg;
-                throw Exception(SERVER_WRITE_ERROR, err_msg);
-            }
+            vectors_read->AddData(std::move(vector_list));
+            vectors_read->SetName(path.stem().string());
         }
         if (path.extension().string() == user_id_extension_) {
-            int uid_fd = open(path.c_str(), O_RDONLY, 00664);
-            if (uid_fd == -1) {
-                std::string err_msg = "Failed to open file: " + path.string() + ", error: " + std::strerror(errno);
-                ENGINE_LOG_ERROR << err_msg;
-                throw Exception(SERVER_CANNOT_CREATE_FILE, err_msg);
-            }
-            auto file_size = boost::filesystem::file_size(path);
-            auto count = file_size / sizeof(segment::doc_id_t);
-            std::vector<segment::doc_id_t> uids;
-            uids.resize(count);
-            if (::read(uid_fd, uids.data(), file_size) == -1) {
-                std::string err_msg = "Failed to read from file: " + path.string() + ", error: " + std::strerror(errno);
-                ENGINE_LOG_ERROR << err_msg;
-                throw Exception(SERVER_WRITE_ERROR, err_msg);
-            }
+            ReadOnlyFile uid_file(path.string());
+            std::vector<segment::doc_id_t> uids(uid_file.Size() / sizeof(segment::doc_id_t));
+            uid_file.ReadAt(uids.data(), uids.size() * sizeof(segment::doc_id_t), 0);
 
             vectors_read->AddUids(uids);
-
-            if (::close(uid_fd) == -1) {
-                std::string err_msg = "Failed to close file: " + path.string() + ", error: " + std::strerror(errno);
-                ENGINE_LOG_ERROR << err_msg;
-                throw Exception(SERVER_WRITE_ERROR, err_msg);
-            }
         }
     }
 }
@@ -179,51 +145,67 @@ DefaultVectorsFormat::write(const store::DirectoryPtr& directory_ptr, const segm
 
 void
 DefaultVectorsFormat::read_uids(const store::DirectoryPtr& directory_ptr, std::vector<segment::doc_id_t>& uids) {
-    const std::lock_guard<std::mutex> lock(mutex_);
-
-    std::string dir_path = directory_ptr->GetDirPath();
-    if (!boost::filesystem::is_directory(dir_path)) {
-        std::string err_msg = "Directory: " + dir_path + "does not exist";
-        ENGINE_LOG_ERROR << err_msg;
-        throw Exception(SERVER_INVALID_ARGUMENT, err_msg);
+    std::string uid_file_path;
+    if (!FindFile(directory_ptr, user_id_extension_, uid_file_path)) {
+        return;
     }
 
-    boost::filesystem::path target_path(dir_path);
-    typedef boost::filesystem::directory_iterator d_it;
-    d_it it_end;
-    d_it it(target_path);
-    //    for (auto& it : boost::filesystem::directory_iterator(dir_path)) {
-    for (; it != it_end; ++it) {
-        const auto& path = it->path();
-        if (path.extension().string() == user_id_extension_) {
-            int uid_fd = open(path.c_str(), O_RDONLY, 00664);
-            if (uid_fd == -1) {
-                std::string err_msg = "Failed to open file: " + path.string() + ", error: " + std::strerror(errno);
-                ENGINE_LOG_ERROR << err_msg;
-                throw Exception(SERVER_CANNOT_CREATE_FILE, err_msg);
-            }
-            auto file_size = boost::filesystem::file_size(path);
-            auto count = file_size / sizeof(segment::doc_id_t);
-            uids.resize(count);
-            if (::read(uid_fd, uids.data(), file_size) == -1) {
-                std::string err_msg = "Failed to read from file: " + path.string() + ", error: " + std::strerror(errno);
-                ENGINE_LOG_ERROR << err_msg;
-                throw Exception(SERVER_WRITE_ERROR, err_msg);
-            }
-            if (::close(uid_fd) == -1) {
-                std::string err_msg = "Failed to close file: " + path.string() + ", error: " + std::strerror(errno);
-                ENGINE_LOG_ERROR << err_msg;
-                throw Exception(SERVER_WRITE_ERROR, err_msg);
-            }
-        }
-    }
+    ReadOnlyFile uid_file(uid_file_path);
+    uids.resize(uid_file.Size() / sizeof(segment::doc_id_t));
+    uid_file.ReadAt(uids.data(), uids.size() * sizeof(segment::doc_id_t), 0);
 }
 
 void
 DefaultVectorsFormat::read_vectors(const store::DirectoryPtr& directory_ptr, off_t offset, size_t num_bytes,
                                    std::vector<uint8_t>& raw_vectors) {
-    const std::lock_guard<std::mutex> lock(mutex_);
+    std::string rv_file_path;
+    if (!FindFile(directory_ptr, raw_vector_extension_, rv_file_path)) {
+        return;
+    }
 
+    // only the requested range is read
+    ReadOnlyFile rv_file(rv_file_path);
+    raw_vectors.resize(num_bytes);
+    rv_file.ReadAt(raw_vectors.data(), num_bytes, offset);
+}
+
+void
+DefaultVectorsFormat::read_vectors_mapped(const store::DirectoryPtr& directory_ptr,
+                                          segment::MappedVectorsPtr& mapped_vectors) {
+    std::string rv_file_path;
+    if (!FindFile(directory_ptr, raw_vector_extension_, rv_file_path)) {
+        std::string err_msg = "No raw vector file in directory: " + directory_ptr->GetDirPath();
+        ENGINE_LOG_ERROR << err_msg;
+        throw Exception(SERVER_FILE_NOT_FOUND, err_msg);
+    }
+
+    int rv_fd = open(rv_file_path.c_str(), O_RDONLY);
+    if (rv_fd == -1) {
+        std::string err_msg = "Failed to open file: " + rv_file_path + ", error: " + std::strerror(errno);
+        ENGINE_LOG_ERROR << err_msg;
+        throw Exception(SERVER_CANNOT_CREATE_FILE, err_msg);
+    }
+
+    size_t num_bytes = boost::filesystem::file_size(rv_file_path);
+    void* data = nullptr;
+    if (num_bytes > 0) {
+        data = mmap(nullptr, num_bytes, PROT_READ, MAP_SHARED, rv_fd, 0);
+        if (data == MAP_FAILED) {
+            std::string err_msg = "Failed to mmap file: " + rv_file_path + ", error: " + std::strerror(errno);
+            ENGINE_LOG_ERROR << err_msg;
+            ::close(rv_fd);
+            throw Exception(SERVER_UNEXPECTED_ERROR, err_msg);
+        }
+        // the vectors are consumed front to back, let the kernel read ahead aggressively
+        madvise(data, num_bytes, MADV_SEQUENTIAL);
+    }
+
+    mapped_vectors = std::make_shared<segment::MappedVectors>(rv_fd, data, num_bytes);
+}
+
+bool
+DefaultVectorsFormat::FindFile(const store::DirectoryPtr& directory_ptr, const std::string& extension,
+                               std::string& file_path) {
     std::string dir_path = directory_ptr->GetDirPath();
     if (!boost::filesystem::is_directory(dir_path)) {
         std::string err_msg = "Directory: " + dir_path + "does not exist";
@@ -231,42 +213,14 @@ DefaultVectorsFormat::read_vectors(const store::DirectoryPtr& directory_ptr, off
         throw Exception(SERVER_INVALID_ARGUMENT, err_msg);
     }
 
-    boost::filesystem::path target_path(dir_path);
-    typedef boost::filesystem::directory_iterator d_it;
-    d_it it_end;
-    d_it it(target_path);
-    //    for (auto& it : boost::filesystem::directory_iterator(dir_path)) {
-    for (; it != it_end; ++it) {
-        const auto& path = it->path();
-        if (path.extension().string() == raw_vector_extension_) {
-            int rv_fd = open(path.c_str(), O_RDONLY, 00664);
-            if (rv_fd == -1) {
-                std::string err_msg = "Failed to open file: " + path.string() + ", error: " + std::strerror(errno);
-                ENGINE_LOG_ERROR << err_msg;
-                throw Exception(SERVER_CANNOT_CREATE_FILE, err_msg);
-            }
-            int off = lseek(rv_fd, offset, SEEK_SET);
-            if (off == -1) {
-                std::string err_msg = "Failed to seek file: " + path.string() + ", error: " + std::strerror(errno);
-                ENGINE_LOG_ERROR << err_msg;
-                throw Exception(SERVER_WRITE_ERROR, err_msg);
-            }
-
-            raw_vectors.resize(num_bytes);
-
-            if (::read(rv_fd, raw_vectors.data(), num_bytes) == -1) {
-                std::string err_msg = "Failed to read from file: " + path.string() + ", error: " + std::strerror(errno);
-                ENGINE_LOG_ERROR << err_msg;
-                throw Exception(SERVER_WRITE_ERROR, err_msg);
-            }
-
-            if (::close(rv_fd) == -1) {
-                std::string err_msg = "Failed to close file: " + path.string() + ", error: " + std::strerror(errno);
-                ENGINE_LOG_ERROR << err_msg;
-                throw Exception(SERVER_WRITE_ERROR, err_msg);
-            }
+    boost::filesystem::directory_iterator it_end;
+    for (boost::filesystem::directory_iterator it(dir_path); it != it_end; ++it) {
+        if (it->path().extension().string() == extension) {
+            file_path = it->path().string();
+            return true;
         }
     }
+    return false;
 }
 
 }  // namespace codec
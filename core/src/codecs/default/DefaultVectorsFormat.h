@@ -44,6 +44,9 @@ class DefaultVectorsFormat : public VectorsFormat {
     read_vectors(const store::DirectoryPtr& directory_ptr, off_t offset, size_t num_bytes,
                  std::vector<uint8_t>& raw_vectors) override;
 
+    void
+    read_vectors_mapped(const store::DirectoryPtr& directory_ptr, segment::MappedVectorsPtr& mapped_vectors) override;
+
     // No copy and move
     DefaultVectorsFormat(const DefaultVectorsFormat&) = delete;
     DefaultVectorsFormat(DefaultVectorsFormat&&) = delete;
@@ -54,7 +57,12 @@ class DefaultVectorsFormat : public VectorsFormat {
     operator=(DefaultVectorsFormat&&) = delete;
 
  private:
-    std::mutex mutex_;
+    // path of the file with the extension in the directory, false if there is none
+    bool
+    FindFile(const store::DirectoryPtr& directory_ptr, const std::string& extension, std::string& file_path);
+
+ private:
+    std::mutex mutex_;  // reads take no lock
 
     const std::string raw_vector_extension_ = ".rv";
     const std::string user_id_extension_ = ".uid";
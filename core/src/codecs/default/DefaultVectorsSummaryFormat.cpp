@@ -0,0 +1,132 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "codecs/default/DefaultVectorsSummaryFormat.h"
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <boost/filesystem.hpp>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "codecs/default/ReadOnlyFile.h"
+#include "utils/Exception.h"
+#include "utils/Log.h"
+
+namespace milvus {
+namespace codec {
+
+namespace {
+
+// header, then clusters * dimension floats of centroids, then clusters floats of radiuses
+constexpr uint32_t VECTORS_SUMMARY_MAGIC = 0x5E65C0DEU;
+constexpr uint32_t VECTORS_SUMMARY_VERSION = 1;
+
+struct VectorsSummaryHeader {
+    uint32_t magic;
+    uint32_t version;
+    int64_t dimension;
+    int64_t clusters;
+};
+
+void
+ThrowIOError(const std::string& action, const std::string& file_path) {
+    std::string err_msg = "Failed to " + action + " vectors summary file: " + file_path + ". " + std::strerror(errno);
+    ENGINE_LOG_ERROR << err_msg;
+    throw Exception(SERVER_UNEXPECTED_ERROR, err_msg);
+}
+
+}  // namespace
+
+void
+DefaultVectorsSummaryFormat::read(const store::DirectoryPtr& directory_ptr,
+                                  segment::VectorsSummaryPtr& vectors_summary_ptr) {
+    std::string dir_path = directory_ptr->GetDirPath();
+    const std::string file_path = dir_path + "/" + vectors_summary_filename_;
+
+    // summaries are only written while segment pruning is enabled
+    if (!boost::filesystem::exists(file_path)) {
+        vectors_summary_ptr = std::make_shared<segment::VectorsSummary>();
+        return;
+    }
+
+    ReadOnlyFile file(file_path);
+    VectorsSummaryHeader header;
+    memset(&header, 0, sizeof(header));
+    if (file.Size() >= sizeof(header)) {
+        file.ReadAt(&header, sizeof(header), 0);
+    }
+
+    if (header.magic != VECTORS_SUMMARY_MAGIC || header.version != VECTORS_SUMMARY_VERSION ||
+        header.dimension <= 0 || header.clusters <= 0 ||
+        sizeof(header) + header.clusters * (header.dimension + 1) * sizeof(float) != file.Size()) {
+        std::string err_msg = "Vectors summary file is damaged: " + file_path;
+        ENGINE_LOG_ERROR << err_msg;
+        throw Exception(SERVER_UNEXPECTED_ERROR, err_msg);
+    }
+
+    std::vector<float> centroids(header.clusters * header.dimension);
+    std::vector<float> radiuses(header.clusters);
+    file.ReadAt(centroids.data(), centroids.size() * sizeof(float), sizeof(header));
+    file.ReadAt(radiuses.data(), radiuses.size() * sizeof(float), sizeof(header) + centroids.size() * sizeof(float));
+
+    vectors_summary_ptr =
+        std::make_shared<segment::VectorsSummary>(header.dimension, std::move(centroids), std::move(radiuses));
+}
+
+void
+DefaultVectorsSummaryFormat::write(const store::DirectoryPtr& directory_ptr,
+                                   const segment::VectorsSummaryPtr& vectors_summary_ptr) {
+    std::string dir_path = directory_ptr->GetDirPath();
+    const std::string file_path = dir_path + "/" + vectors_summary_filename_;
+
+    // searches may read the summary of a segment being merged again, they see the old or the new file
+    const std::string temp_path = file_path + ".temp";
+    auto& centroids = vectors_summary_ptr->GetCentroids();
+    auto& radiuses = vectors_summary_ptr->GetRadiuses();
+    VectorsSummaryHeader header{VECTORS_SUMMARY_MAGIC, VECTORS_SUMMARY_VERSION, vectors_summary_ptr->GetDimension(),
+                                static_cast<int64_t>(radiuses.size())};
+
+    int fd = open(temp_path.c_str(), O_WRONLY | O_TRUNC | O_CREAT, 00664);
+    if (fd == -1) {
+        ThrowIOError("open", temp_path);
+    }
+
+    auto centroids_bytes = static_cast<ssize_t>(centroids.size() * sizeof(float));
+    auto radiuses_bytes = static_cast<ssize_t>(radiuses.size() * sizeof(float));
+    if (::write(fd, &header, sizeof(header)) != sizeof(header) ||
+        ::write(fd, centroids.data(), centroids_bytes) != centroids_bytes ||
+        ::write(fd, radiuses.data(), radiuses_bytes) != radiuses_bytes) {
+        ::close(fd);
+        ThrowIOError("write", temp_path);
+    }
+
+    if (::close(fd) == -1) {
+        ThrowIOError("close", temp_path);
+    }
+
+    if (::rename(temp_path.c_str(), file_path.c_str()) == -1) {
+        ThrowIOError("rename", temp_path);
+    }
+}
+
+}  // namespace codec
+}  // namespace milvus
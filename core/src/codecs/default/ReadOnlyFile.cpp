@@ -0,0 +1,83 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "codecs/default/ReadOnlyFile.h"
+
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstring>
+
+#include "utils/Exception.h"
+#include "utils/Log.h"
+
+namespace milvus {
+namespace codec {
+
+ReadOnlyFile::ReadOnlyFile(const std::string& file_path) : file_path_(file_path) {
+    fd_ = open(file_path_.c_str(), O_RDONLY);
+    if (fd_ == -1) {
+        std::string err_msg = "Failed to open file: " + file_path_ + ", error: " + std::strerror(errno);
+        ENGINE_LOG_ERROR << err_msg;
+        throw Exception(SERVER_CANNOT_CREATE_FILE, err_msg);
+    }
+
+    struct stat file_stat;
+    if (fstat(fd_, &file_stat) == -1) {
+        std::string err_msg = "Failed to stat file: " + file_path_ + ", error: " + std::strerror(errno);
+        ENGINE_LOG_ERROR << err_msg;
+        ::close(fd_);
+        throw Exception(SERVER_UNEXPECTED_ERROR, err_msg);
+    }
+    size_ = file_stat.st_size;
+}
+
+ReadOnlyFile::~ReadOnlyFile() {
+    if (::close(fd_) == -1) {
+        ENGINE_LOG_WARNING << "Failed to close file: " << file_path_ << ", error: " << std::strerror(errno);
+    }
+}
+
+size_t
+ReadOnlyFile::Size() const {
+    return size_;
+}
+
+void
+ReadOnlyFile::ReadAt(void* data, size_t num_bytes, off_t offset) const {
+    auto buffer = static_cast<char*>(data);
+    while (num_bytes > 0) {
+        ssize_t n = ::pread(fd_, buffer, num_bytes, offset);
+        if (n == -1 && errno == EINTR) {
+            continue;
+        }
+        if (n <= 0) {
+            std::string reason = (n == 0) ? "unexpected end of file" : std::strerror(errno);
+            std::string err_msg = "Failed to read from file: " + file_path_ + ", error: " + reason;
+            ENGINE_LOG_ERROR << err_msg;
+            throw Exception(SERVER_WRITE_ERROR, err_msg);
+        }
+        buffer += n;
+        num_bytes -= n;
+        offset += n;
+    }
+}
+
+}  // namespace codec
+}  // namespace milvus
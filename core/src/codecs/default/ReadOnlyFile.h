@@ -0,0 +1,58 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <sys/types.h>
+
+#include <string>
+
+namespace milvus {
+namespace codec {
+
+// A file opened for reading. Reads use pread and don't move a shared file position, so any number of threads can
+// read the same file at once, and no lock is needed around them. Failures throw milvus::Exception.
+class ReadOnlyFile {
+ public:
+    explicit ReadOnlyFile(const std::string& file_path);
+
+    ~ReadOnlyFile();
+
+    size_t
+    Size() const;
+
+    // reads exactly num_bytes at offset
+    void
+    ReadAt(void* data, size_t num_bytes, off_t offset) const;
+
+    // No copy and move
+    ReadOnlyFile(const ReadOnlyFile&) = delete;
+    ReadOnlyFile(ReadOnlyFile&&) = delete;
+
+    ReadOnlyFile&
+    operator=(const ReadOnlyFile&) = delete;
+    ReadOnlyFile&
+    operator=(ReadOnlyFile&&) = delete;
+
+ private:
+    std::string file_path_;
+    int fd_ = -1;
+    size_t size_ = 0;
+};
+
+}  // namespace codec
+}  // namespace milvus
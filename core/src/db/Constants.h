@@ -23,6 +23,12 @@ constexpr uint64_t T = K * G;
 
 constexpr uint64_t MAX_TABLE_FILE_MEM = 128 * M;
 
+// max number of tables, and of segments within one table, written at the same time by a flush
+constexpr uint64_t MAX_FLUSH_CONCURRENCY = 4;
+
+// max number of files of a table loaded at the same time by a preload
+constexpr uint64_t MAX_PRELOAD_CONCURRENCY = 8;
+
 constexpr int FLOAT_TYPE_SIZE = sizeof(float);
 
 static constexpr uint64_t ONE_KB = K;
@@ -11,6 +11,7 @@
 
 #pragma once
 
+#include <map>
 #include <memory>
 #include <string>
 #include <vector>
@@ -67,6 +68,9 @@ class DB {
     virtual Status
     PreloadTable(const std::string& table_id) = 0;
 
+    virtual Status
+    GetPreloadProgress(std::map<std::string, PreloadProgress>& progress) = 0;
+
     virtual Status
     UpdateTableFlag(const std::string& table_id, int64_t flag) = 0;
 
@@ -104,6 +108,10 @@ class DB {
     virtual Status
     GetVectorByID(const std::string& table_id, const IDNumber& vector_id, VectorsData& vector) = 0;
 
+    // one VectorsData per requested id, vector_count_ is 0 for ids that are not found
+    virtual Status
+    GetVectorsByID(const std::string& table_id, const IDNumbers& id_array, std::vector<VectorsData>& vectors) = 0;
+
     virtual Status
     GetVectorIDs(const std::string& table_id, const std::string& segment_id, IDNumbers& vector_ids) = 0;
 
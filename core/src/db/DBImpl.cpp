@@ -18,18 +18,22 @@
 #include <boost/filesystem.hpp>
 #include <chrono>
 #include <cstring>
+#include <fstream>
 #include <functional>
 #include <iostream>
 #include <limits>
 #include <set>
 #include <thread>
+#include <unordered_map>
 #include <utility>
 
 #include "Utils.h"
 #include "cache/CpuCacheMgr.h"
 #include "cache/GpuCacheMgr.h"
+#include "db/Constants.h"
 #include "db/IDGenerator.h"
 #include "engine/EngineFactory.h"
+#include "engine/IVFCentroidsMgr.h"
 #include "insert/MemMenagerFactory.h"
 #include "meta/MetaConsts.h"
 #include "meta/MetaFactory.h"
@@ -39,6 +43,7 @@
 #include "scheduler/job/BuildIndexJob.h"
 #include "scheduler/job/DeleteJob.h"
 #include "scheduler/job/SearchJob.h"
+#include "scheduler/task/SearchTask.h"
 #include "segment/SegmentReader.h"
 #include "segment/SegmentWriter.h"
 #include "utils/Exception.h"
@@ -47,6 +52,7 @@
 #include "utils/TimeRecorder.h"
 #include "utils/ValidationUtil.h"
 #include "wal/WalDefinations.h"
+#include "wrapper/VecIndex.h"
 
 namespace milvus {
 namespace engine {
@@ -56,13 +62,40 @@ namespace {
 constexpr uint64_t METRIC_ACTION_INTERVAL = 1;
 constexpr uint64_t COMPACT_ACTION_INTERVAL = 1;
 constexpr uint64_t INDEX_ACTION_INTERVAL = 1;
+constexpr uint64_t WAL_RECOVERY_BATCH_SIZE = 64 * 1024 * 1024;  // bytes of records replayed per batch
+
+// the preload progress of the cache snapshot is reported under a name no table can have
+const char* CACHE_SNAPSHOT_PRELOAD_KEY = "*";
 
 static const Status SHUTDOWN_ERROR = Status(DB_ERROR, "Milvus server is shutdown!");
 
+// merge a result of up to k items per query into the target, the merge source is expected to be laid out as nq * k
+void
+MergeResult(uint64_t nq, uint64_t k, bool ascending, const ResultIds& ids, const ResultDistances& distances,
+            ResultIds& result_ids, ResultDistances& result_distances) {
+    if (ids.empty()) {
+        return;
+    }
+
+    uint64_t src_k = ids.size() / nq;
+    ResultIds src_ids(nq * k, -1);
+    ResultDistances src_distances(nq * k, 0.0);
+    for (uint64_t i = 0; i < nq; ++i) {
+        std::copy_n(ids.begin() + i * src_k, src_k, src_ids.begin() + i * k);
+        std::copy_n(distances.begin() + i * src_k, src_k, src_distances.begin() + i * k);
+    }
+    scheduler::XSearchTask::MergeTopkToResultSet(src_ids, src_distances, src_k, nq, k, ascending, result_ids,
+                                                 result_distances);
+}
+
 }  // namespace
 
 DBImpl::DBImpl(const DBOptions& options)
-    : options_(options), initialized_(false), merge_thread_pool_(1, 1), index_thread_pool_(1, 1) {
+    : options_(options),
+      initialized_(false),
+      query_combiner_(options.search_combine_max_wait_, options.search_combine_max_nq_),
+      merge_thread_pool_(1, 1),
+      index_thread_pool_(1, 1) {
     meta_ptr_ = MetaFactory::Build(options.meta_, options.mode_);
     mem_mgr_ = MemManagerFactory::Build(meta_ptr_, options_);
 
@@ -72,6 +105,14 @@ DBImpl::DBImpl(const DBOptions& options)
         // 2 buffers in the WAL
         mxlog_config.buffer_size = options_.buffer_size_ / 2;
         mxlog_config.mxlog_path = options_.mxlog_path_;
+        if (options_.wal_sync_mode_ == "batch") {
+            mxlog_config.sync_mode = wal::MXLogSyncMode::Batch;
+        } else if (options_.wal_sync_mode_ == "interval") {
+            mxlog_config.sync_mode = wal::MXLogSyncMode::Interval;
+        } else {
+            mxlog_config.sync_mode = wal::MXLogSyncMode::None;
+        }
+        mxlog_config.sync_interval = options_.wal_sync_interval_;
         wal_mgr_ = std::make_shared<wal::WalManager>(mxlog_config);
     }
 
@@ -105,18 +146,7 @@ DBImpl::Start() {
         }
 
         // recovery
-        while (1) {
-            wal::MXLogRecord record;
-            auto error_code = wal_mgr_->GetNextRecovery(record);
-            if (error_code != WAL_SUCCESS) {
-                throw Exception(error_code, "Wal recovery error!");
-            }
-            if (record.type == wal::MXLogType::None) {
-                break;
-            }
-
-            ExecWalRecord(record);
-        }
+        RecoverWal();
 
         // for distribute version, some nodes are read only
         if (options_.mode_ != DBOptions::MODE::CLUSTER_READONLY) {
@@ -132,6 +162,10 @@ DBImpl::Start() {
         }
     }
 
+    if (options_.cache_snapshot_interval_ > 0) {
+        bg_cache_snapshot_thread_ = std::thread(&DBImpl::BackgroundCacheSnapshotTask, this);
+    }
+
     return Status::OK();
 }
 
@@ -163,6 +197,11 @@ DBImpl::Stop() {
         meta_ptr_->CleanUpShadowFiles();
     }
 
+    if (bg_cache_snapshot_thread_.joinable()) {
+        cache_snapshot_swn_.Notify();
+        bg_cache_snapshot_thread_.join();
+    }
+
     // ENGINE_LOG_TRACE << "DB service stop";
     return Status::OK();
 }
@@ -348,52 +387,19 @@ DBImpl::PreloadTable(const std::string& table_id) {
         status = GetFilesToSearch(schema.table_id_, ids, files_array);
     }
 
-    int64_t size = 0;
-    int64_t cache_total = cache::CpuCacheMgr::GetInstance()->CacheCapacity();
-    int64_t cache_usage = cache::CpuCacheMgr::GetInstance()->CacheUsage();
-    int64_t available_size = cache_total - cache_usage;
-
-    // step 3: load file one by one
-    ENGINE_LOG_DEBUG << "Begin pre-load table:" + table_id + ", totally " << files_array.size()
-                     << " files need to be pre-loaded";
-    TimeRecorderAuto rc("Pre-load table:" + table_id);
-    for (auto& file : files_array) {
-        EngineType engine_type;
-        if (file.file_type_ == meta::TableFileSchema::FILE_TYPE::RAW ||
-            file.file_type_ == meta::TableFileSchema::FILE_TYPE::TO_INDEX ||
-            file.file_type_ == meta::TableFileSchema::FILE_TYPE::BACKUP) {
-            engine_type = server::ValidationUtil::IsBinaryMetricType(file.metric_type_) ? EngineType::FAISS_BIN_IDMAP
-                                                                                        : EngineType::FAISS_IDMAP;
-        } else {
-            engine_type = (EngineType)file.engine_type_;
-        }
-        ExecutionEnginePtr engine = EngineFactory::Build(file.dimension_, file.location_, engine_type,
-                                                         (MetricType)file.metric_type_, file.nlist_);
-        fiu_do_on("DBImpl.PreloadTable.null_engine", engine = nullptr);
-        if (engine == nullptr) {
-            ENGINE_LOG_ERROR << "Invalid engine type";
-            return Status(DB_ERROR, "Invalid engine type");
-        }
+    // step 3: load the most recently updated files first
+    std::sort(files_array.begin(), files_array.end(),
+              [](const meta::TableFileSchema& l, const meta::TableFileSchema& r) {
+                  return l.updated_time_ > r.updated_time_;
+              });
 
-        size += engine->PhysicalSize();
-        fiu_do_on("DBImpl.PreloadTable.exceed_cache", size = available_size + 1);
-        if (size > available_size) {
-            ENGINE_LOG_DEBUG << "Pre-load canceled since cache almost full";
-            return Status(SERVER_CACHE_FULL, "Cache is full");
-        } else {
-            try {
-                fiu_do_on("DBImpl.PreloadTable.engine_throw_exception", throw std::exception());
-                std::string msg = "Pre-loaded file: " + file.file_id_ + " size: " + std::to_string(file.file_size_);
-                TimeRecorderAuto rc_1(msg);
-                engine->Load(true);
-            } catch (std::exception& ex) {
-                std::string msg = "Pre-load table encounter exception: " + std::string(ex.what());
-                ENGINE_LOG_ERROR << msg;
-                return Status(DB_ERROR, msg);
-            }
-        }
-    }
+    return PreloadFiles(table_id, files_array);
+}
 
+Status
+DBImpl::GetPreloadProgress(std::map<std::string, PreloadProgress>& progress) {
+    std::lock_guard<std::mutex> lock(preload_mutex_);
+    progress = preload_progress_;
     return Status::OK();
 }
 
@@ -740,6 +746,8 @@ DBImpl::CompactFile(const std::string& table_id, const milvus::engine::meta::Tab
         return status;
     }
 
+    WriteVectorsSummary(segment_writer_ptr, compacted_file);
+
     // Drop index again, in case some files were in the index building process during merging
     // TODO: might be too frequent?
     DropIndex(table_id);
@@ -778,10 +786,23 @@ DBImpl::CompactFile(const std::string& table_id, const milvus::engine::meta::Tab
 
 Status
 DBImpl::GetVectorByID(const std::string& table_id, const IDNumber& vector_id, VectorsData& vector) {
+    std::vector<VectorsData> vectors;
+    auto status = GetVectorsByID(table_id, {vector_id}, vectors);
+    if (status.ok() && !vectors.empty()) {
+        vector = std::move(vectors[0]);
+    }
+    return status;
+}
+
+Status
+DBImpl::GetVectorsByID(const std::string& table_id, const IDNumbers& id_array, std::vector<VectorsData>& vectors) {
     if (!initialized_.load(std::memory_order_acquire)) {
         return SHUTDOWN_ERROR;
     }
 
+    vectors.clear();
+    vectors.resize(id_array.size());
+
     bool has_table;
     auto status = HasTable(table_id, has_table);
     if (!has_table) {
@@ -799,7 +820,7 @@ DBImpl::GetVectorByID(const std::string& table_id, const IDNumber& vector_id, Ve
     meta::TableFilesSchema table_files;
     status = meta_ptr_->FilesByType(table_id, file_types, files_to_query);
     if (!status.ok()) {
-        std::string err_msg = "Failed to get files for GetVectorByID: " + status.message();
+        std::string err_msg = "Failed to get files for GetVectorsByID: " + status.message();
         ENGINE_LOG_ERROR << err_msg;
         return status;
     }
@@ -810,7 +831,7 @@ DBImpl::GetVectorByID(const std::string& table_id, const IDNumber& vector_id, Ve
         meta::TableFilesSchema files;
         status = meta_ptr_->FilesByType(schema.table_id_, file_types, files);
         if (!status.ok()) {
-            std::string err_msg = "Failed to get files for GetVectorByID: " + status.message();
+            std::string err_msg = "Failed to get files for GetVectorsByID: " + status.message();
             ENGINE_LOG_ERROR << err_msg;
             return status;
         }
@@ -826,7 +847,7 @@ DBImpl::GetVectorByID(const std::string& table_id, const IDNumber& vector_id, Ve
     cache::CpuCacheMgr::GetInstance()->PrintInfo();
     OngoingFileChecker::GetInstance().MarkOngoingFiles(files_to_query);
 
-    status = GetVectorByIdHelper(table_id, vector_id, vector, files_to_query);
+    status = GetVectorsByIdHelper(table_id, id_array, vectors, files_to_query);
 
     OngoingFileChecker::GetInstance().UnmarkOngoingFiles(files_to_query);
     cache::CpuCacheMgr::GetInstance()->PrintInfo();
@@ -891,80 +912,97 @@ DBImpl::GetVectorIDs(const std::string& table_id, const std::string& segment_id,
     }
 
     // step 4: construct id array
-    // avoid duplicate offset and erase from max offset to min offset
+    // deleted offsets are sorted and unique, skip them in one pass
     auto& deleted_offset = deleted_docs_ptr->GetDeletedDocs();
-    std::set<segment::offset_t, std::greater<segment::offset_t>> ordered_offset;
-    for (segment::offset_t offset : deleted_offset) {
-        ordered_offset.insert(offset);
-    }
-    for (segment::offset_t offset : ordered_offset) {
-        uids.erase(uids.begin() + offset);
+    auto skip = deleted_offset.begin();
+    size_t count = 0;
+    for (size_t i = 0; i < uids.size(); ++i) {
+        if (skip != deleted_offset.end() && *skip == static_cast<segment::offset_t>(i)) {
+            ++skip;
+            continue;
+        }
+        uids[count++] = uids[i];
     }
+    uids.resize(count);
     vector_ids.swap(uids);
 
     return status;
 }
 
 Status
-DBImpl::GetVectorByIdHelper(const std::string& table_id, IDNumber vector_id, VectorsData& vector,
-                            const meta::TableFilesSchema& files) {
-    ENGINE_LOG_DEBUG << "Getting vector by id in " << files.size() << " files";
+DBImpl::GetVectorsByIdHelper(const std::string& table_id, const IDNumbers& id_array, std::vector<VectorsData>& vectors,
+                             const meta::TableFilesSchema& files) {
+    ENGINE_LOG_DEBUG << "Getting " << id_array.size() << " vectors by id in " << files.size() << " files";
 
+    size_t remaining = id_array.size();
     for (auto& file : files) {
-        // Load bloom filter
+        if (remaining == 0) {
+            break;
+        }
+
+        // Load bloom filter and check which of the ids not found yet may be present in this segment
         std::string segment_dir;
         engine::utils::GetParentPath(file.location_, segment_dir);
         segment::SegmentReader segment_reader(segment_dir);
         segment::IdBloomFilterPtr id_bloom_filter_ptr;
         segment_reader.LoadBloomFilter(id_bloom_filter_ptr);
 
-        // Check if the id is present in bloom filter.
-        if (id_bloom_filter_ptr->Check(vector_id)) {
-            // Load uids and check if the id is indeed present. If yes, find its offset.
-            std::vector<int64_t> offsets;
-            std::vector<segment::doc_id_t> uids;
-            auto status = segment_reader.LoadUids(uids);
-            if (!status.ok()) {
-                return status;
+        std::vector<uint8_t> maybe_present;
+        id_bloom_filter_ptr->Check(id_array.data(), id_array.size(), maybe_present);
+        std::vector<size_t> candidates;
+        for (size_t i = 0; i < id_array.size(); ++i) {
+            if (vectors[i].vector_count_ == 0 && maybe_present[i]) {
+                candidates.push_back(i);
             }
+        }
+        if (candidates.empty()) {
+            continue;
+        }
 
-            auto found = std::find(uids.begin(), uids.end(), vector_id);
-            if (found != uids.end()) {
-                auto offset = std::distance(uids.begin(), found);
+        // Find the offsets of the ids among live docs with the uid index of the segment, built once for all the ids
+        // and kept in the segment cache. A cached index may carry deletes in its blacklist not written to disk yet.
+        segment::IdIndexPtr id_index_ptr;
+        auto status = segment_reader.LoadIdIndex(id_index_ptr);
+        if (!status.ok()) {
+            return status;
+        }
 
-                // Check whether the id has been deleted
-                segment::DeletedDocsPtr deleted_docs_ptr;
-                status = segment_reader.LoadDeletedDocs(deleted_docs_ptr);
-                if (!status.ok()) {
-                    return status;
-                }
-                auto& deleted_docs = deleted_docs_ptr->GetDeletedDocs();
-
-                auto deleted = std::find(deleted_docs.begin(), deleted_docs.end(), offset);
-                if (deleted == deleted_docs.end()) {
-                    // Load raw vector
-                    bool is_binary = server::ValidationUtil::IsBinaryMetricType(file.metric_type_);
-                    size_t single_vector_bytes = is_binary ? file.dimension_ / 8 : file.dimension_ * sizeof(float);
-                    std::vector<uint8_t> raw_vector;
-                    status = segment_reader.LoadVectors(offset * single_vector_bytes, single_vector_bytes, raw_vector);
-                    if (!status.ok()) {
-                        return status;
-                    }
+        faiss::ConcurrentBitsetPtr blacklist = nullptr;
+        auto index = std::static_pointer_cast<VecIndex>(cache::CpuCacheMgr::GetInstance()->GetIndex(file.location_));
+        if (index != nullptr) {
+            index->GetBlacklist(blacklist);
+        }
 
-                    vector.vector_count_ = 1;
-                    if (is_binary) {
-                        vector.binary_data_ = std::move(raw_vector);
-                    } else {
-                        std::vector<float> float_vector;
-                        float_vector.resize(file.dimension_);
-                        memcpy(float_vector.data(), raw_vector.data(), single_vector_bytes);
-                        vector.float_data_ = std::move(float_vector);
-                    }
-                    return Status::OK();
-                }
+        std::vector<std::pair<size_t, segment::offset_t>> found;
+        for (auto i : candidates) {
+            segment::offset_t offset;
+            if (id_index_ptr->Get(id_array[i], offset) && (blacklist == nullptr || !blacklist->test(offset))) {
+                found.emplace_back(i, offset);
             }
-        } else {
-            continue;
+        }
+
+        // Load raw vectors
+        bool is_binary = server::ValidationUtil::IsBinaryMetricType(file.metric_type_);
+        size_t single_vector_bytes = is_binary ? file.dimension_ / 8 : file.dimension_ * sizeof(float);
+        for (auto& pair : found) {
+            std::vector<uint8_t> raw_vector;
+            auto status =
+                segment_reader.LoadVectors(pair.second * single_vector_bytes, single_vector_bytes, raw_vector);
+            if (!status.ok()) {
+                return status;
+            }
+
+            VectorsData& vector = vectors[pair.first];
+            vector.vector_count_ = 1;
+            if (is_binary) {
+                vector.binary_data_ = std::move(raw_vector);
+            } else {
+                std::vector<float> float_vector;
+                float_vector.resize(file.dimension_);
+                memcpy(float_vector.data(), raw_vector.data(), single_vector_bytes);
+                vector.float_data_ = std::move(float_vector);
+            }
+            --remaining;
         }
     }
 
@@ -1053,51 +1091,110 @@ Status
 DBImpl::Query(const std::shared_ptr<server::Context>& context, const std::string& table_id,
               const std::vector<std::string>& partition_tags, uint64_t k, uint64_t nprobe, const VectorsData& vectors,
               ResultIds& result_ids, ResultDistances& result_distances) {
-    auto query_ctx = context->Child("Query");
-
     if (!initialized_.load(std::memory_order_acquire)) {
         return SHUTDOWN_ERROR;
     }
 
-    Status status;
-    std::vector<size_t> ids;
-    meta::TableFilesSchema files_array;
+    // query by id is resolved per request, so only queries with raw vectors can be combined
+    if (!vectors.id_array_.empty()) {
+        return QueryHelper(context, table_id, partition_tags, k, nprobe, vectors, result_ids, result_distances);
+    }
+
+    auto query_func = [&](const VectorsData& query_vectors, ResultIds& query_ids, ResultDistances& query_distances) {
+        return QueryHelper(context, table_id, partition_tags, k, nprobe, query_vectors, query_ids, query_distances);
+    };
+    return query_combiner_.Query(QueryCombiner::CombineKey(table_id, partition_tags, k, nprobe, vectors), vectors,
+                                 query_func, result_ids, result_distances);
+}
+
+Status
+DBImpl::QueryHelper(const std::shared_ptr<server::Context>& context, const std::string& table_id,
+                    const std::vector<std::string>& partition_tags, uint64_t k, uint64_t nprobe,
+                    const VectorsData& vectors, ResultIds& result_ids, ResultDistances& result_distances) {
+    auto query_ctx = context->Child("Query");
 
+    Status status;
+    std::vector<std::string> table_ids;
     if (partition_tags.empty()) {
         // no partition tag specified, means search in whole table
-        // get all table files from parent table
-        status = GetFilesToSearch(table_id, ids, files_array);
-        if (!status.ok()) {
-            return status;
-        }
+        table_ids.push_back(table_id);
 
         std::vector<meta::TableSchema> partition_array;
         status = meta_ptr_->ShowPartitions(table_id, partition_array);
         for (auto& schema : partition_array) {
-            status = GetFilesToSearch(schema.table_id_, ids, files_array);
-        }
-
-        if (files_array.empty()) {
-            return Status::OK();
+            table_ids.push_back(schema.table_id_);
         }
     } else {
-        // get files from specified partitions
+        // search in specified partitions
         std::set<std::string> partition_name_array;
         GetPartitionsByTags(table_id, partition_tags, partition_name_array);
+        table_ids.assign(partition_name_array.begin(), partition_name_array.end());
+    }
 
-        for (auto& partition_name : partition_name_array) {
-            status = GetFilesToSearch(partition_name, ids, files_array);
+    // search unflushed vectors first, a table file leaves the insert buffer only after it is visible in meta,
+    // so the segments found here can be skipped on disk without losing anything
+    meta::TableSchema table_schema;
+    table_schema.table_id_ = table_id;
+    status = meta_ptr_->DescribeTable(table_schema);
+    if (!status.ok()) {
+        return status;
+    }
+    bool ascending = (table_schema.metric_type_ != static_cast<int32_t>(MetricType::IP));
+
+    ResultIds mem_result_ids;
+    ResultDistances mem_result_distances;
+    std::set<std::string> mem_segment_ids;
+    if (vectors.id_array_.empty()) {
+        status = mem_mgr_->Search(table_ids, k, vectors, ascending, mem_result_ids, mem_result_distances,
+                                  mem_segment_ids);
+        if (!status.ok()) {
+            return status;
         }
+    }
 
-        if (files_array.empty()) {
-            return Status::OK();
+    std::vector<size_t> ids;
+    meta::TableFilesSchema files_array;
+    for (auto& id : table_ids) {
+        status = GetFilesToSearch(id, ids, files_array);
+        if (!status.ok() && id == table_id) {
+            return status;
         }
     }
 
+    if (!mem_segment_ids.empty()) {
+        auto is_searched = [&](const meta::TableFileSchema& file) {
+            return mem_segment_ids.find(file.segment_id_) != mem_segment_ids.end();
+        };
+        files_array.erase(std::remove_if(files_array.begin(), files_array.end(), is_searched), files_array.end());
+    }
+
+    if (files_array.empty()) {
+        result_ids.swap(mem_result_ids);
+        result_distances.swap(mem_result_distances);
+        return Status::OK();
+    }
+
+    // segment summaries bound float distances only
+    bool prunable = options_.segment_pruning_factor_ > 0 && vectors.vector_count_ > 0 &&
+                    !vectors.float_data_.empty() &&
+                    (table_schema.metric_type_ == static_cast<int32_t>(MetricType::L2) ||
+                     table_schema.metric_type_ == static_cast<int32_t>(MetricType::IP));
+
     cache::CpuCacheMgr::GetInstance()->PrintInfo();  // print cache info before query
-    status = QueryAsync(query_ctx, table_id, files_array, k, nprobe, vectors, result_ids, result_distances);
+    if (prunable) {
+        status = QueryAsyncPruned(query_ctx, table_schema, files_array, k, nprobe, vectors, result_ids,
+                                  result_distances);
+    } else {
+        status = QueryAsync(query_ctx, table_id, files_array, k, nprobe, vectors, result_ids, result_distances);
+    }
     cache::CpuCacheMgr::GetInstance()->PrintInfo();  // print cache info after query
 
+    if (status.ok()) {
+        // merge results of unflushed vectors
+        MergeResult(vectors.vector_count_, k, ascending, mem_result_ids, mem_result_distances, result_ids,
+                    result_distances);
+    }
+
     query_ctx->GetTraceContext()->GetSpan()->Finish();
 
     return status;
@@ -1193,6 +1290,115 @@ DBImpl::QueryAsync(const std::shared_ptr<server::Context>& context, const std::s
     return Status::OK();
 }
 
+Status
+DBImpl::QueryAsyncPruned(const std::shared_ptr<server::Context>& context, const meta::TableSchema& table_schema,
+                         const meta::TableFilesSchema& files, uint64_t k, uint64_t nprobe, const VectorsData& vectors,
+                         ResultIds& result_ids, ResultDistances& result_distances) {
+    uint64_t nq = vectors.vector_count_;
+    int64_t dimension = table_schema.dimension_;
+    bool inner_product = (table_schema.metric_type_ == static_cast<int32_t>(MetricType::IP));
+    auto beats = [&](float bound, float distance) { return inner_product ? bound > distance : bound < distance; };
+
+    // bounds[i * nq + j] is the best distance a vector of files[i] may have to query j
+    std::vector<float> bounds(files.size() * nq);
+    std::vector<bool> summarized(files.size(), false);
+    for (size_t i = 0; i < files.size(); ++i) {
+        std::string segment_dir;
+        utils::GetParentPath(files[i].location_, segment_dir);
+        segment::SegmentReader segment_reader(segment_dir);
+        segment::VectorsSummaryPtr summary;
+        auto status = segment_reader.LoadVectorsSummary(summary);
+        if (!status.ok() || summary->Empty() || summary->GetDimension() != dimension) {
+            continue;
+        }
+
+        summarized[i] = true;
+        for (uint64_t j = 0; j < nq; ++j) {
+            const float* query = vectors.float_data_.data() + j * dimension;
+            bounds[i * nq + j] = summary->BestDistance(query, inner_product, options_.segment_pruning_factor_);
+        }
+    }
+
+    // first round: the segments without a summary, and the most promising segment of each query
+    std::vector<bool> searched(summarized.size());
+    for (size_t i = 0; i < files.size(); ++i) {
+        searched[i] = !summarized[i];
+    }
+    for (uint64_t j = 0; j < nq; ++j) {
+        int64_t best = -1;
+        for (size_t i = 0; i < files.size(); ++i) {
+            if (summarized[i] && (best < 0 || beats(bounds[i * nq + j], bounds[best * nq + j]))) {
+                best = i;
+            }
+        }
+        if (best >= 0) {
+            searched[best] = true;
+        }
+    }
+
+    meta::TableFilesSchema first_files;
+    for (size_t i = 0; i < files.size(); ++i) {
+        if (searched[i]) {
+            first_files.push_back(files[i]);
+        }
+    }
+
+    auto status = QueryAsync(context, table_schema.table_id_, first_files, k, nprobe, vectors, result_ids,
+                             result_distances);
+    if (!status.ok()) {
+        return status;
+    }
+
+    // second round: the other segments which may hold a better result than the k-th found so far, for any query.
+    // A query with less than k results can't skip anything
+    uint64_t result_k = result_ids.size() / nq;
+    meta::TableFilesSchema second_files;
+    for (size_t i = 0; i < files.size(); ++i) {
+        if (searched[i]) {
+            continue;
+        }
+        for (uint64_t j = 0; j < nq; ++j) {
+            uint64_t last = j * result_k + k - 1;
+            if (result_k < k || result_ids[last] == -1 || beats(bounds[i * nq + j], result_distances[last])) {
+                second_files.push_back(files[i]);
+                break;
+            }
+        }
+    }
+
+    ENGINE_LOG_DEBUG << "Segment pruning skipped " << files.size() - first_files.size() - second_files.size()
+                     << " of " << files.size() << " files of table " << table_schema.table_id_;
+    if (second_files.empty()) {
+        return Status::OK();
+    }
+
+    ResultIds second_ids;
+    ResultDistances second_distances;
+    status = QueryAsync(context, table_schema.table_id_, second_files, k, nprobe, vectors, second_ids,
+                        second_distances);
+    if (!status.ok()) {
+        return status;
+    }
+
+    MergeResult(nq, k, !inner_product, second_ids, second_distances, result_ids, result_distances);
+    return Status::OK();
+}
+
+void
+DBImpl::WriteVectorsSummary(const segment::SegmentWriterPtr& segment_writer_ptr,
+                            const meta::TableFileSchema& table_file) {
+    if (options_.segment_pruning_factor_ <= 0 || server::ValidationUtil::IsBinaryMetricType(table_file.metric_type_)) {
+        return;
+    }
+
+    // a segment without a summary is always searched, so a failure costs no results
+    auto status = segment_writer_ptr->WriteVectorsSummary(table_file.dimension_);
+    if (!status.ok()) {
+        ENGINE_LOG_WARNING << "Failed to write vectors summary of file " << table_file.file_id_ << ": "
+                           << status.message();
+    }
+}
+
 void
 DBImpl::BackgroundTimerTask() {
     server::SystemInfo::GetInstance().Init();
@@ -1388,6 +1594,8 @@ DBImpl::MergeFiles(const std::string& table_id, const meta::TableFilesSchema& fi
         return status;
     }
 
+    WriteVectorsSummary(segment_writer_ptr, table_file);
+
     // step 4: update table files state
     // if index type isn't IDMAP, set file type to TO_INDEX if file size exceed index_file_size
     // else set file type to RAW, no need to build index
@@ -1577,6 +1785,124 @@ DBImpl::GetFilesToSearch(const std::string& table_id, const std::vector<size_t>&
     return Status::OK();
 }
 
+Status
+DBImpl::PreloadFiles(const std::string& progress_key, meta::TableFilesSchema& files_array) {
+    int64_t size = 0;
+    int64_t cache_total = cache::CpuCacheMgr::GetInstance()->CacheCapacity();
+    int64_t cache_usage = cache::CpuCacheMgr::GetInstance()->CacheUsage();
+    int64_t available_size = cache_total - cache_usage;
+
+    // pick the files to load in the given order, as many as the cache can hold
+    struct PreloadFile {
+        meta::TableFileSchema* file_;
+        ExecutionEnginePtr engine_;
+        int64_t size_;
+    };
+    std::vector<PreloadFile> preload_files;
+    bool cache_full = false;
+    for (auto& file : files_array) {
+        EngineType engine_type;
+        if (file.file_type_ == meta::TableFileSchema::FILE_TYPE::RAW ||
+            file.file_type_ == meta::TableFileSchema::FILE_TYPE::TO_INDEX ||
+            file.file_type_ == meta::TableFileSchema::FILE_TYPE::BACKUP) {
+            engine_type = server::ValidationUtil::IsBinaryMetricType(file.metric_type_) ? EngineType::FAISS_BIN_IDMAP
+                                                                                        : EngineType::FAISS_IDMAP;
+        } else {
+            engine_type = (EngineType)file.engine_type_;
+        }
+        ExecutionEnginePtr engine = EngineFactory::Build(file.dimension_, file.location_, engine_type,
+                                                         (MetricType)file.metric_type_, file.nlist_);
+        fiu_do_on("DBImpl.PreloadTable.null_engine", engine = nullptr);
+        if (engine == nullptr) {
+            ENGINE_LOG_ERROR << "Invalid engine type";
+            return Status(DB_ERROR, "Invalid engine type");
+        }
+
+        int64_t file_size = engine->PhysicalSize();
+        size += file_size;
+        fiu_do_on("DBImpl.PreloadTable.exceed_cache", size = available_size + 1);
+        if (size > available_size) {
+            ENGINE_LOG_DEBUG << "Pre-load canceled since cache almost full";
+            cache_full = true;
+            break;
+        }
+        preload_files.push_back(PreloadFile{&file, engine, file_size});
+    }
+
+    // load the files concurrently, the largest first so that the loaders finish at about the same time,
+    // the disk reads of some files overlap the deserialization of the others
+    std::sort(preload_files.begin(), preload_files.end(),
+              [](const PreloadFile& l, const PreloadFile& r) { return l.size_ > r.size_; });
+
+    {
+        std::lock_guard<std::mutex> lock(preload_mutex_);
+        PreloadProgress& progress = preload_progress_[progress_key];
+        progress = PreloadProgress();
+        progress.total_files_ = preload_files.size();
+        for (auto& preload_file : preload_files) {
+            progress.total_size_ += preload_file.size_;
+        }
+    }
+
+    ENGINE_LOG_DEBUG << "Begin pre-load " << progress_key << ", totally " << preload_files.size()
+                     << " files need to be pre-loaded";
+    TimeRecorderAuto rc("Pre-load " + progress_key);
+    std::atomic<bool> failed(false);
+    std::string error_msg;
+    if (!preload_files.empty()) {
+        ThreadPool pool(std::min<size_t>(preload_files.size(), MAX_PRELOAD_CONCURRENCY));
+        std::vector<std::future<void>> futures;
+        for (auto& preload_file : preload_files) {
+            futures.emplace_back(pool.enqueue([&]() {
+                if (failed.load() || !initialized_.load(std::memory_order_acquire)) {
+                    return;
+                }
+
+                auto& file = *preload_file.file_;
+                try {
+                    fiu_do_on("DBImpl.PreloadTable.engine_throw_exception", throw std::exception());
+                    std::string msg = "Pre-loaded file: " + file.file_id_ + " size: " + std::to_string(file.file_size_);
+                    TimeRecorderAuto rc_1(msg);
+                    auto status = preload_file.engine_->Load(true);
+                    if (!status.ok()) {
+                        ENGINE_LOG_WARNING << "Failed to pre-load file " << file.file_id_ << ": " << status.message();
+                        return;
+                    }
+                } catch (std::exception& ex) {
+                    std::lock_guard<std::mutex> lock(preload_mutex_);
+                    if (!failed.exchange(true)) {
+                        error_msg = "Pre-load table encounter exception: " + std::string(ex.what());
+                    }
+                    return;
+                }
+
+                std::lock_guard<std::mutex> lock(preload_mutex_);
+                PreloadProgress& progress = preload_progress_[progress_key];
+                ++progress.loaded_files_;
+                progress.loaded_size_ += preload_file.size_;
+            }));
+        }
+        for (auto& future : futures) {
+            future.get();
+        }
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(preload_mutex_);
+        preload_progress_[progress_key].finished_ = true;
+    }
+
+    if (failed.load()) {
+        ENGINE_LOG_ERROR << error_msg;
+        return Status(DB_ERROR, error_msg);
+    }
+    if (cache_full) {
+        return Status(SERVER_CACHE_FULL, "Cache is full");
+    }
+
+    return Status::OK();
+}
+
 Status
 DBImpl::GetPartitionByTag(const std::string& table_id, const std::string& partition_tag, std::string& partition_name) {
     Status status;
@@ -1644,6 +1970,8 @@ DBImpl::DropTableRecursively(const std::string& table_id) {
     status = mem_mgr_->EraseMemVector(table_id);  // not allow insert
     status = meta_ptr_->DropTable(table_id);      // soft delete table
     index_failed_checker_.CleanFailedIndexFileOfTable(table_id);
+    IVFCentroidsMgr::GetInstance().EraseCentroids(utils::GetTableCentroidsPath(options_.meta_, table_id));
+    utils::EraseTableSegmentCache(options_.meta_, table_id);
 
     // scheduler will determine when to delete table files
     auto nres = scheduler::ResMgrInst::GetInstance()->GetNumOfComputeResource();
@@ -1758,6 +2086,9 @@ DBImpl::DropTableIndexRecursively(const std::string& table_id) {
         return status;
     }
 
+    // the next index may be of another type or nlist, the centroids file is checked again when it is built
+    IVFCentroidsMgr::GetInstance().EraseCentroids(utils::GetTableCentroidsPath(options_.meta_, table_id));
+
     // drop partition index
     std::vector<meta::TableSchema> partition_array;
     status = meta_ptr_->ShowPartitions(table_id, partition_array);
@@ -1946,6 +2277,90 @@ DBImpl::ExecWalRecord(const wal::MXLogRecord& record) {
     return status;
 }
 
+void
+DBImpl::RecoverWal() {
+    // the wal holds only insert and delete records, records of different tables are independent,
+    // so every table of a batch is replayed by its own task while the records of one table keep their order.
+    // records are copied out since the wal buffer is reused when the reader moves to the next file.
+    // a forced flush in one task would stamp the tables of other tasks with lsns they have not reached yet,
+    // so forced flushes are held back and the buffer is flushed between batches instead
+    struct RecoveryRecord {
+        wal::MXLogRecord record;
+        std::vector<IDNumber> ids;
+        std::vector<uint8_t> data;
+    };
+    using RecoveryRecordPtr = std::shared_ptr<RecoveryRecord>;
+
+    size_t thread_num = std::max(1u, std::thread::hardware_concurrency());
+    ThreadPool pool(thread_num);
+
+    mem_mgr_->HoldForceFlush(true);
+
+    uint64_t total_count = 0;
+    bool finished = false;
+    while (!finished) {
+        std::map<std::string, std::vector<RecoveryRecordPtr>> batch;
+        uint64_t batch_size = 0;
+        while (batch_size < WAL_RECOVERY_BATCH_SIZE) {
+            wal::MXLogRecord record;
+            auto error_code = wal_mgr_->GetNextRecovery(record);
+            if (error_code != WAL_SUCCESS) {
+                mem_mgr_->HoldForceFlush(false);
+                throw Exception(error_code, "Wal recovery error!");
+            }
+            if (record.type == wal::MXLogType::None) {
+                finished = true;
+                break;
+            }
+
+            auto copy = std::make_shared<RecoveryRecord>();
+            copy->record = record;
+            if (record.ids != nullptr && record.length > 0) {
+                copy->ids.assign(record.ids, record.ids + record.length);
+                copy->record.ids = copy->ids.data();
+            }
+            if (record.data != nullptr && record.data_size > 0) {
+                auto data = static_cast<const uint8_t*>(record.data);
+                copy->data.assign(data, data + record.data_size);
+                copy->record.data = copy->data.data();
+            }
+
+            batch[record.table_id].emplace_back(copy);
+            batch_size += record.length * sizeof(IDNumber) + record.data_size;
+            ++total_count;
+        }
+
+        std::vector<std::future<void>> futures;
+        for (auto& pair : batch) {
+            auto& records = pair.second;
+            futures.emplace_back(pool.enqueue([this, &records]() {
+                for (auto& copy : records) {
+                    auto status = ExecWalRecord(copy->record);
+                    if (!status.ok()) {
+                        ENGINE_LOG_ERROR << "Failed to replay wal record " << copy->record.lsn << " of table "
+                                         << copy->record.table_id << ": " << status.message();
+                    }
+                }
+            }));
+        }
+        for (auto& future : futures) {
+            future.get();
+        }
+
+        // every record read so far is applied, so the flush lsn is reached by all tables
+        if (mem_mgr_->GetCurrentMem() > options_.insert_buffer_size_) {
+            ENGINE_LOG_DEBUG << "Insert buffer size exceeds limit during wal recovery. Performing flush";
+            wal::MXLogRecord flush_record;
+            flush_record.type = wal::MXLogType::Flush;
+            ExecWalRecord(flush_record);
+        }
+    }
+
+    mem_mgr_->HoldForceFlush(false);
+
+    ENGINE_LOG_DEBUG << "Wal recovery replayed " << total_count << " records";
+}
+
 void
 DBImpl::BackgroundWalTask() {
     server::SystemInfo::GetInstance().Init();
@@ -2014,5 +2429,109 @@ DBImpl::BackgroundWalTask() {
     }
 }
 
+void
+DBImpl::BackgroundCacheSnapshotTask() {
+    auto status = RestoreCacheSnapshot();
+    if (!status.ok()) {
+        ENGINE_LOG_WARNING << "Failed to restore cache snapshot: " << status.message();
+    }
+
+    // a snapshot is also taken when the server stops, unless it stops before the restore is done
+    while (initialized_.load(std::memory_order_acquire)) {
+        cache_snapshot_swn_.Wait_For(std::chrono::seconds(options_.cache_snapshot_interval_));
+
+        status = SaveCacheSnapshot();
+        if (!status.ok()) {
+            ENGINE_LOG_WARNING << "Failed to save cache snapshot: " << status.message();
+        }
+    }
+
+    ENGINE_LOG_DEBUG << "Cache snapshot background thread exit";
+}
+
+Status
+DBImpl::SaveCacheSnapshot() {
+    std::vector<std::string> keys = cache::CpuCacheMgr::GetInstance()->HotKeys();
+
+    // the previous snapshot stays in place until the new one is complete
+    std::string snapshot_path = utils::GetCacheSnapshotPath(options_.meta_);
+    std::string temp_path = snapshot_path + ".temp";
+    {
+        std::ofstream file(temp_path, std::ios::trunc);
+        if (!file.is_open()) {
+            return Status(SERVER_CANNOT_CREATE_FILE, "Failed to create cache snapshot: " + temp_path);
+        }
+        for (auto& key : keys) {
+            file << key << "\n";
+        }
+        if (!file.flush()) {
+            return Status(SERVER_WRITE_ERROR, "Failed to write cache snapshot: " + temp_path);
+        }
+    }
+
+    if (std::rename(temp_path.c_str(), snapshot_path.c_str()) != 0) {
+        return Status(SERVER_WRITE_ERROR, "Failed to rename cache snapshot: " + temp_path);
+    }
+
+    return Status::OK();
+}
+
+Status
+DBImpl::RestoreCacheSnapshot() {
+    std::vector<std::string> keys;
+    {
+        std::ifstream file(utils::GetCacheSnapshotPath(options_.meta_));
+        std::string key;
+        while (std::getline(file, key)) {
+            if (!key.empty()) {
+                keys.emplace_back(key);
+            }
+        }
+    }
+    if (keys.empty()) {
+        return Status::OK();
+    }
+
+    // the cache keys are file locations, files dropped or merged since the snapshot are skipped
+    std::vector<meta::TableSchema> tables;
+    auto status = meta_ptr_->AllTables(tables);
+    if (!status.ok()) {
+        return status;
+    }
+
+    std::vector<size_t> ids;
+    meta::TableFilesSchema files;
+    for (auto& table : tables) {
+        GetFilesToSearch(table.table_id_, ids, files);
+        std::vector<meta::TableSchema> partition_array;
+        meta_ptr_->ShowPartitions(table.table_id_, partition_array);
+        for (auto& schema : partition_array) {
+            GetFilesToSearch(schema.table_id_, ids, files);
+        }
+    }
+
+    std::unordered_map<std::string, meta::TableFileSchema*> location_files;
+    for (auto& file : files) {
+        location_files[file.location_] = &file;
+    }
+
+    meta::TableFilesSchema hot_files;
+    for (auto& key : keys) {
+        auto iter = location_files.find(key);
+        if (iter != location_files.end()) {
+            hot_files.emplace_back(*iter->second);
+            location_files.erase(iter);
+        }
+    }
+
+    ENGINE_LOG_DEBUG << "Restore " << hot_files.size() << " of " << keys.size() << " files in cache snapshot";
+    status = PreloadFiles(CACHE_SNAPSHOT_PRELOAD_KEY, hot_files);
+    if (status.code() == SERVER_CACHE_FULL) {
+        // the cache capacity may have been lowered since the snapshot, the hottest files are loaded
+        return Status::OK();
+    }
+    return status;
+}
+
 }  // namespace engine
 }  // namespace milvus
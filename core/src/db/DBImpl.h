@@ -25,8 +25,10 @@
 #include "DB.h"
 #include "db/IndexFailedChecker.h"
 #include "db/OngoingFileChecker.h"
+#include "db/QueryCombiner.h"
 #include "db/Types.h"
 #include "db/insert/MemManager.h"
+#include "segment/SegmentWriter.h"
 #include "utils/ThreadPool.h"
 #include "wal/WalManager.h"
 
@@ -73,6 +75,9 @@ class DBImpl : public DB {
     Status
     PreloadTable(const std::string& table_id) override;
 
+    Status
+    GetPreloadProgress(std::map<std::string, PreloadProgress>& progress) override;
+
     Status
     UpdateTableFlag(const std::string& table_id, int64_t flag) override;
 
@@ -113,6 +118,9 @@ class DBImpl : public DB {
     Status
     GetVectorByID(const std::string& table_id, const IDNumber& vector_id, VectorsData& vector) override;
 
+    Status
+    GetVectorsByID(const std::string& table_id, const IDNumbers& id_array, std::vector<VectorsData>& vectors) override;
+
     Status
     GetVectorIDs(const std::string& table_id, const std::string& segment_id, IDNumbers& vector_ids) override;
 
@@ -147,14 +155,26 @@ class DBImpl : public DB {
     Size(uint64_t& result) override;
 
  private:
+    Status
+    QueryHelper(const std::shared_ptr<server::Context>& context, const std::string& table_id,
+                const std::vector<std::string>& partition_tags, uint64_t k, uint64_t nprobe, const VectorsData& vectors,
+                ResultIds& result_ids, ResultDistances& result_distances);
+
     Status
     QueryAsync(const std::shared_ptr<server::Context>& context, const std::string& table_id,
                const meta::TableFilesSchema& files, uint64_t k, uint64_t nprobe, const VectorsData& vectors,
                ResultIds& result_ids, ResultDistances& result_distances);
 
+    // Searches the files in two rounds when segment pruning is enabled: first the files without a summary and the
+    // most promising file of each query, then only the files whose summary may still beat the k-th result found
     Status
-    GetVectorByIdHelper(const std::string& table_id, IDNumber vector_id, VectorsData& vector,
-                        const meta::TableFilesSchema& files);
+    QueryAsyncPruned(const std::shared_ptr<server::Context>& context, const meta::TableSchema& table_schema,
+                     const meta::TableFilesSchema& files, uint64_t k, uint64_t nprobe, const VectorsData& vectors,
+                     ResultIds& result_ids, ResultDistances& result_distances);
+
+    Status
+    GetVectorsByIdHelper(const std::string& table_id, const IDNumbers& id_array, std::vector<VectorsData>& vectors,
+                         const meta::TableFilesSchema& files);
 
     void
     BackgroundTimerTask();
@@ -184,6 +204,10 @@ class DBImpl : public DB {
     Status
     CompactFile(const std::string& table_id, const milvus::engine::meta::TableFileSchema& file);
 
+    // summarize a merged or compacted segment after it is serialized, see DBOptions::segment_pruning_factor_
+    void
+    WriteVectorsSummary(const segment::SegmentWriterPtr& segment_writer_ptr, const meta::TableFileSchema& table_file);
+
     /*
     Status
     SyncMemData(std::set<std::string>& sync_table_ids);
@@ -196,6 +220,10 @@ class DBImpl : public DB {
     Status
     GetFilesToSearch(const std::string& table_id, const std::vector<size_t>& file_ids, meta::TableFilesSchema& files);
 
+    // load the files into cpu cache in the given order until it is full, the progress is kept under progress_key
+    Status
+    PreloadFiles(const std::string& progress_key, meta::TableFilesSchema& files);
+
     Status
     GetPartitionByTag(const std::string& table_id, const std::string& partition_tag, std::string& partition_name);
 
@@ -221,14 +249,28 @@ class DBImpl : public DB {
     Status
     ExecWalRecord(const wal::MXLogRecord& record);
 
+    void
+    RecoverWal();
+
     void
     BackgroundWalTask();
 
+    void
+    BackgroundCacheSnapshotTask();
+
+    Status
+    SaveCacheSnapshot();
+
+    Status
+    RestoreCacheSnapshot();
+
  private:
     const DBOptions options_;
 
     std::atomic<bool> initialized_;
 
+    QueryCombiner query_combiner_;
+
     std::thread bg_timer_thread_;
 
     meta::MetaPtr meta_ptr_;
@@ -237,6 +279,8 @@ class DBImpl : public DB {
     std::shared_ptr<wal::WalManager> wal_mgr_;
     std::thread bg_wal_thread_;
 
+    std::thread bg_cache_snapshot_thread_;
+
     struct SimpleWaitNotify {
         bool notified_ = false;
         std::mutex mutex_;
@@ -280,6 +324,7 @@ class DBImpl : public DB {
 
     SimpleWaitNotify bg_task_swn_;
     SimpleWaitNotify flush_task_swn_;
+    SimpleWaitNotify cache_snapshot_swn_;
 
     ThreadPool merge_thread_pool_;
     std::mutex merge_result_mutex_;
@@ -295,6 +340,9 @@ class DBImpl : public DB {
     IndexFailedChecker index_failed_checker_;
 
     std::mutex flush_merge_compact_mutex_;
+
+    std::mutex preload_mutex_;
+    std::map<std::string, PreloadProgress> preload_progress_;
 };  // DBImpl
 
 }  // namespace engine
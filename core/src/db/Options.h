@@ -73,11 +73,27 @@ struct DBOptions {
 
     int64_t auto_flush_interval_ = 1;
 
+    // train the ivf coarse quantizer once per table and build every segment on it
+    bool shared_ivf_centroids_ = false;
+
+    // write a summary of every segment and skip the segments it rules out in search, 1 only skips the segments
+    // which can't hold a result, lower values skip more at some cost of recall, 0 means disabled
+    float segment_pruning_factor_ = 0;
+
+    // seconds between two snapshots of the files in cpu cache, reloaded at startup, 0 means disabled
+    int64_t cache_snapshot_interval_ = 0;
+
+    // search combine relative configurations, max wait time is in microseconds, 0 means disabled
+    int64_t search_combine_max_wait_ = 0;
+    int64_t search_combine_max_nq_ = 2048;
+
     // wal relative configurations
     bool wal_enable_ = true;
     bool recovery_error_ignore_ = true;
     int64_t buffer_size_ = 256;
     std::string mxlog_path_ = "/tmp/milvus/wal/";
+    std::string wal_sync_mode_ = "none";  // none, batch or interval
+    int64_t wal_sync_interval_ = 1000;     // milliseconds, used by interval sync mode
 };  // Options
 
 }  // namespace engine
@@ -0,0 +1,153 @@
+// Copyright (C) 2019-2020 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License.
+
+#include "db/QueryCombiner.h"
+#include "metrics/Metrics.h"
+#include "utils/Log.h"
+
+#include <chrono>
+#include <utility>
+
+namespace milvus {
+namespace engine {
+
+QueryCombiner::QueryCombiner(int64_t max_wait_us, int64_t max_nq)
+    : max_wait_us_(max_wait_us), max_nq_(max_nq > 0 ? max_nq : 0) {
+}
+
+std::string
+QueryCombiner::CombineKey(const std::string& table_id, const std::vector<std::string>& partition_tags, uint64_t k,
+                          uint64_t nprobe, const VectorsData& vectors) {
+    std::string key = table_id + "|" + std::to_string(k) + "|" + std::to_string(nprobe) + "|";
+    key += vectors.float_data_.empty() ? "binary" : "float";
+    for (auto& tag : partition_tags) {
+        key += "|" + tag;
+    }
+    return key;
+}
+
+Status
+QueryCombiner::Query(const std::string& combine_key, const VectorsData& vectors, const QueryFunc& func,
+                     ResultIds& result_ids, ResultDistances& result_distances) {
+    uint64_t nq = vectors.vector_count_;
+    if (max_wait_us_ <= 0 || nq == 0 || nq >= max_nq_) {
+        return func(vectors, result_ids, result_distances);
+    }
+
+    auto query = std::make_shared<PendingQuery>();
+    query->vectors_ = &vectors;
+    query->result_ids_ = &result_ids;
+    query->result_distances_ = &result_distances;
+
+    std::unique_lock<std::mutex> lock(mutex_);
+    auto iter = open_batches_.find(combine_key);
+    if (iter != open_batches_.end()) {
+        BatchPtr batch = iter->second;
+        if (batch->nq_ + nq <= max_nq_) {
+            // join the open batch, its leader will execute the query for us
+            batch->queries_.push_back(query);
+            batch->nq_ += nq;
+            if (batch->nq_ >= max_nq_) {
+                CloseBatchNoLock(combine_key, batch);
+            }
+
+            cv_.wait(lock, [&] { return query->done_; });
+            return query->status_;
+        }
+
+        // no room left for this query, let the open batch go ahead
+        CloseBatchNoLock(combine_key, batch);
+    }
+
+    // start a new batch and wait for other queries to join
+    auto batch = std::make_shared<Batch>();
+    batch->queries_.push_back(query);
+    batch->nq_ = nq;
+    open_batches_[combine_key] = batch;
+
+    cv_.wait_for(lock, std::chrono::microseconds(max_wait_us_), [&] { return batch->closed_; });
+    if (!batch->closed_) {
+        CloseBatchNoLock(combine_key, batch);
+    }
+    lock.unlock();
+
+    ExecuteBatch(batch, func);
+    return query->status_;
+}
+
+void
+QueryCombiner::CloseBatchNoLock(const std::string& combine_key, const BatchPtr& batch) {
+    batch->closed_ = true;
+    auto iter = open_batches_.find(combine_key);
+    if (iter != open_batches_.end() && iter->second == batch) {
+        open_batches_.erase(iter);
+    }
+    cv_.notify_all();
+}
+
+void
+QueryCombiner::ExecuteBatch(const BatchPtr& batch, const QueryFunc& func) {
+    Status status;
+    try {
+        if (batch->queries_.size() == 1) {
+            auto& query = batch->queries_.front();
+            status = func(*query->vectors_, *query->result_ids_, *query->result_distances_);
+        } else {
+            // step 1: concatenate query vectors
+            VectorsData combined;
+            combined.vector_count_ = batch->nq_;
+            for (auto& query : batch->queries_) {
+                const VectorsData& vectors = *query->vectors_;
+                combined.float_data_.insert(combined.float_data_.end(), vectors.float_data_.begin(),
+                                            vectors.float_data_.end());
+                combined.binary_data_.insert(combined.binary_data_.end(), vectors.binary_data_.begin(),
+                                             vectors.binary_data_.end());
+            }
+
+            // step 2: search all of them at once
+            ResultIds result_ids;
+            ResultDistances result_distances;
+            status = func(combined, result_ids, result_distances);
+
+            // step 3: split results, every query has the same number of results per vector
+            if (status.ok()) {
+                uint64_t k = result_ids.size() / batch->nq_;
+                uint64_t offset = 0;
+                for (auto& query : batch->queries_) {
+                    uint64_t nq = query->vectors_->vector_count_;
+                    query->result_ids_->assign(result_ids.begin() + offset * k, result_ids.begin() + (offset + nq) * k);
+                    query->result_distances_->assign(result_distances.begin() + offset * k,
+                                                     result_distances.begin() + (offset + nq) * k);
+                    offset += nq;
+                }
+            }
+
+            ENGINE_LOG_DEBUG << "Combined " << batch->queries_.size() << " queries, total nq: " << batch->nq_;
+        }
+    } catch (std::exception& ex) {
+        status = Status(DB_ERROR, "Combined query failed: " + std::string(ex.what()));
+    }
+
+    server::Metrics::GetInstance().SearchCombineSizeHistogramObserve(batch->queries_.size());
+    server::Metrics::GetInstance().SearchCombineNqHistogramObserve(batch->nq_);
+
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (auto& query : batch->queries_) {
+            query->status_ = status;
+            query->done_ = true;
+        }
+    }
+    cv_.notify_all();
+}
+
+}  // namespace engine
+}  // namespace milvus
@@ -0,0 +1,79 @@
+// Copyright (C) 2019-2020 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License.
+
+#pragma once
+
+#include "db/Types.h"
+#include "utils/Status.h"
+
+#include <condition_variable>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace milvus {
+namespace engine {
+
+// Merges concurrent queries which share the same search parameters into one query with a concatenated
+// query matrix. The first query of a batch waits at most max_wait_us for others to join, then executes the
+// whole batch and splits the results back to every caller.
+class QueryCombiner {
+ public:
+    using QueryFunc =
+        std::function<Status(const VectorsData& vectors, ResultIds& result_ids, ResultDistances& result_distances)>;
+
+    QueryCombiner(int64_t max_wait_us, int64_t max_nq);
+
+    Status
+    Query(const std::string& combine_key, const VectorsData& vectors, const QueryFunc& func, ResultIds& result_ids,
+          ResultDistances& result_distances);
+
+    static std::string
+    CombineKey(const std::string& table_id, const std::vector<std::string>& partition_tags, uint64_t k,
+               uint64_t nprobe, const VectorsData& vectors);
+
+ private:
+    struct PendingQuery {
+        const VectorsData* vectors_ = nullptr;
+        ResultIds* result_ids_ = nullptr;
+        ResultDistances* result_distances_ = nullptr;
+        Status status_;
+        bool done_ = false;
+    };
+    using PendingQueryPtr = std::shared_ptr<PendingQuery>;
+
+    struct Batch {
+        std::vector<PendingQueryPtr> queries_;
+        uint64_t nq_ = 0;
+        bool closed_ = false;
+    };
+    using BatchPtr = std::shared_ptr<Batch>;
+
+    void
+    CloseBatchNoLock(const std::string& combine_key, const BatchPtr& batch);
+
+    void
+    ExecuteBatch(const BatchPtr& batch, const QueryFunc& func);
+
+ private:
+    int64_t max_wait_us_;
+    uint64_t max_nq_;
+
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    std::map<std::string, BatchPtr> open_batches_;
+};
+
+}  // namespace engine
+}  // namespace milvus
@@ -67,6 +67,15 @@ struct TableInfo {
     std::vector<PartitionStat> partitions_stat_;
 };
 
+// progress of the last preload of a table, sizes are in bytes
+struct PreloadProgress {
+    int64_t total_files_ = 0;
+    int64_t loaded_files_ = 0;
+    int64_t total_size_ = 0;
+    int64_t loaded_size_ = 0;
+    bool finished_ = false;
+};
+
 static const char* DEFAULT_PARTITON_TAG = "_default";
 
 }  // namespace engine
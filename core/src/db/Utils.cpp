@@ -18,6 +18,7 @@
 #include <regex>
 #include <vector>
 
+#include "cache/SegmentCacheMgr.h"
 #include "server/Config.h"
 #include "storage/s3/S3ClientWrapper.h"
 #include "utils/CommonUtil.h"
@@ -30,6 +31,8 @@ namespace utils {
 namespace {
 
 const char* TABLES_FOLDER = "/tables/";
+const char* IVF_CENTROIDS_FILE = "ivf_centroids";
+const char* CACHE_SNAPSHOT_FILE = "cache_snapshot";
 
 uint64_t index_file_counter = 0;
 std::mutex index_file_counter_mutex;
@@ -105,6 +108,8 @@ DeleteTablePath(const DBMetaOptions& options, const std::string& table_id, bool
     std::vector<std::string> paths = options.slave_paths_;
     paths.push_back(options.path_);
 
+    EraseTableSegmentCache(options, table_id);
+
     for (auto& path : paths) {
         std::string table_path = path + TABLES_FOLDER + table_id;
         if (force) {
@@ -199,9 +204,41 @@ DeleteSegment(const DBMetaOptions& options, meta::TableFileSchema& table_file) {
     std::string segment_dir;
     GetParentPath(table_file.location_, segment_dir);
     boost::filesystem::remove_all(segment_dir);
+    cache::SegmentCacheMgr::GetInstance()->EraseSegment(segment_dir);
     return Status::OK();
 }
 
+void
+EraseTableSegmentCache(const DBMetaOptions& options, const std::string& table_id) {
+    std::vector<std::string> paths = options.slave_paths_;
+    paths.push_back(options.path_);
+
+    for (auto& path : paths) {
+        std::string table_path = path + TABLES_FOLDER + table_id;
+        if (!boost::filesystem::is_directory(table_path)) {
+            continue;
+        }
+
+        // segment folders sit directly in the table folder, they key the cached components
+        boost::filesystem::directory_iterator end_iter;
+        for (boost::filesystem::directory_iterator iter(table_path); iter != end_iter; ++iter) {
+            if (boost::filesystem::is_directory(iter->status())) {
+                cache::SegmentCacheMgr::GetInstance()->EraseSegment(iter->path().string());
+            }
+        }
+    }
+}
+
+std::string
+GetTableCentroidsPath(const DBMetaOptions& options, const std::string& table_id) {
+    return options.path_ + TABLES_FOLDER + table_id + "/" + IVF_CENTROIDS_FILE;
+}
+
+std::string
+GetCacheSnapshotPath(const DBMetaOptions& options) {
+    return options.path_ + "/" + CACHE_SNAPSHOT_FILE;
+}
+
 Status
 GetParentPath(const std::string& path, std::string& parent_path) {
     boost::filesystem::path p(path);
@@ -38,6 +38,17 @@ Status
 DeleteTableFilePath(const DBMetaOptions& options, meta::TableFileSchema& table_file);
 Status
 DeleteSegment(const DBMetaOptions& options, meta::TableFileSchema& table_file);
+// drop the cached components of every segment found in the table folders
+void
+EraseTableSegmentCache(const DBMetaOptions& options, const std::string& table_id);
+
+// the ivf centroids shared by the segments of a table live in the table folder of the primary path
+std::string
+GetTableCentroidsPath(const DBMetaOptions& options, const std::string& table_id);
+
+// the snapshot of the files resident in cpu cache lives in the primary path
+std::string
+GetCacheSnapshotPath(const DBMetaOptions& options);
 
 Status
 GetParentPath(const std::string& path, std::string& parent_path);
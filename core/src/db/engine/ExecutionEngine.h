@@ -104,8 +104,9 @@ class ExecutionEngine {
     Search(int64_t n, const std::vector<int64_t>& ids, int64_t k, int64_t nprobe, float* distances, int64_t* labels,
            bool hybrid) = 0;
 
+    // centroids_path, when not empty, is the file of the ivf centroids shared by the segments of the table
     virtual std::shared_ptr<ExecutionEngine>
-    BuildIndex(const std::string& location, EngineType engine_type) = 0;
+    BuildIndex(const std::string& location, EngineType engine_type, const std::string& centroids_path = "") = 0;
 
     virtual Status
     Cache() = 0;
@@ -21,7 +21,9 @@
 #include "cache/CpuCacheMgr.h"
 #include "cache/GpuCacheMgr.h"
 #include "db/Utils.h"
+#include "db/engine/IVFCentroidsMgr.h"
 #include "knowhere/common/Config.h"
+#include "knowhere/index/vector_index/helpers/IndexParameter.h"
 #include "metrics/Metrics.h"
 #include "scheduler/Utils.h"
 #include "server/Config.h"
@@ -72,6 +74,13 @@ IsBinaryIndexType(IndexType type) {
     return type == IndexType::FAISS_BIN_IDMAP || type == IndexType::FAISS_BIN_IVFLAT_CPU;
 }
 
+// cpu ivf indexes train their coarse quantizer on the host and can take it from the table
+bool
+IsSharedCentroidsType(IndexType type) {
+    return type == IndexType::FAISS_IVFFLAT_CPU || type == IndexType::FAISS_IVFSQ8_CPU ||
+           type == IndexType::FAISS_IVFPQ_CPU;
+}
+
 }  // namespace
 
 class CachedQuantizer : public cache::DataObj {
@@ -415,56 +424,65 @@ ExecutionEngineImpl::Load(bool to_cache) {
             auto adapter = AdapterMgr::GetInstance().GetAdapter(index_->GetType());
             auto conf = adapter->Match(temp_conf);
 
-            status = segment_reader_ptr->Load();
+            // the raw vectors are mapped rather than read, so the index data is the only copy on the heap
+            std::vector<segment::doc_id_t> uids;
+            segment::DeletedDocsPtr deleted_docs_ptr;
+            segment::MappedVectorsPtr mapped_vectors;
+            status = segment_reader_ptr->LoadUids(uids);
+            if (status.ok()) {
+                status = segment_reader_ptr->LoadDeletedDocs(deleted_docs_ptr);
+            }
+            if (status.ok()) {
+                status = segment_reader_ptr->LoadVectorsMapped(mapped_vectors);
+            }
             if (!status.ok()) {
                 std::string msg = "Failed to load segment from " + location_;
                 ENGINE_LOG_ERROR << msg;
                 return Status(DB_ERROR, msg);
             }
 
-            segment::SegmentPtr segment_ptr;
-            segment_reader_ptr->GetSegment(segment_ptr);
-            auto& vectors = segment_ptr->vectors_ptr_;
-            auto& deleted_docs = segment_ptr->deleted_docs_ptr_->GetDeletedDocs();
-
-            auto vectors_uids = vectors->GetUids();
-            index_->SetUids(vectors_uids);
-
-            auto vectors_data = vectors->GetData();
+            int64_t count = uids.size();
+            size_t code_length = (index_type_ == EngineType::FAISS_IDMAP) ? dim_ * sizeof(float) : dim_ / 8;
+            if (mapped_vectors->GetNumBytes() != count * code_length) {
+                std::string msg = "Raw vectors don't match uids in segment " + segment_dir;
+                ENGINE_LOG_ERROR << msg;
+                return Status(DB_ERROR, msg);
+            }
 
-            faiss::ConcurrentBitsetPtr concurrent_bitset_ptr =
-                std::make_shared<faiss::ConcurrentBitset>(vectors->GetCount());
-            for (auto& offset : deleted_docs) {
-                if (!concurrent_bitset_ptr->test(offset)) {
-                    concurrent_bitset_ptr->set(offset);
-                }
+            faiss::ConcurrentBitsetPtr concurrent_bitset_ptr = std::make_shared<faiss::ConcurrentBitset>(count);
+            for (auto& offset : deleted_docs_ptr->GetDeletedDocs()) {
+                concurrent_bitset_ptr->set(offset);
             }
 
+            index_->SetUids(uids);
+
             ErrorCode ec = KNOWHERE_UNEXPECTED_ERROR;
             if (index_type_ == EngineType::FAISS_IDMAP) {
-                std::vector<float> float_vectors;
-                float_vectors.resize(vectors_data.size() / sizeof(float));
-                memcpy(float_vectors.data(), vectors_data.data(), vectors_data.size());
                 ec = std::static_pointer_cast<BFIndex>(index_)->Build(conf);
                 if (ec != KNOWHERE_SUCCESS) {
                     return status;
                 }
-                status = std::static_pointer_cast<BFIndex>(index_)->AddWithoutIds(vectors->GetCount(),
-                                                                                  float_vectors.data(), Config());
+                auto float_vectors = reinterpret_cast<const float*>(mapped_vectors->GetData());
+                status = std::static_pointer_cast<BFIndex>(index_)->AddWithoutIds(count, float_vectors, Config());
                 status = std::static_pointer_cast<BFIndex>(index_)->SetBlacklist(concurrent_bitset_ptr);
             } else if (index_type_ == EngineType::FAISS_BIN_IDMAP) {
                 ec = std::static_pointer_cast<BinBFIndex>(index_)->Build(conf);
                 if (ec != KNOWHERE_SUCCESS) {
                     return status;
                 }
-                status = std::static_pointer_cast<BinBFIndex>(index_)->AddWithoutIds(vectors->GetCount(),
-                                                                                     vectors_data.data(), Config());
+                status = std::static_pointer_cast<BinBFIndex>(index_)->AddWithoutIds(count, mapped_vectors->GetData(),
+                                                                                     Config());
                 status = std::static_pointer_cast<BinBFIndex>(index_)->SetBlacklist(concurrent_bitset_ptr);
             }
             if (!status.ok()) {
                 return status;
             }
 
+            // the cpu cache accounts the index copy, don't keep a second copy of the file in page cache
+            if (to_cache) {
+                mapped_vectors->ReleasePageCache();
+            }
+
             ENGINE_LOG_DEBUG << "Finished loading raw data from segment " << segment_dir;
 
         } else {
@@ -490,9 +508,7 @@ ExecutionEngineImpl::Load(bool to_cache) {
                     faiss::ConcurrentBitsetPtr concurrent_bitset_ptr =
                         std::make_shared<faiss::ConcurrentBitset>(index_->Count());
                     for (auto& offset : deleted_docs) {
-                        if (!concurrent_bitset_ptr->test(offset)) {
-                            concurrent_bitset_ptr->set(offset);
-                        }
+                        concurrent_bitset_ptr->set(offset);
                     }
 
                     index_->SetBlacklist(concurrent_bitset_ptr);
@@ -700,7 +716,8 @@ ExecutionEngineImpl::Merge(const std::string& location) {
 */
 
 ExecutionEnginePtr
-ExecutionEngineImpl::BuildIndex(const std::string& location, EngineType engine_type) {
+ExecutionEngineImpl::BuildIndex(const std::string& location, EngineType engine_type,
+                                const std::string& centroids_path) {
     ENGINE_LOG_DEBUG << "Build index file: " << location << " from: " << location_;
 
     auto from_index = std::dynamic_pointer_cast<BFIndex>(index_);
@@ -728,7 +745,22 @@ ExecutionEngineImpl::BuildIndex(const std::string& location, EngineType engine_t
     auto adapter = AdapterMgr::GetInstance().GetAdapter(to_index->GetType());
     auto conf = adapter->Match(temp_conf);
 
-    if (from_index) {
+    // centroids are shared only by segments large enough to be built with the nlist of the table
+    IVFCentroidsPtr centroids;
+    auto ivf_conf = std::dynamic_pointer_cast<knowhere::IVFCfg>(conf);
+    if (from_index && !centroids_path.empty() && IsSharedCentroidsType(to_index->GetType()) && ivf_conf &&
+        ivf_conf->nlist == nlist_) {
+        status = IVFCentroidsMgr::GetInstance().GetCentroids(centroids_path, Dimension(), nlist_, Count(),
+                                                             from_index->GetRawVectors(), centroids);
+        if (!status.ok()) {
+            ENGINE_LOG_WARNING << "Build index file: " << location << " without shared centroids, " << status.message();
+        }
+    }
+
+    if (from_index && centroids) {
+        status = to_index->BuildAllWithCentroids(Count(), from_index->GetRawVectors(), from_index->GetRawIds(), conf,
+                                                 centroids->data_.data());
+    } else if (from_index) {
         status = to_index->BuildAll(Count(), from_index->GetRawVectors(), from_index->GetRawIds(), conf);
     } else if (bin_from_index) {
         status = to_index->BuildAll(Count(), bin_from_index->GetRawVectors(), bin_from_index->GetRawIds(), conf);
@@ -919,46 +951,32 @@ ExecutionEngineImpl::Search(int64_t n, const std::vector<int64_t>& ids, int64_t
 
     rc.RecordSection("search prepare");
 
-    // std::string segment_dir;
-    // utils::GetParentPath(location_, segment_dir);
-    // segment::SegmentReader segment_reader(segment_dir);
-    //    segment::IdBloomFilterPtr id_bloom_filter_ptr;
-    //    segment_reader.LoadBloomFilter(id_bloom_filter_ptr);
-
-    // Check if the id is present. If so, find its offset
-    const std::vector<segment::doc_id_t>& uids = index_->GetUids();
-
-    std::vector<int64_t> offsets;
-    /*
-    std::vector<segment::doc_id_t> uids;
-    auto status = segment_reader.LoadUids(uids);
+    // The uid index of the segment holds live docs only and lives in the segment cache. Deletes set the blacklist
+    // of the cached index before they reach the deleted docs of the segment, so the blacklist is checked as well
+    std::string segment_dir;
+    utils::GetParentPath(location_, segment_dir);
+    segment::SegmentReader segment_reader(segment_dir);
+    segment::IdIndexPtr id_index;
+    auto status = segment_reader.LoadIdIndex(id_index);
     if (!status.ok()) {
         return status;
     }
-     */
 
-    // There is only one id in ids
+    faiss::ConcurrentBitsetPtr blacklist = nullptr;
+    index_->GetBlacklist(blacklist);
+
+    // Check if the id is present. If so, find its offset
+    const std::vector<segment::doc_id_t>& uids = index_->GetUids();
+    std::vector<int64_t> offsets;
     for (auto& id : ids) {
-        //        if (id_bloom_filter_ptr->Check(id)) {
-        //            if (uids.empty()) {
-        //                segment_reader.LoadUids(uids);
-        //            }
-        //            auto found = std::find(uids.begin(), uids.end(), id);
-        //            if (found != uids.end()) {
-        //                auto offset = std::distance(uids.begin(), found);
-        //                offsets.emplace_back(offset);
-        //            }
-        //        }
-        auto found = std::find(uids.begin(), uids.end(), id);
-        if (found != uids.end()) {
-            auto offset = std::distance(uids.begin(), found);
+        segment::offset_t offset;
+        if (id_index->Get(id, offset) && (blacklist == nullptr || !blacklist->test(offset))) {
             offsets.emplace_back(offset);
         }
     }
 
     rc.RecordSection("get offset");
 
-    auto status = Status::OK();
     if (!offsets.empty()) {
         status = index_->SearchById(offsets.size(), offsets.data(), distances, labels, conf);
         rc.RecordSection("search by id done");
@@ -89,7 +89,7 @@ class ExecutionEngineImpl : public ExecutionEngine {
            bool hybrid) override;
 
     ExecutionEnginePtr
-    BuildIndex(const std::string& location, EngineType engine_type) override;
+    BuildIndex(const std::string& location, EngineType engine_type, const std::string& centroids_path = "") override;
 
     Status
     Cache() override;
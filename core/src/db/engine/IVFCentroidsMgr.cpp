@@ -0,0 +1,179 @@
+// Copyright (C) 2019-2020 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License.
+
+#include "db/engine/IVFCentroidsMgr.h"
+
+#include <faiss/Clustering.h>
+
+#include <boost/filesystem.hpp>
+#include <cstdio>
+#include <fstream>
+
+#include "utils/Log.h"
+#include "utils/TimeRecorder.h"
+
+namespace milvus {
+namespace engine {
+
+namespace {
+
+constexpr uint32_t CENTROIDS_MAGIC = 0xCE7201D5;
+constexpr uint32_t CENTROIDS_VERSION = 1;
+
+struct CentroidsHeader {
+    uint32_t magic;
+    uint32_t version;
+    int64_t dimension;
+    int64_t nlist;
+};
+
+bool
+IsMatched(const IVFCentroidsPtr& centroids, int64_t dimension, int64_t nlist) {
+    return centroids != nullptr && centroids->dimension_ == dimension && centroids->nlist_ == nlist;
+}
+
+}  // namespace
+
+Status
+IVFCentroidsMgr::GetCentroids(const std::string& path, int64_t dimension, int64_t nlist, int64_t nb, const float* xb,
+                              IVFCentroidsPtr& centroids) {
+    std::shared_ptr<std::mutex> path_mutex;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto& mutex = path_mutexes_[path];
+        if (mutex == nullptr) {
+            mutex = std::make_shared<std::mutex>();
+        }
+        path_mutex = mutex;
+    }
+
+    // segments of one table are built concurrently, the first of them trains and the others wait for its result
+    std::lock_guard<std::mutex> path_lock(*path_mutex);
+
+    // the file disappears with the table directory, a table created again under the same name trains anew
+    bool file_exists = boost::filesystem::exists(path);
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto iter = centroids_.find(path);
+        if (iter != centroids_.end()) {
+            if (file_exists && IsMatched(iter->second, dimension, nlist)) {
+                centroids = iter->second;
+                return Status::OK();
+            }
+            centroids_.erase(iter);
+        }
+    }
+
+    IVFCentroidsPtr loaded;
+    if (file_exists) {
+        auto status = ReadCentroids(path, loaded);
+        if (!status.ok()) {
+            ENGINE_LOG_WARNING << status.message() << ", centroids will be trained again";
+        }
+    }
+
+    if (!IsMatched(loaded, dimension, nlist)) {
+        if (nb < nlist) {
+            std::string msg = "Too few vectors to train " + std::to_string(nlist) + " centroids: " + std::to_string(nb);
+            return Status(DB_ERROR, msg);
+        }
+
+        TimeRecorder rc("Train ivf centroids");
+        loaded = std::make_shared<IVFCentroids>();
+        loaded->dimension_ = dimension;
+        loaded->nlist_ = nlist;
+        loaded->data_.resize(nlist * dimension);
+        try {
+            // faiss samples at most 256 vectors per centroid out of the given ones
+            faiss::kmeans_clustering(dimension, nb, nlist, xb, loaded->data_.data());
+        } catch (std::exception& ex) {
+            std::string msg = "Failed to train ivf centroids: " + std::string(ex.what());
+            ENGINE_LOG_ERROR << msg;
+            return Status(DB_ERROR, msg);
+        }
+        rc.ElapseFromBegin("done, nlist: " + std::to_string(nlist) + ", vectors: " + std::to_string(nb));
+
+        auto status = WriteCentroids(path, loaded);
+        if (!status.ok()) {
+            return status;
+        }
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    centroids_[path] = loaded;
+    centroids = loaded;
+    return Status::OK();
+}
+
+void
+IVFCentroidsMgr::EraseCentroids(const std::string& path) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    centroids_.erase(path);
+}
+
+Status
+IVFCentroidsMgr::ReadCentroids(const std::string& path, IVFCentroidsPtr& centroids) {
+    std::ifstream file(path, std::ios::binary);
+    if (!file.is_open()) {
+        return Status(SERVER_FILE_NOT_FOUND, "Failed to open centroids file: " + path);
+    }
+
+    CentroidsHeader header;
+    if (!file.read(reinterpret_cast<char*>(&header), sizeof(header)) || header.magic != CENTROIDS_MAGIC ||
+        header.version != CENTROIDS_VERSION || header.dimension <= 0 || header.nlist <= 0) {
+        return Status(DB_ERROR, "Invalid centroids file: " + path);
+    }
+
+    auto loaded = std::make_shared<IVFCentroids>();
+    loaded->dimension_ = header.dimension;
+    loaded->nlist_ = header.nlist;
+    loaded->data_.resize(header.nlist * header.dimension);
+    if (!file.read(reinterpret_cast<char*>(loaded->data_.data()), loaded->data_.size() * sizeof(float))) {
+        return Status(DB_ERROR, "Centroids file is truncated: " + path);
+    }
+
+    centroids = loaded;
+    return Status::OK();
+}
+
+Status
+IVFCentroidsMgr::WriteCentroids(const std::string& path, const IVFCentroidsPtr& centroids) {
+    // written aside and renamed, so a crash never leaves a partial file behind
+    const std::string temp_path = path + ".temp";
+    {
+        std::ofstream file(temp_path, std::ios::binary | std::ios::trunc);
+        if (!file.is_open()) {
+            std::string msg = "Failed to create centroids file: " + temp_path;
+            ENGINE_LOG_ERROR << msg;
+            return Status(SERVER_CANNOT_CREATE_FILE, msg);
+        }
+
+        CentroidsHeader header{CENTROIDS_MAGIC, CENTROIDS_VERSION, centroids->dimension_, centroids->nlist_};
+        file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        file.write(reinterpret_cast<const char*>(centroids->data_.data()), centroids->data_.size() * sizeof(float));
+        if (!file.flush()) {
+            std::string msg = "Failed to write centroids file: " + temp_path;
+            ENGINE_LOG_ERROR << msg;
+            return Status(SERVER_WRITE_ERROR, msg);
+        }
+    }
+
+    if (std::rename(temp_path.c_str(), path.c_str()) != 0) {
+        std::string msg = "Failed to rename centroids file: " + temp_path;
+        ENGINE_LOG_ERROR << msg;
+        return Status(SERVER_WRITE_ERROR, msg);
+    }
+
+    return Status::OK();
+}
+
+}  // namespace engine
+}  // namespace milvus
@@ -0,0 +1,69 @@
+// Copyright (C) 2019-2020 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License.
+
+#pragma once
+
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "utils/Status.h"
+
+namespace milvus {
+namespace engine {
+
+// coarse quantizer centroids shared by the ivf indexes of all segments of a table
+struct IVFCentroids {
+    int64_t dimension_ = 0;
+    int64_t nlist_ = 0;
+    std::vector<float> data_;  // nlist_ * dimension_ floats
+};
+
+using IVFCentroidsPtr = std::shared_ptr<IVFCentroids>;
+
+class IVFCentroidsMgr {
+ public:
+    static IVFCentroidsMgr&
+    GetInstance() {
+        static IVFCentroidsMgr instance;
+        return instance;
+    }
+
+    // Returns the centroids persisted in the file at path. When the file is missing, or was trained for another
+    // dimension or nlist, the centroids are trained by k-means on the given vectors and the file is replaced.
+    // Concurrent calls for one path train only once.
+    Status
+    GetCentroids(const std::string& path, int64_t dimension, int64_t nlist, int64_t nb, const float* xb,
+                 IVFCentroidsPtr& centroids);
+
+    // drop the copy kept in memory, the file is left untouched
+    void
+    EraseCentroids(const std::string& path);
+
+ private:
+    IVFCentroidsMgr() = default;
+
+    Status
+    ReadCentroids(const std::string& path, IVFCentroidsPtr& centroids);
+
+    Status
+    WriteCentroids(const std::string& path, const IVFCentroidsPtr& centroids);
+
+ private:
+    std::mutex mutex_;
+    std::unordered_map<std::string, IVFCentroidsPtr> centroids_;
+    std::unordered_map<std::string, std::shared_ptr<std::mutex>> path_mutexes_;
+};
+
+}  // namespace engine
+}  // namespace milvus
@@ -14,6 +14,7 @@
 #include <memory>
 #include <set>
 #include <string>
+#include <vector>
 
 #include "db/Types.h"
 #include "utils/Status.h"
@@ -49,6 +50,10 @@ class MemManager {
     virtual Status
     EraseMemVector(const std::string& table_id) = 0;
 
+    virtual Status
+    Search(const std::vector<std::string>& table_ids, uint64_t k, const VectorsData& vectors, bool ascending,
+           ResultIds& result_ids, ResultDistances& result_distances, std::set<std::string>& segment_ids) = 0;
+
     virtual size_t
     GetCurrentMutableMem() = 0;
 
@@ -57,6 +62,11 @@ class MemManager {
 
     virtual size_t
     GetCurrentMem() = 0;
+
+    // a forced flush stamps every table with the highest lsn buffered, callers applying records out of lsn order
+    // hold it back and flush by themselves once all records up to that lsn are applied
+    virtual void
+    HoldForceFlush(bool hold) = 0;
 };  // MemManagerAbstract
 
 using MemManagerPtr = std::shared_ptr<MemManager>;
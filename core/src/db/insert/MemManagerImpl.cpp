@@ -11,31 +11,41 @@
 
 #include "db/insert/MemManagerImpl.h"
 
+#include <algorithm>
+#include <future>
 #include <thread>
 
 #include "VectorSource.h"
 #include "db/Constants.h"
 #include "utils/Log.h"
+#include "utils/ThreadPool.h"
 
 namespace milvus {
 namespace engine {
 
-MemTablePtr
-MemManagerImpl::GetMemByTable(const std::string& table_id) {
-    auto memIt = mem_id_map_.find(table_id);
-    if (memIt != mem_id_map_.end()) {
-        return memIt->second;
+MemManagerImpl::TableMemPtr
+MemManagerImpl::GetTableMem(const std::string& table_id) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto& table = table_mem_map_[table_id];
+    if (table == nullptr) {
+        table = std::make_shared<TableMem>();
     }
+    return table;
+}
 
-    mem_id_map_[table_id] = std::make_shared<MemTable>(table_id, meta_, options_);
-    return mem_id_map_[table_id];
+MemTablePtr
+MemManagerImpl::GetMemNoLock(const std::string& table_id, const TableMemPtr& table) {
+    if (table->mem_ == nullptr) {
+        table->mem_ = std::make_shared<MemTable>(table_id, meta_, options_);
+    }
+    return table->mem_;
 }
 
 Status
 MemManagerImpl::InsertVectors(const std::string& table_id, int64_t length, const IDNumber* vector_ids, int64_t dim,
                               const float* vectors, uint64_t lsn, std::set<std::string>& flushed_tables) {
     flushed_tables.clear();
-    if (GetCurrentMem() > options_.insert_buffer_size_) {
+    if (!hold_force_flush_ && GetCurrentMem() > options_.insert_buffer_size_) {
         ENGINE_LOG_DEBUG << "Insert buffer size exceeds limit. Performing force flush";
         // TODO(zhiru): Don't apply delete here in order to avoid possible concurrency issues with Merge
         auto status = Flush(flushed_tables, false);
@@ -44,24 +54,17 @@ MemManagerImpl::InsertVectors(const std::string& table_id, int64_t length, const
         }
     }
 
-    VectorsData vectors_data;
-    vectors_data.vector_count_ = length;
-    vectors_data.float_data_.resize(length * dim);
-    memcpy(vectors_data.float_data_.data(), vectors, length * dim * sizeof(float));
-    vectors_data.id_array_.resize(length);
-    memcpy(vectors_data.id_array_.data(), vector_ids, length * sizeof(IDNumber));
-    VectorSourcePtr source = std::make_shared<VectorSource>(vectors_data);
-
-    std::unique_lock<std::mutex> lock(mutex_);
+    // the source borrows the caller's buffers, they are appended into the segment buffer before returning
+    VectorSourcePtr source = std::make_shared<VectorSource>(length, vector_ids, vectors);
 
-    return InsertVectorsNoLock(table_id, source, lsn);
+    return InsertVectors(table_id, source, lsn);
 }
 
 Status
 MemManagerImpl::InsertVectors(const std::string& table_id, int64_t length, const IDNumber* vector_ids, int64_t dim,
                               const uint8_t* vectors, uint64_t lsn, std::set<std::string>& flushed_tables) {
     flushed_tables.clear();
-    if (GetCurrentMem() > options_.insert_buffer_size_) {
+    if (!hold_force_flush_ && GetCurrentMem() > options_.insert_buffer_size_) {
         ENGINE_LOG_DEBUG << "Insert buffer size exceeds limit. Performing force flush";
         // TODO(zhiru): Don't apply delete here in order to avoid possible concurrency issues with Merge
         auto status = Flush(flushed_tables, false);
@@ -70,32 +73,28 @@ MemManagerImpl::InsertVectors(const std::string& table_id, int64_t length, const
         }
     }
 
-    VectorsData vectors_data;
-    vectors_data.vector_count_ = length;
-    vectors_data.binary_data_.resize(length * dim);
-    memcpy(vectors_data.binary_data_.data(), vectors, length * dim * sizeof(uint8_t));
-    vectors_data.id_array_.resize(length);
-    memcpy(vectors_data.id_array_.data(), vector_ids, length * sizeof(IDNumber));
-    VectorSourcePtr source = std::make_shared<VectorSource>(vectors_data);
-
-    std::unique_lock<std::mutex> lock(mutex_);
+    VectorSourcePtr source = std::make_shared<VectorSource>(length, vector_ids, vectors);
 
-    return InsertVectorsNoLock(table_id, source, lsn);
+    return InsertVectors(table_id, source, lsn);
 }
 
 Status
-MemManagerImpl::InsertVectorsNoLock(const std::string& table_id, const VectorSourcePtr& source, uint64_t lsn) {
-    MemTablePtr mem = GetMemByTable(table_id);
+MemManagerImpl::InsertVectors(const std::string& table_id, const VectorSourcePtr& source, uint64_t lsn) {
+    auto table = GetTableMem(table_id);
+    std::lock_guard<std::mutex> lock(table->mutex_);
+    auto mem = GetMemNoLock(table_id, table);
     mem->SetLSN(lsn);
 
     auto status = mem->Add(source);
+    table->mem_size_ = mem->GetCurrentMem();
     return status;
 }
 
 Status
 MemManagerImpl::DeleteVector(const std::string& table_id, IDNumber vector_id, uint64_t lsn) {
-    std::unique_lock<std::mutex> lock(mutex_);
-    MemTablePtr mem = GetMemByTable(table_id);
+    auto table = GetTableMem(table_id);
+    std::lock_guard<std::mutex> lock(table->mutex_);
+    auto mem = GetMemNoLock(table_id, table);
     mem->SetLSN(lsn);
     auto status = mem->Delete(vector_id);
     return status;
@@ -103,14 +102,15 @@ MemManagerImpl::DeleteVector(const std::string& table_id, IDNumber vector_id, ui
 
 Status
 MemManagerImpl::DeleteVectors(const std::string& table_id, int64_t length, const IDNumber* vector_ids, uint64_t lsn) {
-    std::unique_lock<std::mutex> lock(mutex_);
-    MemTablePtr mem = GetMemByTable(table_id);
-    mem->SetLSN(lsn);
-
     IDNumbers ids;
     ids.resize(length);
     memcpy(ids.data(), vector_ids, length * sizeof(IDNumber));
 
+    auto table = GetTableMem(table_id);
+    std::lock_guard<std::mutex> lock(table->mutex_);
+    auto mem = GetMemNoLock(table_id, table);
+    mem->SetLSN(lsn);
+
     auto status = mem->Delete(ids);
     if (!status.ok()) {
         return status;
@@ -129,108 +129,191 @@ MemManagerImpl::DeleteVectors(const std::string& table_id, int64_t length, const
 
 Status
 MemManagerImpl::Flush(const std::string& table_id, bool apply_delete) {
-    ToImmutable(table_id);
-    // TODO: There is actually only one memTable in the immutable list
-    MemList temp_immutable_list;
-    {
-        std::unique_lock<std::mutex> lock(mutex_);
-        immu_mem_list_.swap(temp_immutable_list);
-    }
+    SealedList sealed;
+    ToImmutable(table_id, sealed);
 
-    std::unique_lock<std::mutex> lock(serialization_mtx_);
-    auto max_lsn = GetMaxLSN(temp_immutable_list);
-    for (auto& mem : temp_immutable_list) {
-        ENGINE_LOG_DEBUG << "Flushing table: " << mem->GetTableId();
-        auto status = mem->Serialize(max_lsn, apply_delete);
-        if (!status.ok()) {
-            ENGINE_LOG_ERROR << "Flush table " << mem->GetTableId() << " failed";
-            return status;
-        }
-        ENGINE_LOG_DEBUG << "Flushed table: " << mem->GetTableId();
+    std::set<std::string> table_ids;
+    return Serialize(sealed, apply_delete, table_ids);
+}
+
+Status
+MemManagerImpl::Flush(std::set<std::string>& table_ids, bool apply_delete) {
+    std::lock_guard<std::mutex> flush_lock(flush_mutex_);
+    SealedList sealed;
+    ToImmutable(sealed);
+
+    table_ids.clear();
+    auto status = Serialize(sealed, apply_delete, table_ids);
+    if (!status.ok()) {
+        return status;
     }
 
+    meta_->SetGlobalLastLSN(GetMaxLSN(sealed));
+
     return Status::OK();
 }
 
 Status
-MemManagerImpl::Flush(std::set<std::string>& table_ids, bool apply_delete) {
-    ToImmutable();
+MemManagerImpl::Serialize(const SealedList& sealed, bool apply_delete, std::set<std::string>& table_ids) {
+    auto max_lsn = GetMaxLSN(sealed);
+
+    // a flush seals every table at most once, so the tables are serialized concurrently, each task waits only
+    // for earlier flushes of its own table, which run on their callers' threads
+    std::vector<Status> statuses(sealed.size());
+    if (sealed.size() <= 1) {
+        for (size_t i = 0; i < sealed.size(); ++i) {
+            statuses[i] = SerializeTable(sealed[i], max_lsn, apply_delete);
+        }
+    } else {
+        ThreadPool pool(std::min<size_t>(sealed.size(), MAX_FLUSH_CONCURRENCY));
+        std::vector<std::future<Status>> futures;
+        for (auto& item : sealed) {
+            futures.emplace_back(pool.enqueue([&, this]() { return SerializeTable(item, max_lsn, apply_delete); }));
+        }
+        for (size_t i = 0; i < futures.size(); ++i) {
+            statuses[i] = futures[i].get();
+        }
+    }
+    UnmarkFlushing(sealed);
+
+    Status status;
+    for (size_t i = 0; i < sealed.size(); ++i) {
+        if (statuses[i].ok()) {
+            table_ids.insert(sealed[i].mem_->GetTableId());
+        } else if (status.ok()) {
+            status = statuses[i];
+        }
+    }
 
-    MemList temp_immutable_list;
+    return status;
+}
+
+Status
+MemManagerImpl::SerializeTable(const SealedMem& item, uint64_t max_lsn, bool apply_delete) {
+    auto& table = item.table_;
     {
-        std::unique_lock<std::mutex> lock(mutex_);
-        immu_mem_list_.swap(temp_immutable_list);
+        std::unique_lock<std::mutex> lock(table->serialize_mutex_);
+        table->serialize_cv_.wait(lock, [&] { return table->serialized_ticket_ + 1 == item.ticket_; });
     }
 
-    std::unique_lock<std::mutex> lock(serialization_mtx_);
-    table_ids.clear();
-    auto max_lsn = GetMaxLSN(temp_immutable_list);
-    for (auto& mem : temp_immutable_list) {
-        ENGINE_LOG_DEBUG << "Flushing table: " << mem->GetTableId();
-        auto status = mem->Serialize(max_lsn, apply_delete);
-        if (!status.ok()) {
-            ENGINE_LOG_ERROR << "Flush table " << mem->GetTableId() << " failed";
-            return status;
-        }
-        table_ids.insert(mem->GetTableId());
-        ENGINE_LOG_DEBUG << "Flushed table: " << mem->GetTableId();
+    ENGINE_LOG_DEBUG << "Flushing table: " << item.mem_->GetTableId();
+    auto status = item.mem_->Serialize(max_lsn, apply_delete);
+    if (status.ok()) {
+        ENGINE_LOG_DEBUG << "Flushed table: " << item.mem_->GetTableId();
+    } else {
+        ENGINE_LOG_ERROR << "Flush table " << item.mem_->GetTableId() << " failed";
     }
 
-    meta_->SetGlobalLastLSN(max_lsn);
+    // the ticket is passed on even after a failure, so later flushes of the table are not blocked
+    {
+        std::lock_guard<std::mutex> lock(table->serialize_mutex_);
+        table->serialized_ticket_ = item.ticket_;
+    }
+    table->serialize_cv_.notify_all();
 
-    return Status::OK();
+    return status;
 }
 
-Status
-MemManagerImpl::ToImmutable(const std::string& table_id) {
-    std::unique_lock<std::mutex> lock(mutex_);
-    auto memIt = mem_id_map_.find(table_id);
-    if (memIt != mem_id_map_.end()) {
-        if (!memIt->second->Empty()) {
-            immu_mem_list_.push_back(memIt->second);
-            mem_id_map_.erase(memIt);
+void
+MemManagerImpl::SealNoLock(const TableMemPtr& table, SealedList& sealed) {
+    if (table->mem_ == nullptr || table->mem_->Empty()) {
+        // empty table without any deletes, no need to serialize
+        return;
+    }
+
+    {
+        // searchable as flushing before it leaves the table
+        std::lock_guard<std::mutex> lock(mutex_);
+        flushing_mem_list_.push_back(table->mem_);
+    }
+    sealed.push_back({table, table->mem_, ++table->seal_ticket_});
+    table->mem_ = nullptr;
+    table->mem_size_ = 0;
+}
+
+void
+MemManagerImpl::ToImmutable(const std::string& table_id, SealedList& sealed) {
+    TableMemPtr table;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto iter = table_mem_map_.find(table_id);
+        if (iter == table_mem_map_.end()) {
+            return;
         }
-        //        std::string err_msg = "Could not find table = " + table_id + " to flush";
-        //        ENGINE_LOG_ERROR << err_msg;
-        //        return Status(DB_NOT_FOUND, err_msg);
+        table = iter->second;
     }
 
-    return Status::OK();
+    std::lock_guard<std::mutex> lock(table->mutex_);
+    SealNoLock(table, sealed);
 }
 
-Status
-MemManagerImpl::ToImmutable() {
-    std::unique_lock<std::mutex> lock(mutex_);
-    MemIdMap temp_map;
-    for (auto& kv : mem_id_map_) {
-        if (kv.second->Empty()) {
-            // empty table without any deletes, no need to serialize
-            temp_map.insert(kv);
-        } else {
-            immu_mem_list_.push_back(kv.second);
+void
+MemManagerImpl::ToImmutable(SealedList& sealed) {
+    // tables are sealed in table id order, so concurrent flushes wait for each other's tickets in the same order
+    std::vector<TableMemPtr> tables;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (auto& kv : table_mem_map_) {
+            tables.push_back(kv.second);
         }
     }
 
-    mem_id_map_.swap(temp_map);
-    return Status::OK();
+    for (auto& table : tables) {
+        std::lock_guard<std::mutex> lock(table->mutex_);
+        SealNoLock(table, sealed);
+    }
 }
 
 Status
 MemManagerImpl::EraseMemVector(const std::string& table_id) {
-    {  // erase MemVector from rapid-insert cache
-        std::unique_lock<std::mutex> lock(mutex_);
-        mem_id_map_.erase(table_id);
+    // erase MemVector from rapid-insert cache
+    std::lock_guard<std::mutex> lock(mutex_);
+    table_mem_map_.erase(table_id);
+
+    return Status::OK();
+}
+
+Status
+MemManagerImpl::Search(const std::vector<std::string>& table_ids, uint64_t k, const VectorsData& vectors,
+                       bool ascending, ResultIds& result_ids, ResultDistances& result_distances,
+                       std::set<std::string>& segment_ids) {
+    // collect mutable and flushing tables, the search itself doesn't block other tables
+    std::vector<TableMemPtr> table_mems;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (auto& table_id : table_ids) {
+            auto iter = table_mem_map_.find(table_id);
+            if (iter != table_mem_map_.end()) {
+                table_mems.push_back(iter->second);
+            }
+        }
+    }
+
+    MemList tables;
+    for (auto& table : table_mems) {
+        std::lock_guard<std::mutex> lock(table->mutex_);
+        if (table->mem_ != nullptr) {
+            tables.push_back(table->mem_);
+        }
     }
 
-    {  // erase MemVector from serialize cache
-        std::unique_lock<std::mutex> lock(serialization_mtx_);
-        MemList temp_list;
-        for (auto& mem : immu_mem_list_) {
-            if (mem->GetTableId() != table_id) {
-                temp_list.push_back(mem);
+    {
+        // a table sealed after it was collected above is in the flushing list too, search it once
+        std::set<std::string> table_id_set(table_ids.begin(), table_ids.end());
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (auto& mem : flushing_mem_list_) {
+            if (table_id_set.find(mem->GetTableId()) != table_id_set.end() &&
+                std::find(tables.begin(), tables.end(), mem) == tables.end()) {
+                tables.push_back(mem);
             }
         }
-        immu_mem_list_.swap(temp_list);
+    }
+
+    for (auto& mem : tables) {
+        auto status = mem->Search(k, vectors, ascending, result_ids, result_distances, segment_ids);
+        if (!status.ok()) {
+            return status;
+        }
     }
 
     return Status::OK();
@@ -239,19 +322,23 @@ MemManagerImpl::EraseMemVector(const std::string& table_id) {
 size_t
 MemManagerImpl::GetCurrentMutableMem() {
     size_t total_mem = 0;
-    std::unique_lock<std::mutex> lock(mutex_);
-    for (auto& kv : mem_id_map_) {
-        auto memTable = kv.second;
-        total_mem += memTable->GetCurrentMem();
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (auto& kv : table_mem_map_) {
+        total_mem += kv.second->mem_size_;
     }
     return total_mem;
 }
 
 size_t
 MemManagerImpl::GetCurrentImmutableMem() {
+    MemList flushing;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        flushing = flushing_mem_list_;
+    }
+
     size_t total_mem = 0;
-    std::unique_lock<std::mutex> lock(serialization_mtx_);
-    for (auto& mem_table : immu_mem_list_) {
+    for (auto& mem_table : flushing) {
         total_mem += mem_table->GetCurrentMem();
     }
     return total_mem;
@@ -262,12 +349,28 @@ MemManagerImpl::GetCurrentMem() {
     return GetCurrentMutableMem() + GetCurrentImmutableMem();
 }
 
+void
+MemManagerImpl::HoldForceFlush(bool hold) {
+    hold_force_flush_ = hold;
+}
+
+void
+MemManagerImpl::UnmarkFlushing(const SealedList& sealed) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (auto& item : sealed) {
+        auto iter = std::find(flushing_mem_list_.begin(), flushing_mem_list_.end(), item.mem_);
+        if (iter != flushing_mem_list_.end()) {
+            flushing_mem_list_.erase(iter);
+        }
+    }
+}
+
 uint64_t
-MemManagerImpl::GetMaxLSN(const MemList& tables) {
+MemManagerImpl::GetMaxLSN(const SealedList& sealed) {
     uint64_t max_lsn = 0;
-    for (auto& table : tables) {
-        auto cur_lsn = table->GetLSN();
-        if (table->GetLSN() > max_lsn) {
+    for (auto& item : sealed) {
+        auto cur_lsn = item.mem_->GetLSN();
+        if (cur_lsn > max_lsn) {
             max_lsn = cur_lsn;
         }
     }
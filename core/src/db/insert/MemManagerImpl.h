@@ -11,6 +11,8 @@
 
 #pragma once
 
+#include <atomic>
+#include <condition_variable>
 #include <ctime>
 #include <map>
 #include <memory>
@@ -31,7 +33,6 @@ namespace engine {
 class MemManagerImpl : public MemManager {
  public:
     using Ptr = std::shared_ptr<MemManagerImpl>;
-    using MemIdMap = std::map<std::string, MemTablePtr>;
     using MemList = std::vector<MemTablePtr>;
 
     MemManagerImpl(const meta::MetaPtr& meta, const DBOptions& options) : meta_(meta), options_(options) {
@@ -83,6 +84,10 @@ class MemManagerImpl : public MemManager {
     Status
     EraseMemVector(const std::string& table_id) override;
 
+    Status
+    Search(const std::vector<std::string>& table_ids, uint64_t k, const VectorsData& vectors, bool ascending,
+           ResultIds& result_ids, ResultDistances& result_distances, std::set<std::string>& segment_ids) override;
+
     size_t
     GetCurrentMutableMem() override;
 
@@ -92,29 +97,72 @@ class MemManagerImpl : public MemManager {
     size_t
     GetCurrentMem() override;
 
+    void
+    HoldForceFlush(bool hold) override;
+
  private:
+    // insert buffer of one table, the mutex serializes writes to the table with sealing its buffer for flush,
+    // so writes to different tables never wait for each other
+    struct TableMem {
+        std::mutex mutex_;
+        MemTablePtr mem_;                  // mutable buffer, created by the first write after a flush
+        std::atomic<size_t> mem_size_{0};  // size of mem_, readable without the mutex
+        uint64_t seal_ticket_ = 0;         // number of buffers sealed for flush so far
+
+        // sealed buffers of a table are serialized one by one in the order they were sealed
+        std::mutex serialize_mutex_;
+        std::condition_variable serialize_cv_;
+        uint64_t serialized_ticket_ = 0;
+    };
+    using TableMemPtr = std::shared_ptr<TableMem>;
+
+    struct SealedMem {
+        TableMemPtr table_;
+        MemTablePtr mem_;
+        uint64_t ticket_;
+    };
+    using SealedList = std::vector<SealedMem>;
+
+    TableMemPtr
+    GetTableMem(const std::string& table_id);
+
+    // mutable buffer of the table, created if absent, the caller holds table->mutex_
     MemTablePtr
-    GetMemByTable(const std::string& table_id);
+    GetMemNoLock(const std::string& table_id, const TableMemPtr& table);
 
     Status
-    InsertVectorsNoLock(const std::string& table_id, const VectorSourcePtr& source, uint64_t lsn);
+    InsertVectors(const std::string& table_id, const VectorSourcePtr& source, uint64_t lsn);
+
+    void
+    SealNoLock(const TableMemPtr& table, SealedList& sealed);
+
+    void
+    ToImmutable(SealedList& sealed);
+
+    void
+    ToImmutable(const std::string& table_id, SealedList& sealed);
 
     Status
-    ToImmutable();
+    Serialize(const SealedList& sealed, bool apply_delete, std::set<std::string>& table_ids);
 
+    // waits for the earlier sealed buffers of the table, then writes this one
     Status
-    ToImmutable(const std::string& table_id);
+    SerializeTable(const SealedMem& item, uint64_t max_lsn, bool apply_delete);
 
     uint64_t
-    GetMaxLSN(const MemList& tables);
+    GetMaxLSN(const SealedList& sealed);
+
+    void
+    UnmarkFlushing(const SealedList& sealed);
 
     std::string identity_;
-    MemIdMap mem_id_map_;
-    MemList immu_mem_list_;
+    std::map<std::string, TableMemPtr> table_mem_map_;
+    MemList flushing_mem_list_;  // sealed tables being serialized, still searchable until flush finishes
     meta::MetaPtr meta_;
     DBOptions options_;
-    std::mutex mutex_;
-    std::mutex serialization_mtx_;
+    std::mutex mutex_;        // protects table_mem_map_ and flushing_mem_list_ only
+    std::mutex flush_mutex_;  // flushes of all tables run one at a time
+    std::atomic<bool> hold_force_flush_{false};
 };  // NewMemManager
 
 }  // namespace engine
@@ -17,13 +17,18 @@
 
 #include <algorithm>
 #include <chrono>
+#include <future>
 #include <memory>
 #include <string>
 #include <unordered_map>
+#include <unordered_set>
 
+#include "db/Constants.h"
 #include "db/OngoingFileChecker.h"
 #include "db/Utils.h"
+#include "scheduler/task/SearchTask.h"
 #include "utils/Log.h"
+#include "utils/ThreadPool.h"
 
 namespace milvus {
 namespace engine {
@@ -34,6 +39,7 @@ MemTable::MemTable(const std::string& table_id, const meta::MetaPtr& meta, const
 
 Status
 MemTable::Add(const VectorSourcePtr& source) {
+    std::lock_guard<std::mutex> lock(mutex_);
     while (!source->AllAdded()) {
         MemTableFilePtr current_mem_table_file;
         if (!mem_table_file_list_.empty()) {
@@ -62,6 +68,7 @@ MemTable::Add(const VectorSourcePtr& source) {
 
 Status
 MemTable::Delete(segment::doc_id_t doc_id) {
+    std::lock_guard<std::mutex> lock(mutex_);
     // Locate which table file the doc id lands in
     for (auto& table_file : mem_table_file_list_) {
         table_file->Delete(doc_id);
@@ -74,6 +81,7 @@ MemTable::Delete(segment::doc_id_t doc_id) {
 
 Status
 MemTable::Delete(const std::vector<segment::doc_id_t>& doc_ids) {
+    std::lock_guard<std::mutex> lock(mutex_);
     // Locate which table file the doc id lands in
     for (auto& table_file : mem_table_file_list_) {
         table_file->Delete(doc_ids);
@@ -107,17 +115,52 @@ MemTable::Serialize(uint64_t wal_lsn, bool apply_delete) {
         }
     }
 
-    for (auto mem_table_file = mem_table_file_list_.begin(); mem_table_file != mem_table_file_list_.end();) {
-        auto status = (*mem_table_file)->Serialize(wal_lsn);
-        if (!status.ok()) {
-            return status;
+    // segments are written to disk concurrently, then registered in meta within one transaction
+    std::vector<MemTableFilePtr> mem_table_files;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        mem_table_files.assign(mem_table_file_list_.begin(), mem_table_file_list_.end());
+    }
+
+    if (!mem_table_files.empty()) {
+        std::vector<Status> statuses(mem_table_files.size());
+        if (mem_table_files.size() == 1) {
+            statuses[0] = mem_table_files[0]->WriteSegment(wal_lsn);
+        } else {
+            ThreadPool pool(std::min<size_t>(mem_table_files.size(), MAX_FLUSH_CONCURRENCY));
+            std::vector<std::future<Status>> futures;
+            for (auto& mem_table_file : mem_table_files) {
+                futures.emplace_back(pool.enqueue(&MemTableFile::WriteSegment, mem_table_file.get(), wal_lsn));
+            }
+            for (size_t i = 0; i < futures.size(); ++i) {
+                statuses[i] = futures[i].get();
+            }
+        }
+
+        for (auto& status : statuses) {
+            if (!status.ok()) {
+                return status;
+            }
         }
 
-        ENGINE_LOG_DEBUG << "Flushed segment " << (*mem_table_file)->GetSegmentId();
+        meta::TableFilesSchema table_files;
+        for (auto& mem_table_file : mem_table_files) {
+            table_files.push_back(mem_table_file->GetTableFileSchema());
+        }
+        auto status = meta_->UpdateTableFiles(table_files);
+        if (!status.ok()) {
+            std::string err_msg = "Failed to update flushed files in meta: " + status.ToString();
+            ENGINE_LOG_ERROR << err_msg;
+            return Status(DB_ERROR, err_msg);
+        }
 
-        {
-            std::lock_guard<std::mutex> lock(mutex_);
-            mem_table_file = mem_table_file_list_.erase(mem_table_file);
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (auto& mem_table_file : mem_table_files) {
+            ENGINE_LOG_DEBUG << "Flushed segment " << mem_table_file->GetSegmentId();
+            auto iter = std::find(mem_table_file_list_.begin(), mem_table_file_list_.end(), mem_table_file);
+            if (iter != mem_table_file_list_.end()) {
+                mem_table_file_list_.erase(iter);
+            }
         }
     }
 
@@ -136,6 +179,39 @@ MemTable::Serialize(uint64_t wal_lsn, bool apply_delete) {
     return Status::OK();
 }
 
+Status
+MemTable::Search(uint64_t k, const VectorsData& vectors, bool ascending, ResultIds& result_ids,
+                 ResultDistances& result_distances, std::set<std::string>& segment_ids) {
+    // only borrow the buffers under the lock, writes to the table go on while they are searched
+    std::vector<MemTableFile::BufferSnapshotPtr> snapshots;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (auto& mem_table_file : mem_table_file_list_) {
+            segment_ids.insert(mem_table_file->GetSegmentId());
+            auto snapshot = mem_table_file->GetSnapshot();
+            if (snapshot != nullptr) {
+                snapshots.push_back(snapshot);
+            }
+        }
+    }
+
+    for (auto& snapshot : snapshots) {
+        ResultIds file_ids;
+        ResultDistances file_distances;
+        uint64_t file_k = 0;
+        auto status = MemTableFile::Search(*snapshot, k, vectors, file_ids, file_distances, file_k);
+        if (!status.ok()) {
+            ENGINE_LOG_ERROR << "Failed to search buffered vectors of table " << table_id_ << ": " << status.message();
+            return status;
+        }
+
+        scheduler::XSearchTask::MergeTopkToResultSet(file_ids, file_distances, file_k, vectors.vector_count_, k,
+                                                     ascending, result_ids, result_distances);
+    }
+
+    return Status::OK();
+}
+
 bool
 MemTable::Empty() {
     return mem_table_file_list_.empty() && doc_ids_to_delete_.empty();
@@ -158,27 +234,23 @@ MemTable::GetCurrentMem() {
 
 Status
 MemTable::ApplyDeletes() {
-    // Applying deletes to other segments on disk and their corresponding cache:
-    // For each segment in table:
+    // Applying deletes to other segments on disk and their corresponding cache, each segment by its own task:
     //     Load its bloom filter
     //     For each id in delete list:
     //         If present, add the uid to segment's uid list
-    // For each segment
-    //     Get its cache if exists
-    //     Load its uids file.
-    //     Scan the uids, if any uid in segment's uid list exists:
-    //         add its offset to deletedDoc
-    //         remove the id from bloom filter
-    //         set black list in cache
-    //     Serialize segment's deletedDoc TODO(zhiru): append directly to previous file for now, may have duplicates
-    //     Serialize bloom filter
+    //     If the list isn't empty:
+    //         Load its uids, shared with the segment cache
+    //         Scan the uids, if any uid in segment's uid list exists and isn't deleted yet:
+    //             add its offset to deletedDoc
+    //             set black list of the cached index in place
+    //         Serialize segment's deletedDoc
+    //     The bloom filter is left as is, deleted ids are filtered out by deletedDoc
+    // Then update row counts of all touched segments in meta within one transaction
 
     ENGINE_LOG_DEBUG << "Applying " << doc_ids_to_delete_.size() << " deletes in table: " << table_id_;
 
     auto start_total = std::chrono::high_resolution_clock::now();
 
-    auto start = std::chrono::high_resolution_clock::now();
-
     std::vector<int> file_types{meta::TableFileSchema::FILE_TYPE::RAW, meta::TableFileSchema::FILE_TYPE::TO_INDEX,
                                 meta::TableFileSchema::FILE_TYPE::BACKUP};
     meta::TableFilesSchema table_files;
@@ -191,188 +263,162 @@ MemTable::ApplyDeletes() {
 
     OngoingFileChecker::GetInstance().MarkOngoingFiles(table_files);
 
-    std::unordered_map<size_t, std::vector<segment::doc_id_t>> ids_to_check_map;
-
-    for (size_t i = 0; i < table_files.size(); ++i) {
-        auto& table_file = table_files[i];
-        std::string segment_dir;
-        utils::GetParentPath(table_file.location_, segment_dir);
-
-        segment::SegmentReader segment_reader(segment_dir);
-        segment::IdBloomFilterPtr id_bloom_filter_ptr;
-        segment_reader.LoadBloomFilter(id_bloom_filter_ptr);
-
-        for (auto& id : doc_ids_to_delete_) {
-            if (id_bloom_filter_ptr->Check(id)) {
-                ids_to_check_map[i].emplace_back(id);
-            }
+    std::vector<segment::doc_id_t> ids_to_delete(doc_ids_to_delete_.begin(), doc_ids_to_delete_.end());
+    std::vector<size_t> delete_counts(table_files.size(), 0);
+    std::vector<Status> statuses(table_files.size());
+    if (!table_files.empty()) {
+        // runs inside a flush pool worker, keep the nested pool as small as the flush pool itself
+        ThreadPool pool(std::min<size_t>(table_files.size(), MAX_FLUSH_CONCURRENCY));
+        std::vector<std::future<Status>> futures;
+        for (size_t i = 0; i < table_files.size(); ++i) {
+            futures.emplace_back(pool.enqueue(
+                [&, i, this]() { return ApplyDeletesToSegment(table_files[i], ids_to_delete, delete_counts[i]); }));
+        }
+        for (size_t i = 0; i < futures.size(); ++i) {
+            statuses[i] = futures[i].get();
         }
     }
 
-    meta::TableFilesSchema files_to_check;
-    for (auto& kv : ids_to_check_map) {
-        files_to_check.emplace_back(table_files[kv.first]);
-    }
-
-    OngoingFileChecker::GetInstance().UnmarkOngoingFiles(table_files);
-
-    OngoingFileChecker::GetInstance().MarkOngoingFiles(files_to_check);
-
-    auto end = std::chrono::high_resolution_clock::now();
-    std::chrono::duration<double> diff = end - start;
-    ENGINE_LOG_DEBUG << "Found " << ids_to_check_map.size() << " segment to apply deletes in " << diff.count() << " s";
+    // Update table file row count
+    auto start = std::chrono::high_resolution_clock::now();
 
     meta::TableFilesSchema table_files_to_update;
-
-    for (auto& kv : ids_to_check_map) {
-        auto& table_file = table_files[kv.first];
-        ENGINE_LOG_DEBUG << "Applying deletes in segment: " << table_file.segment_id_;
-
-        start = std::chrono::high_resolution_clock::now();
-
-        std::string segment_dir;
-        utils::GetParentPath(table_file.location_, segment_dir);
-        segment::SegmentReader segment_reader(segment_dir);
-
-        auto index =
-            std::static_pointer_cast<VecIndex>(cache::CpuCacheMgr::GetInstance()->GetIndex(table_file.location_));
-        faiss::ConcurrentBitsetPtr blacklist = nullptr;
-        if (index != nullptr) {
-            status = index->GetBlacklist(blacklist);
+    for (size_t i = 0; i < table_files.size() && status.ok(); ++i) {
+        status = statuses[i];
+        if (!status.ok() || delete_counts[i] == 0) {
+            continue;
         }
 
-        std::vector<segment::doc_id_t> uids;
-        status = segment_reader.LoadUids(uids);
+        meta::TableFilesSchema segment_files;
+        status = meta_->GetTableFilesBySegmentId(table_files[i].segment_id_, segment_files);
         if (!status.ok()) {
             break;
         }
-        segment::IdBloomFilterPtr id_bloom_filter_ptr;
-        status = segment_reader.LoadBloomFilter(id_bloom_filter_ptr);
-        if (!status.ok()) {
-            break;
+        for (auto& file : segment_files) {
+            if (file.file_type_ == meta::TableFileSchema::RAW || file.file_type_ == meta::TableFileSchema::TO_INDEX ||
+                file.file_type_ == meta::TableFileSchema::INDEX || file.file_type_ == meta::TableFileSchema::BACKUP) {
+                file.row_count_ -= delete_counts[i];
+                table_files_to_update.emplace_back(file);
+            }
         }
+    }
 
-        auto& ids_to_check = kv.second;
-
-        segment::DeletedDocsPtr deleted_docs = std::make_shared<segment::DeletedDocs>();
-
-        end = std::chrono::high_resolution_clock::now();
-        diff = end - start;
-        ENGINE_LOG_DEBUG << "Loading uids and deleted docs took " << diff.count() << " s";
-
-        start = std::chrono::high_resolution_clock::now();
-
-        std::sort(ids_to_check.begin(), ids_to_check.end());
-
-        end = std::chrono::high_resolution_clock::now();
-        diff = end - start;
-        ENGINE_LOG_DEBUG << "Sorting " << ids_to_check.size() << " ids took " << diff.count() << " s";
+    if (status.ok()) {
+        status = meta_->UpdateTableFiles(table_files_to_update);
+    }
 
-        size_t delete_count = 0;
-        auto find_diff = std::chrono::duration<double>::zero();
-        auto set_diff = std::chrono::duration<double>::zero();
+    auto end = std::chrono::high_resolution_clock::now();
+    std::chrono::duration<double> diff = end - start;
+    ENGINE_LOG_DEBUG << "Updated meta in table: " << table_id_ << " in " << diff.count() << " s";
 
-        for (size_t i = 0; i < uids.size(); ++i) {
-            auto find_start = std::chrono::high_resolution_clock::now();
+    OngoingFileChecker::GetInstance().UnmarkOngoingFiles(table_files);
 
-            auto found = std::binary_search(ids_to_check.begin(), ids_to_check.end(), uids[i]);
+    if (!status.ok()) {
+        std::string err_msg = "Failed to apply deletes: " + status.ToString();
+        ENGINE_LOG_ERROR << err_msg;
+        return Status(DB_ERROR, err_msg);
+    }
 
-            auto find_end = std::chrono::high_resolution_clock::now();
-            find_diff += (find_end - find_start);
+    doc_ids_to_delete_.clear();
 
-            if (found) {
-                auto set_start = std::chrono::high_resolution_clock::now();
+    auto end_total = std::chrono::high_resolution_clock::now();
+    std::chrono::duration<double> diff_total = end_total - start_total;
+    ENGINE_LOG_DEBUG << "Finished applying deletes in table " << table_id_ << " in " << diff_total.count() << " s";
 
-                delete_count++;
+    return Status::OK();
+}
 
-                deleted_docs->AddDeletedDoc(i);
+Status
+MemTable::ApplyDeletesToSegment(const meta::TableFileSchema& table_file,
+                                const std::vector<segment::doc_id_t>& ids_to_delete, size_t& delete_count) {
+    delete_count = 0;
 
-                if (id_bloom_filter_ptr->Check(uids[i])) {
-                    id_bloom_filter_ptr->Remove(uids[i]);
-                }
+    std::string segment_dir;
+    utils::GetParentPath(table_file.location_, segment_dir);
+    segment::SegmentReader segment_reader(segment_dir);
 
-                if (blacklist != nullptr) {
-                    if (!blacklist->test(i)) {
-                        blacklist->set(i);
-                    }
-                }
+    segment::IdBloomFilterPtr id_bloom_filter_ptr;
+    auto status = segment_reader.LoadBloomFilter(id_bloom_filter_ptr);
+    if (!status.ok()) {
+        return status;
+    }
 
-                auto set_end = std::chrono::high_resolution_clock::now();
-                set_diff += (set_end - set_start);
-            }
+    std::vector<uint8_t> maybe_present;
+    id_bloom_filter_ptr->Check(ids_to_delete.data(), ids_to_delete.size(), maybe_present);
+    std::unordered_set<segment::doc_id_t> ids_to_check;
+    for (size_t i = 0; i < ids_to_delete.size(); ++i) {
+        if (maybe_present[i]) {
+            ids_to_check.insert(ids_to_delete[i]);
         }
+    }
+    if (ids_to_check.empty()) {
+        return Status::OK();
+    }
 
-        ENGINE_LOG_DEBUG << "Finding " << ids_to_check.size() << " uids in " << uids.size() << " uids took "
-                         << find_diff.count() << " s in total";
-        ENGINE_LOG_DEBUG << "Setting deleted docs and bloom filter took " << set_diff.count() << " s in total";
+    ENGINE_LOG_DEBUG << "Applying deletes in segment: " << table_file.segment_id_;
 
-        if (index != nullptr) {
-            index->SetBlacklist(blacklist);
-        }
+    auto start = std::chrono::high_resolution_clock::now();
 
-        start = std::chrono::high_resolution_clock::now();
+    segment::UidsPtr uids_ptr;
+    status = segment_reader.LoadUids(uids_ptr);
+    if (!status.ok()) {
+        return status;
+    }
+    auto& uids = uids_ptr->GetUids();
 
-        segment::Segment tmp_segment;
-        segment::SegmentWriter segment_writer(segment_dir);
-        status = segment_writer.WriteDeletedDocs(deleted_docs);
-        if (!status.ok()) {
-            break;
+    // deleted ids are still in the bloom filter, don't delete and count them twice
+    segment::DeletedDocsPtr prev_deleted_docs;
+    status = segment_reader.LoadDeletedDocs(prev_deleted_docs);
+    if (!status.ok()) {
+        return status;
+    }
+    auto& prev_offsets = prev_deleted_docs->GetDeletedDocs();
+
+    // the blacklist of a cached index is shared with searches, bits are set in place
+    auto index =
+        std::static_pointer_cast<VecIndex>(cache::CpuCacheMgr::GetInstance()->GetIndex(table_file.location_));
+    faiss::ConcurrentBitsetPtr blacklist = nullptr;
+    if (index != nullptr) {
+        index->GetBlacklist(blacklist);
+    }
+
+    segment::DeletedDocsPtr deleted_docs = std::make_shared<segment::DeletedDocs>();
+    for (size_t i = 0; i < uids.size(); ++i) {
+        if (ids_to_check.find(uids[i]) == ids_to_check.end() ||
+            std::binary_search(prev_offsets.begin(), prev_offsets.end(), static_cast<segment::offset_t>(i))) {
+            continue;
         }
 
-        end = std::chrono::high_resolution_clock::now();
-        diff = end - start;
-        ENGINE_LOG_DEBUG << "Appended " << deleted_docs->GetSize()
-                         << " offsets to deleted docs in segment: " << table_file.segment_id_ << " in " << diff.count()
-                         << " s";
+        delete_count++;
 
-        start = std::chrono::high_resolution_clock::now();
+        deleted_docs->AddDeletedDoc(i);
 
-        status = segment_writer.WriteBloomFilter(id_bloom_filter_ptr);
-        if (!status.ok()) {
-            break;
+        if (blacklist != nullptr && !blacklist->test(i)) {
+            blacklist->set(i);
         }
-        end = std::chrono::high_resolution_clock::now();
-        diff = end - start;
-        ENGINE_LOG_DEBUG << "Updated bloom filter in segment: " << table_file.segment_id_ << " in " << diff.count()
-                         << " s";
+    }
 
-        // Update table file row count
-        start = std::chrono::high_resolution_clock::now();
+    auto end = std::chrono::high_resolution_clock::now();
+    std::chrono::duration<double> diff = end - start;
+    ENGINE_LOG_DEBUG << "Finding " << ids_to_check.size() << " uids in " << uids.size() << " uids took "
+                     << diff.count() << " s";
 
-        auto& segment_id = table_file.segment_id_;
-        meta::TableFilesSchema segment_files;
-        status = meta_->GetTableFilesBySegmentId(segment_id, segment_files);
-        if (!status.ok()) {
-            break;
-        }
-        for (auto& file : segment_files) {
-            if (file.file_type_ == meta::TableFileSchema::RAW || file.file_type_ == meta::TableFileSchema::TO_INDEX ||
-                file.file_type_ == meta::TableFileSchema::INDEX || file.file_type_ == meta::TableFileSchema::BACKUP) {
-                file.row_count_ -= delete_count;
-                table_files_to_update.emplace_back(file);
-            }
-        }
+    if (delete_count == 0) {
+        return Status::OK();
     }
 
-    end = std::chrono::high_resolution_clock::now();
-    diff = end - start;
-
-    status = meta_->UpdateTableFiles(table_files_to_update);
-    ENGINE_LOG_DEBUG << "Updated meta in table: " << table_id_ << " in " << diff.count() << " s";
+    start = std::chrono::high_resolution_clock::now();
 
+    segment::SegmentWriter segment_writer(segment_dir);
+    status = segment_writer.WriteDeletedDocs(deleted_docs);
     if (!status.ok()) {
-        std::string err_msg = "Failed to apply deletes: " + status.ToString();
-        ENGINE_LOG_ERROR << err_msg;
-        return Status(DB_ERROR, err_msg);
+        return status;
     }
 
-    doc_ids_to_delete_.clear();
-
-    auto end_total = std::chrono::high_resolution_clock::now();
-    std::chrono::duration<double> diff_total = end_total - start_total;
-    ENGINE_LOG_DEBUG << "Finished applying deletes in table " << table_id_ << " in " << diff_total.count() << " s";
-
-    OngoingFileChecker::GetInstance().UnmarkOngoingFiles(files_to_check);
+    end = std::chrono::high_resolution_clock::now();
+    diff = end - start;
+    ENGINE_LOG_DEBUG << "Appended " << deleted_docs->GetSize() << " offsets to deleted docs in segment: "
+                     << table_file.segment_id_ << " in " << diff.count() << " s";
 
     return Status::OK();
 }
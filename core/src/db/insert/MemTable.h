@@ -49,6 +49,12 @@ class MemTable {
     Status
     Serialize(uint64_t wal_lsn, bool apply_delete = true);
 
+    // merge topk of the buffered vectors into result_ids/result_distances, which are laid out as nq * result_k,
+    // and collect the segment ids of all searched table files
+    Status
+    Search(uint64_t k, const VectorsData& vectors, bool ascending, ResultIds& result_ids,
+           ResultDistances& result_distances, std::set<std::string>& segment_ids);
+
     bool
     Empty();
 
@@ -68,6 +74,11 @@ class MemTable {
     Status
     ApplyDeletes();
 
+    // called concurrently for the segments of the table, delete_count is the number of docs deleted in the segment
+    Status
+    ApplyDeletesToSegment(const meta::TableFileSchema& table_file, const std::vector<segment::doc_id_t>& ids_to_delete,
+                          size_t& delete_count);
+
  private:
     const std::string table_id_;
 
@@ -11,6 +11,11 @@
 
 #include "db/insert/MemTableFile.h"
 
+#include <faiss/utils/Heap.h>
+#include <faiss/utils/distances.h>
+#include <faiss/utils/hamming.h>
+#include <faiss/utils/jaccard.h>
+
 #include <algorithm>
 #include <cmath>
 #include <iterator>
@@ -19,7 +24,6 @@
 
 #include "db/Constants.h"
 #include "db/Utils.h"
-#include "db/engine/EngineFactory.h"
 #include "metrics/Metrics.h"
 #include "segment/SegmentReader.h"
 #include "utils/Log.h"
@@ -110,16 +114,16 @@ MemTableFile::Delete(const std::vector<segment::doc_id_t>& doc_ids) {
 
     std::sort(temp.begin(), temp.end());
 
-    auto uids = segment_ptr->vectors_ptr_->GetUids();
+    auto& uids = segment_ptr->vectors_ptr_->GetUids();
 
-    size_t deleted = 0;
-    size_t loop = uids.size();
-    for (size_t i = 0; i < loop; ++i) {
+    // erase all at once, the buffer is rebuilt once instead of shifted (or copied, while searched) per doc
+    std::vector<int32_t> offsets;
+    for (size_t i = 0; i < uids.size(); ++i) {
         if (std::binary_search(temp.begin(), temp.end(), uids[i])) {
-            segment_ptr->vectors_ptr_->Erase(i - deleted);
-            ++deleted;
+            offsets.push_back(i);
         }
     }
+    segment_ptr->vectors_ptr_->Erase(offsets);
     /*
     for (auto& doc_id : doc_ids) {
         auto found = std::find(uids.begin(), uids.end(), doc_id);
@@ -152,6 +156,16 @@ MemTableFile::IsFull() {
 
 Status
 MemTableFile::Serialize(uint64_t wal_lsn) {
+    auto status = WriteSegment(wal_lsn);
+    if (!status.ok()) {
+        return status;
+    }
+
+    return meta_->UpdateTableFile(table_file_schema_);
+}
+
+Status
+MemTableFile::WriteSegment(uint64_t wal_lsn) {
     size_t size = GetCurrentMem();
     server::CollectSerializeMetrics metrics(size);
 
@@ -171,6 +185,15 @@ MemTableFile::Serialize(uint64_t wal_lsn) {
         return status;
     }
 
+    // segments without a summary are searched anyway, a failure to write it is not fatal
+    if (options_.segment_pruning_factor_ > 0 &&
+        !server::ValidationUtil::IsBinaryMetricType(table_file_schema_.metric_type_)) {
+        auto summary_status = segment_writer_ptr_->WriteVectorsSummary(table_file_schema_.dimension_);
+        if (!summary_status.ok()) {
+            ENGINE_LOG_WARNING << "Failed to write vectors summary of segment " << table_file_schema_.segment_id_;
+        }
+    }
+
     //    execution_engine_->Serialize();
 
     // TODO(zhiru):
@@ -193,8 +216,6 @@ MemTableFile::Serialize(uint64_t wal_lsn) {
     // GetTableFilesByFlushLSN() in meta.
     table_file_schema_.flush_lsn_ = wal_lsn;
 
-    status = meta_->UpdateTableFile(table_file_schema_);
-
     ENGINE_LOG_DEBUG << "New " << ((table_file_schema_.file_type_ == meta::TableFileSchema::RAW) ? "raw" : "to_index")
                      << " file " << table_file_schema_.file_id_ << " of size " << size << " bytes, lsn = " << wal_lsn;
 
@@ -208,7 +229,87 @@ MemTableFile::Serialize(uint64_t wal_lsn) {
         segment_writer_ptr_->Cache();
     }
 
-    return status;
+    return Status::OK();
+}
+
+MemTableFile::BufferSnapshotPtr
+MemTableFile::GetSnapshot() {
+    segment::SegmentPtr segment_ptr;
+    segment_writer_ptr_->GetSegment(segment_ptr);
+    auto view = segment_ptr->vectors_ptr_->GetView();
+    if (view.count_ == 0) {
+        return nullptr;
+    }
+
+    auto snapshot = std::make_shared<BufferSnapshot>();
+    snapshot->view_ = std::move(view);
+    snapshot->dimension_ = table_file_schema_.dimension_;
+    snapshot->metric_type_ = static_cast<MetricType>(table_file_schema_.metric_type_);
+    return snapshot;
+}
+
+Status
+MemTableFile::Search(const BufferSnapshot& snapshot, uint64_t k, const VectorsData& vectors, ResultIds& result_ids,
+                     ResultDistances& result_distances, uint64_t& result_k) {
+    result_k = 0;
+
+    auto nq = static_cast<size_t>(vectors.vector_count_);
+    auto& view = snapshot.view_;
+    result_ids.resize(nq * k);
+    result_distances.resize(nq * k);
+    try {
+        if (!server::ValidationUtil::IsBinaryMetricType(static_cast<int32_t>(snapshot.metric_type_))) {
+            if (vectors.float_data_.empty()) {
+                return Status(DB_ERROR, "Query vectors don't match the type of the buffered vectors");
+            }
+            auto xb = reinterpret_cast<const float*>(view.data_);
+            if (snapshot.metric_type_ == MetricType::IP) {
+                faiss::float_minheap_array_t res = {nq, k, result_ids.data(), result_distances.data()};
+                faiss::knn_inner_product(vectors.float_data_.data(), xb, snapshot.dimension_, nq, view.count_,
+                                         &res);
+            } else {
+                faiss::float_maxheap_array_t res = {nq, k, result_ids.data(), result_distances.data()};
+                faiss::knn_L2sqr(vectors.float_data_.data(), xb, snapshot.dimension_, nq, view.count_, &res);
+            }
+        } else {
+            if (vectors.binary_data_.empty()) {
+                return Status(DB_ERROR, "Query vectors don't match the type of the buffered vectors");
+            }
+            size_t code_size = snapshot.dimension_ / 8;
+            if (snapshot.metric_type_ == MetricType::JACCARD || snapshot.metric_type_ == MetricType::TANIMOTO) {
+                faiss::float_maxheap_array_t res = {nq, k, result_ids.data(), result_distances.data()};
+                faiss::jaccard_knn_hc(&res, vectors.binary_data_.data(), view.data_, view.count_, code_size, 1);
+                if (snapshot.metric_type_ == MetricType::TANIMOTO) {
+                    for (auto& distance : result_distances) {
+                        distance = -log2(1 - distance);
+                    }
+                }
+            } else {
+                // hamming distances come back as integers
+                std::vector<int32_t> distances(nq * k);
+                faiss::int_maxheap_array_t res = {nq, k, result_ids.data(), distances.data()};
+                faiss::hammings_knn_hc(&res, vectors.binary_data_.data(), view.data_, view.count_, code_size, 1);
+                std::copy(distances.begin(), distances.end(), result_distances.begin());
+            }
+        }
+    } catch (std::exception& ex) {
+        return Status(DB_ERROR, std::string("Failed to search buffered vectors: ") + ex.what());
+    }
+
+    // the search returns offsets into the borrowed rows
+    for (auto& id : result_ids) {
+        if (id >= 0) {
+            id = view.uids_[id];
+        }
+    }
+
+    result_k = std::min(k, static_cast<uint64_t>(view.count_));
+    return Status::OK();
+}
+
+meta::TableFileSchema&
+MemTableFile::GetTableFileSchema() {
+    return table_file_schema_;
 }
 
 const std::string&
@@ -27,6 +27,15 @@ namespace engine {
 
 class MemTableFile {
  public:
+    // the buffered vectors borrowed in place, taken under the lock of the table and searched after the lock
+    // is released, so a search neither copies the buffer nor blocks writes to the table
+    struct BufferSnapshot {
+        segment::Vectors::View view_;
+        int64_t dimension_;
+        MetricType metric_type_;
+    };
+    using BufferSnapshotPtr = std::shared_ptr<BufferSnapshot>;
+
     MemTableFile(const std::string& table_id, const meta::MetaPtr& meta, const DBOptions& options);
 
     Status
@@ -50,6 +59,22 @@ class MemTableFile {
     Status
     Serialize(uint64_t wal_lsn);
 
+    // write the segment to disk and fill in the table file schema, the caller updates the schema in meta
+    Status
+    WriteSegment(uint64_t wal_lsn);
+
+    // nullptr if no vector is buffered
+    BufferSnapshotPtr
+    GetSnapshot();
+
+    // brute force search on a snapshot, results are laid out as nq * k, padded with -1
+    static Status
+    Search(const BufferSnapshot& snapshot, uint64_t k, const VectorsData& vectors, ResultIds& result_ids,
+           ResultDistances& result_distances, uint64_t& result_k);
+
+    meta::TableFileSchema&
+    GetTableFileSchema();
+
     const std::string&
     GetSegmentId() const;
 
@@ -25,64 +25,72 @@ namespace engine {
 VectorSource::VectorSource(VectorsData vectors)
     : vectors_(std::move(vectors)), id_generator_(std::make_shared<SimpleIDGenerator>()) {
     current_num_vectors_added = 0;
+    vector_count_ = vectors_.vector_count_;
+    if (!vectors_.id_array_.empty()) {
+        id_array_ = vectors_.id_array_.data();
+    }
+    if (!vectors_.float_data_.empty()) {
+        float_data_ = vectors_.float_data_.data();
+    } else if (!vectors_.binary_data_.empty()) {
+        binary_data_ = vectors_.binary_data_.data();
+    }
+}
+
+VectorSource::VectorSource(int64_t vector_count, const IDNumber* vector_ids, const float* vectors)
+    : vector_count_(vector_count),
+      id_array_(vector_ids),
+      float_data_(vectors),
+      id_generator_(std::make_shared<SimpleIDGenerator>()) {
+    current_num_vectors_added = 0;
+}
+
+VectorSource::VectorSource(int64_t vector_count, const IDNumber* vector_ids, const uint8_t* vectors)
+    : vector_count_(vector_count),
+      id_array_(vector_ids),
+      binary_data_(vectors),
+      id_generator_(std::make_shared<SimpleIDGenerator>()) {
+    current_num_vectors_added = 0;
 }
 
 Status
 VectorSource::Add(/*const ExecutionEnginePtr& execution_engine,*/ const segment::SegmentWriterPtr& segment_writer_ptr,
                   const meta::TableFileSchema& table_file_schema, const size_t& num_vectors_to_add,
                   size_t& num_vectors_added) {
-    uint64_t n = vectors_.vector_count_;
+    uint64_t n = vector_count_;
     server::CollectAddMetrics metrics(n, table_file_schema.dimension_);
 
     num_vectors_added =
         current_num_vectors_added + num_vectors_to_add <= n ? num_vectors_to_add : n - current_num_vectors_added;
-    IDNumbers vector_ids_to_add;
-    if (vectors_.id_array_.empty()) {
-        id_generator_->GetNextIDNumbers(num_vectors_added, vector_ids_to_add);
+    IDNumbers generated_ids;
+    const IDNumber* vector_ids_to_add = nullptr;
+    if (id_array_ == nullptr) {
+        id_generator_->GetNextIDNumbers(num_vectors_added, generated_ids);
+        vector_ids_to_add = generated_ids.data();
     } else {
-        vector_ids_to_add.resize(num_vectors_added);
-        for (size_t pos = current_num_vectors_added; pos < current_num_vectors_added + num_vectors_added; pos++) {
-            vector_ids_to_add[pos - current_num_vectors_added] = vectors_.id_array_[pos];
-        }
+        vector_ids_to_add = id_array_ + current_num_vectors_added;
     }
 
+    // append straight from the source buffer into the segment, no intermediate copy
     Status status;
-    if (!vectors_.float_data_.empty()) {
-        /*
-        status = execution_engine->AddWithIds(
-            num_vectors_added, vectors_.float_data_.data() + current_num_vectors_added * table_file_schema.dimension_,
-            vector_ids_to_add.data());
-        */
-        std::vector<uint8_t> vectors;
-        auto size = num_vectors_added * table_file_schema.dimension_ * sizeof(float);
-        vectors.resize(size);
-        memcpy(vectors.data(), vectors_.float_data_.data() + current_num_vectors_added * table_file_schema.dimension_,
-               size);
-        status = segment_writer_ptr->AddVectors(table_file_schema.file_id_, vectors, vector_ids_to_add);
-
-    } else if (!vectors_.binary_data_.empty()) {
-        /*
-        status = execution_engine->AddWithIds(
-            num_vectors_added,
-            vectors_.binary_data_.data() + current_num_vectors_added * SingleVectorSize(table_file_schema.dimension_),
-            vector_ids_to_add.data());
-        */
-        std::vector<uint8_t> vectors;
-        auto size = num_vectors_added * SingleVectorSize(table_file_schema.dimension_) * sizeof(uint8_t);
-        vectors.resize(size);
-        memcpy(
-            vectors.data(),
-            vectors_.binary_data_.data() + current_num_vectors_added * SingleVectorSize(table_file_schema.dimension_),
-            size);
-        status = segment_writer_ptr->AddVectors(table_file_schema.file_id_, vectors, vector_ids_to_add);
+    size_t single_vector_size = SingleVectorSize(table_file_schema.dimension_);
+    const uint8_t* vectors = nullptr;
+    if (float_data_ != nullptr) {
+        auto offset = current_num_vectors_added * table_file_schema.dimension_;
+        vectors = reinterpret_cast<const uint8_t*>(float_data_ + offset);
+    } else if (binary_data_ != nullptr) {
+        vectors = binary_data_ + current_num_vectors_added * single_vector_size;
+    }
+    if (vectors != nullptr) {
+        status = segment_writer_ptr->AddVectors(table_file_schema.file_id_, vectors,
+                                                num_vectors_added * single_vector_size, vector_ids_to_add,
+                                                num_vectors_added);
     }
 
     // Clear vector data
     if (status.ok()) {
         current_num_vectors_added += num_vectors_added;
         // TODO(zhiru): remove
-        vector_ids_.insert(vector_ids_.end(), std::make_move_iterator(vector_ids_to_add.begin()),
-                           std::make_move_iterator(vector_ids_to_add.end()));
+        vector_ids_.insert(vector_ids_.end(), vector_ids_to_add, vector_ids_to_add + num_vectors_added);
     } else {
         ENGINE_LOG_ERROR << "VectorSource::Add failed: " + status.ToString();
     }
@@ -97,9 +105,9 @@ VectorSource::GetNumVectorsAdded() {
 
 size_t
 VectorSource::SingleVectorSize(uint16_t dimension) {
-    if (!vectors_.float_data_.empty()) {
+    if (float_data_ != nullptr) {
         return dimension * FLOAT_TYPE_SIZE;
-    } else if (!vectors_.binary_data_.empty()) {
+    } else if (binary_data_ != nullptr) {
         return dimension / 8;
     }
 
@@ -108,7 +116,7 @@ VectorSource::SingleVectorSize(uint16_t dimension) {
 
 bool
 VectorSource::AllAdded() {
-    return (current_num_vectors_added == vectors_.vector_count_);
+    return (current_num_vectors_added == vector_count_);
 }
 
 IDNumbers
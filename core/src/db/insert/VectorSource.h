@@ -28,6 +28,11 @@ class VectorSource {
  public:
     explicit VectorSource(VectorsData vectors);
 
+    // borrow the ids and vectors of the caller without copying, they must stay valid until AllAdded()
+    VectorSource(int64_t vector_count, const IDNumber* vector_ids, const float* vectors);
+
+    VectorSource(int64_t vector_count, const IDNumber* vector_ids, const uint8_t* vectors);
+
     Status
     Add(/*const ExecutionEnginePtr& execution_engine,*/ const segment::SegmentWriterPtr& segment_writer_ptr,
         const meta::TableFileSchema& table_file_schema, const size_t& num_vectors_to_add, size_t& num_vectors_added);
@@ -45,7 +50,12 @@ class VectorSource {
     GetVectorIds();
 
  private:
-    VectorsData vectors_;
+    VectorsData vectors_;  // owned vectors, empty if borrowed
+    int64_t vector_count_ = 0;
+    const IDNumber* id_array_ = nullptr;  // nullptr means ids are generated
+    const float* float_data_ = nullptr;
+    const uint8_t* binary_data_ = nullptr;
+
     IDNumbers vector_ids_;
 
     size_t current_num_vectors_added;
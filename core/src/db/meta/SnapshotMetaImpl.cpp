@@ -0,0 +1,397 @@
+// Copyright (C) 2019-2020 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License.
+
+#include "db/meta/SnapshotMetaImpl.h"
+
+#include <memory>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+#include "utils/StringHelpFunctions.h"
+
+namespace milvus {
+namespace engine {
+namespace meta {
+
+SnapshotMetaImpl::SnapshotMetaImpl(const DBMetaOptions& options, const MetaPtr& meta)
+    : options_(options), meta_(meta), snapshot_(std::make_shared<Snapshot>()) {
+}
+
+Status
+SnapshotMetaImpl::CreateTable(TableSchema& table_schema) {
+    auto status = meta_->CreateTable(table_schema);
+    RemoveTables();
+    return status;
+}
+
+Status
+SnapshotMetaImpl::DescribeTable(TableSchema& table_schema) {
+    auto snapshot = GetSnapshot();
+    auto iter = snapshot->tables_.find(table_schema.table_id_);
+    if (iter != snapshot->tables_.end()) {
+        table_schema = *iter->second;
+        return Status::OK();
+    }
+
+    auto status = meta_->DescribeTable(table_schema);
+    if (status.ok()) {
+        auto schema = std::make_shared<const TableSchema>(table_schema);
+        AddToSnapshot(snapshot->version_, [&](Snapshot& s) { s.tables_[schema->table_id_] = schema; });
+    }
+    return status;
+}
+
+Status
+SnapshotMetaImpl::HasTable(const std::string& table_id, bool& has_or_not) {
+    auto snapshot = GetSnapshot();
+    if (snapshot->tables_.find(table_id) != snapshot->tables_.end()) {
+        has_or_not = true;
+        return Status::OK();
+    }
+
+    return meta_->HasTable(table_id, has_or_not);
+}
+
+Status
+SnapshotMetaImpl::AllTables(std::vector<TableSchema>& table_schema_array) {
+    return meta_->AllTables(table_schema_array);
+}
+
+Status
+SnapshotMetaImpl::DropTable(const std::string& table_id) {
+    auto status = meta_->DropTable(table_id);
+    RemoveTables();
+    RemoveFiles(table_id);
+    return status;
+}
+
+Status
+SnapshotMetaImpl::DeleteTableFiles(const std::string& table_id) {
+    auto status = meta_->DeleteTableFiles(table_id);
+    RemoveFiles(table_id);
+    return status;
+}
+
+Status
+SnapshotMetaImpl::CreateTableFile(TableFileSchema& file_schema) {
+    auto status = meta_->CreateTableFile(file_schema);
+    RemoveFiles(file_schema.table_id_);
+    return status;
+}
+
+Status
+SnapshotMetaImpl::GetTableFiles(const std::string& table_id, const std::vector<size_t>& ids,
+                                TableFilesSchema& table_files) {
+    return meta_->GetTableFiles(table_id, ids, table_files);
+}
+
+Status
+SnapshotMetaImpl::GetTableFilesBySegmentId(const std::string& segment_id, TableFilesSchema& table_files) {
+    return meta_->GetTableFilesBySegmentId(segment_id, table_files);
+}
+
+Status
+SnapshotMetaImpl::UpdateTableIndex(const std::string& table_id, const TableIndex& index) {
+    // the files to search carry the nlist and metric type of their table, and backup files become raw
+    auto status = meta_->UpdateTableIndex(table_id, index);
+    RemoveTables();
+    RemoveFiles(table_id);
+    return status;
+}
+
+Status
+SnapshotMetaImpl::UpdateTableFlag(const std::string& table_id, int64_t flag) {
+    auto status = meta_->UpdateTableFlag(table_id, flag);
+    RemoveTables();
+    return status;
+}
+
+Status
+SnapshotMetaImpl::UpdateTableFlushLSN(const std::string& table_id, uint64_t flush_lsn) {
+    // called by every flush, the flush lsn isn't part of the partition lists so only this table is dropped
+    auto status = meta_->UpdateTableFlushLSN(table_id, flush_lsn);
+    RemoveFromSnapshot([&](Snapshot& s) { s.tables_.erase(table_id); });
+    return status;
+}
+
+Status
+SnapshotMetaImpl::GetTableFlushLSN(const std::string& table_id, uint64_t& flush_lsn) {
+    return meta_->GetTableFlushLSN(table_id, flush_lsn);
+}
+
+Status
+SnapshotMetaImpl::GetTableFilesByFlushLSN(uint64_t flush_lsn, TableFilesSchema& table_files) {
+    return meta_->GetTableFilesByFlushLSN(flush_lsn, table_files);
+}
+
+Status
+SnapshotMetaImpl::UpdateTableFile(TableFileSchema& file_schema) {
+    auto status = meta_->UpdateTableFile(file_schema);
+    RemoveFiles(file_schema.table_id_);
+    return status;
+}
+
+Status
+SnapshotMetaImpl::UpdateTableFilesToIndex(const std::string& table_id) {
+    auto status = meta_->UpdateTableFilesToIndex(table_id);
+    RemoveFiles(table_id);
+    return status;
+}
+
+Status
+SnapshotMetaImpl::UpdateTableFiles(TableFilesSchema& files) {
+    auto status = meta_->UpdateTableFiles(files);
+    std::unordered_set<std::string> table_ids;
+    for (auto& file : files) {
+        table_ids.insert(file.table_id_);
+    }
+    RemoveFromSnapshot([&](Snapshot& s) {
+        for (auto& table_id : table_ids) {
+            s.files_.erase(table_id);
+        }
+    });
+    return status;
+}
+
+Status
+SnapshotMetaImpl::DescribeTableIndex(const std::string& table_id, TableIndex& index) {
+    return meta_->DescribeTableIndex(table_id, index);
+}
+
+Status
+SnapshotMetaImpl::DropTableIndex(const std::string& table_id) {
+    auto status = meta_->DropTableIndex(table_id);
+    RemoveTables();
+    RemoveFiles(table_id);
+    return status;
+}
+
+Status
+SnapshotMetaImpl::CreatePartition(const std::string& table_id, const std::string& partition_name,
+                                  const std::string& tag, uint64_t lsn) {
+    auto status = meta_->CreatePartition(table_id, partition_name, tag, lsn);
+    RemoveTables();
+    return status;
+}
+
+Status
+SnapshotMetaImpl::DropPartition(const std::string& partition_name) {
+    auto status = meta_->DropPartition(partition_name);
+    RemoveTables();
+    RemoveFiles(partition_name);
+    return status;
+}
+
+Status
+SnapshotMetaImpl::ShowPartitions(const std::string& table_id, std::vector<meta::TableSchema>& partition_schema_array) {
+    std::shared_ptr<const std::vector<TableSchema>> partitions;
+    auto status = LoadPartitions(table_id, partitions);
+    if (status.ok()) {
+        partition_schema_array.insert(partition_schema_array.end(), partitions->begin(), partitions->end());
+    }
+    return status;
+}
+
+Status
+SnapshotMetaImpl::GetPartitionName(const std::string& table_id, const std::string& tag, std::string& partition_name) {
+    // a miss asks the backing meta for this partition only, there is no need to list all of them
+    auto snapshot = GetSnapshot();
+    auto iter = snapshot->partitions_.find(table_id);
+    if (iter == snapshot->partitions_.end()) {
+        return meta_->GetPartitionName(table_id, tag, partition_name);
+    }
+
+    // trim side-blank of tag, only compare valid characters
+    // for example: " ab cd " is treated as "ab cd"
+    std::string valid_tag = tag;
+    server::StringHelpFunctions::TrimStringBlank(valid_tag);
+
+    for (auto& schema : *iter->second) {
+        if (schema.partition_tag_ == valid_tag) {
+            partition_name = schema.table_id_;
+            return Status::OK();
+        }
+    }
+
+    return Status(DB_NOT_FOUND, "Table " + table_id + "'s partition " + valid_tag + " not found");
+}
+
+Status
+SnapshotMetaImpl::FilesToSearch(const std::string& table_id, const std::vector<size_t>& ids,
+                                TableFilesSchema& files) {
+    files.clear();
+
+    std::shared_ptr<const TableFilesSchema> table_files;
+    auto status = LoadFilesToSearch(table_id, table_files);
+    if (ids.empty()) {
+        files = *table_files;
+        return status;
+    }
+
+    std::unordered_set<size_t> id_set(ids.begin(), ids.end());
+    for (auto& file : *table_files) {
+        if (id_set.find(file.id_) != id_set.end()) {
+            files.push_back(file);
+        }
+    }
+    return status;
+}
+
+Status
+SnapshotMetaImpl::FilesToMerge(const std::string& table_id, TableFilesSchema& files) {
+    return meta_->FilesToMerge(table_id, files);
+}
+
+Status
+SnapshotMetaImpl::FilesToIndex(TableFilesSchema& files) {
+    return meta_->FilesToIndex(files);
+}
+
+Status
+SnapshotMetaImpl::FilesByType(const std::string& table_id, const std::vector<int>& file_types,
+                              TableFilesSchema& table_files) {
+    return meta_->FilesByType(table_id, file_types, table_files);
+}
+
+Status
+SnapshotMetaImpl::Size(uint64_t& result) {
+    return meta_->Size(result);
+}
+
+Status
+SnapshotMetaImpl::Archive() {
+    // called by every compaction round, it only changes files when some archive criteria is set
+    auto status = meta_->Archive();
+    if (!options_.archive_conf_.GetCriterias().empty()) {
+        RemoveFromSnapshot([](Snapshot& s) { s.files_.clear(); });
+    }
+    return status;
+}
+
+Status
+SnapshotMetaImpl::CleanUpShadowFiles() {
+    // only new files are removed, they are not searched
+    return meta_->CleanUpShadowFiles();
+}
+
+Status
+SnapshotMetaImpl::CleanUpFilesWithTTL(uint64_t seconds) {
+    // only to_delete and backup files and dropped tables are removed, none of them is in the snapshot
+    return meta_->CleanUpFilesWithTTL(seconds);
+}
+
+Status
+SnapshotMetaImpl::DropAll() {
+    auto status = meta_->DropAll();
+    RemoveFromSnapshot([](Snapshot& s) {
+        s.tables_.clear();
+        s.partitions_.clear();
+        s.files_.clear();
+    });
+    return status;
+}
+
+Status
+SnapshotMetaImpl::Count(const std::string& table_id, uint64_t& result) {
+    return meta_->Count(table_id, result);
+}
+
+Status
+SnapshotMetaImpl::SetGlobalLastLSN(uint64_t lsn) {
+    return meta_->SetGlobalLastLSN(lsn);
+}
+
+Status
+SnapshotMetaImpl::GetGlobalLastLSN(uint64_t& lsn) {
+    return meta_->GetGlobalLastLSN(lsn);
+}
+
+SnapshotMetaImpl::SnapshotPtr
+SnapshotMetaImpl::GetSnapshot() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return snapshot_;
+}
+
+void
+SnapshotMetaImpl::AddToSnapshot(uint64_t version, const std::function<void(Snapshot&)>& add) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (snapshot_->version_ != version) {
+        return;  // the entries may have been read before a mutation, they are read again next time
+    }
+
+    auto snapshot = std::make_shared<Snapshot>(*snapshot_);
+    add(*snapshot);
+    snapshot_ = snapshot;
+}
+
+void
+SnapshotMetaImpl::RemoveFromSnapshot(const std::function<void(Snapshot&)>& remove) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto snapshot = std::make_shared<Snapshot>(*snapshot_);
+    remove(*snapshot);
+    ++snapshot->version_;
+    snapshot_ = snapshot;
+}
+
+void
+SnapshotMetaImpl::RemoveTables() {
+    RemoveFromSnapshot([](Snapshot& s) {
+        s.tables_.clear();
+        s.partitions_.clear();
+    });
+}
+
+void
+SnapshotMetaImpl::RemoveFiles(const std::string& table_id) {
+    RemoveFromSnapshot([&](Snapshot& s) { s.files_.erase(table_id); });
+}
+
+Status
+SnapshotMetaImpl::LoadFilesToSearch(const std::string& table_id, std::shared_ptr<const TableFilesSchema>& files) {
+    auto snapshot = GetSnapshot();
+    auto iter = snapshot->files_.find(table_id);
+    if (iter != snapshot->files_.end()) {
+        files = iter->second;
+        return Status::OK();
+    }
+
+    auto loaded = std::make_shared<TableFilesSchema>();
+    auto status = meta_->FilesToSearch(table_id, std::vector<size_t>(), *loaded);
+    files = loaded;
+    if (status.ok()) {
+        AddToSnapshot(snapshot->version_, [&](Snapshot& s) { s.files_[table_id] = files; });
+    }
+    return status;
+}
+
+Status
+SnapshotMetaImpl::LoadPartitions(const std::string& table_id,
+                                 std::shared_ptr<const std::vector<TableSchema>>& partitions) {
+    auto snapshot = GetSnapshot();
+    auto iter = snapshot->partitions_.find(table_id);
+    if (iter != snapshot->partitions_.end()) {
+        partitions = iter->second;
+        return Status::OK();
+    }
+
+    auto loaded = std::make_shared<std::vector<TableSchema>>();
+    auto status = meta_->ShowPartitions(table_id, *loaded);
+    partitions = loaded;
+    if (status.ok()) {
+        AddToSnapshot(snapshot->version_, [&](Snapshot& s) { s.partitions_[table_id] = partitions; });
+    }
+    return status;
+}
+
+}  // namespace meta
+}  // namespace engine
+}  // namespace milvus
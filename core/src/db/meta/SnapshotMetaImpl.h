@@ -0,0 +1,186 @@
+// Copyright (C) 2019-2020 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License.
+
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "Meta.h"
+#include "db/Options.h"
+
+namespace milvus {
+namespace engine {
+namespace meta {
+
+// Serves the reads of the query path (tables, partitions and files to search) from an in-memory snapshot and
+// passes everything else to the backing meta. The snapshot is copied on write: a mutation drops the entries it
+// may change and bumps the version, an entry read from the backing meta is kept only if the version didn't move
+// meanwhile. Mutations are only seen through this object, so it must be the only writer of the meta.
+class SnapshotMetaImpl : public Meta {
+ public:
+    SnapshotMetaImpl(const DBMetaOptions& options, const MetaPtr& meta);
+
+    Status
+    CreateTable(TableSchema& table_schema) override;
+
+    Status
+    DescribeTable(TableSchema& table_schema) override;
+
+    Status
+    HasTable(const std::string& table_id, bool& has_or_not) override;
+
+    Status
+    AllTables(std::vector<TableSchema>& table_schema_array) override;
+
+    Status
+    DropTable(const std::string& table_id) override;
+
+    Status
+    DeleteTableFiles(const std::string& table_id) override;
+
+    Status
+    CreateTableFile(TableFileSchema& file_schema) override;
+
+    Status
+    GetTableFiles(const std::string& table_id, const std::vector<size_t>& ids, TableFilesSchema& table_files) override;
+
+    Status
+    GetTableFilesBySegmentId(const std::string& segment_id, TableFilesSchema& table_files) override;
+
+    Status
+    UpdateTableIndex(const std::string& table_id, const TableIndex& index) override;
+
+    Status
+    UpdateTableFlag(const std::string& table_id, int64_t flag) override;
+
+    Status
+    UpdateTableFlushLSN(const std::string& table_id, uint64_t flush_lsn) override;
+
+    Status
+    GetTableFlushLSN(const std::string& table_id, uint64_t& flush_lsn) override;
+
+    Status
+    GetTableFilesByFlushLSN(uint64_t flush_lsn, TableFilesSchema& table_files) override;
+
+    Status
+    UpdateTableFile(TableFileSchema& file_schema) override;
+
+    Status
+    UpdateTableFilesToIndex(const std::string& table_id) override;
+
+    Status
+    UpdateTableFiles(TableFilesSchema& files) override;
+
+    Status
+    DescribeTableIndex(const std::string& table_id, TableIndex& index) override;
+
+    Status
+    DropTableIndex(const std::string& table_id) override;
+
+    Status
+    CreatePartition(const std::string& table_id, const std::string& partition_name, const std::string& tag,
+                    uint64_t lsn) override;
+
+    Status
+    DropPartition(const std::string& partition_name) override;
+
+    Status
+    ShowPartitions(const std::string& table_id, std::vector<meta::TableSchema>& partition_schema_array) override;
+
+    Status
+    GetPartitionName(const std::string& table_id, const std::string& tag, std::string& partition_name) override;
+
+    Status
+    FilesToSearch(const std::string& table_id, const std::vector<size_t>& ids, TableFilesSchema& files) override;
+
+    Status
+    FilesToMerge(const std::string& table_id, TableFilesSchema& files) override;
+
+    Status
+    FilesToIndex(TableFilesSchema&) override;
+
+    Status
+    FilesByType(const std::string& table_id, const std::vector<int>& file_types,
+                TableFilesSchema& table_files) override;
+
+    Status
+    Size(uint64_t& result) override;
+
+    Status
+    Archive() override;
+
+    Status
+    CleanUpShadowFiles() override;
+
+    Status
+    CleanUpFilesWithTTL(uint64_t seconds /*, CleanUpFilter* filter = nullptr*/) override;
+
+    Status
+    DropAll() override;
+
+    Status
+    Count(const std::string& table_id, uint64_t& result) override;
+
+    Status
+    SetGlobalLastLSN(uint64_t lsn) override;
+
+    Status
+    GetGlobalLastLSN(uint64_t& lsn) override;
+
+ private:
+    struct Snapshot {
+        uint64_t version_ = 0;
+        std::unordered_map<std::string, std::shared_ptr<const TableSchema>> tables_;
+        std::unordered_map<std::string, std::shared_ptr<const std::vector<TableSchema>>> partitions_;
+        std::unordered_map<std::string, std::shared_ptr<const TableFilesSchema>> files_;  // raw, to_index and index
+    };
+
+    using SnapshotPtr = std::shared_ptr<const Snapshot>;
+
+    SnapshotPtr
+    GetSnapshot();
+
+    // add the entries read from the backing meta, unless the snapshot was changed since version
+    void
+    AddToSnapshot(uint64_t version, const std::function<void(Snapshot&)>& add);
+
+    void
+    RemoveFromSnapshot(const std::function<void(Snapshot&)>& remove);
+
+    // the schemas of partitions are also in the lists of their owners, so all tables are dropped together
+    void
+    RemoveTables();
+
+    void
+    RemoveFiles(const std::string& table_id);
+
+    Status
+    LoadFilesToSearch(const std::string& table_id, std::shared_ptr<const TableFilesSchema>& files);
+
+    Status
+    LoadPartitions(const std::string& table_id, std::shared_ptr<const std::vector<TableSchema>>& partitions);
+
+ private:
+    const DBMetaOptions options_;
+    MetaPtr meta_;
+
+    std::mutex mutex_;
+    SnapshotPtr snapshot_;
+};
+
+}  // namespace meta
+}  // namespace engine
+}  // namespace milvus
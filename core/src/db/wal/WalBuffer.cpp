@@ -11,8 +11,11 @@
 
 #include "db/wal/WalBuffer.h"
 
+#include <algorithm>
+#include <cstddef>
 #include <cstring>
 
+#include "db/wal/WalCrc32c.h"
 #include "db/wal/WalDefinations.h"
 #include "utils/Log.h"
 
@@ -36,6 +39,51 @@ ParserLsn(uint64_t lsn, uint32_t& file_no, uint32_t& offset) {
     offset = uint32_t(lsn & LSN_OFFSET_MASK);
 }
 
+// checksum of the header fields before mxl_crc and the record body
+inline uint32_t
+RecordChecksum(const char* record, uint32_t record_size) {
+    uint32_t crc = Crc32c(0, record, offsetof(MXLogRecordHeader, mxl_crc));
+    return Crc32c(crc, record + SizeOfMXLogRecordHeader, record_size - SizeOfMXLogRecordHeader);
+}
+
+// Whether the wal file can be replayed. A file shorter than the header lost it with its first write and holds no
+// record either, the record checks catch that. Any other file must carry the header of this format.
+bool
+CheckFileHeader(const std::string& file_path, const std::string& file_name) {
+    MXLogFileHandler file_handler(file_path);
+    file_handler.SetFileName(file_name);
+    file_handler.SetFileOpenMode("r");
+    if (file_handler.GetFileSize() < SizeOfMXLogFileHeader) {
+        return true;
+    }
+
+    MXLogFileHeader header;
+    if (!file_handler.Load(reinterpret_cast<char*>(&header), 0, SizeOfMXLogFileHeader)) {
+        WAL_LOG_ERROR << "failed to read the header of wal file " << file_name;
+        return false;
+    }
+    if (header.magic != MXLogFileMagic || header.version != MXLogFileVersion) {
+        WAL_LOG_ERROR << "wal file " << file_name << " was written by an older version of milvus, flush it with that"
+                      << " version before upgrading, or set recovery_error_ignore to drop it";
+        return false;
+    }
+    return true;
+}
+
+// a crash may lose the tail of the last wal file, load what is left and zero the rest,
+// the record checksum stops recovery at the first incomplete record
+bool
+LoadLastFile(MXLogFileHandler& file_handler, char* buf, uint32_t data_offset, uint32_t data_size) {
+    uint32_t file_size = file_handler.GetFileSize();
+    uint32_t load_size = file_size > data_offset ? std::min(file_size - data_offset, data_size) : 0;
+    if (load_size < data_size) {
+        WAL_LOG_WARNING << "wal file " << file_handler.GetFileName() << " is shorter than expected, size " << file_size
+                        << " expected " << data_offset + data_size;
+        memset(buf + load_size, 0, data_size - load_size);
+    }
+    return file_handler.Load(buf, data_offset, load_size);
+}
+
 MXLogBuffer::MXLogBuffer(const std::string& mxlog_path, const uint32_t buffer_size)
     : mxlog_buffer_size_(buffer_size * UNIT_MB), mxlog_writer_(mxlog_path) {
 }
@@ -64,7 +112,7 @@ MXLogBuffer::Init(uint64_t start_lsn, uint64_t end_lsn) {
             mxlog_buffer_reader_.buf_offset = 0;
         }
     } else {
-        // to check whether buffer_size is enough
+        // to check whether buffer_size is enough, and that all files to replay are of this format
         MXLogFileHandler file_handler(mxlog_writer_.GetFilePath());
 
         uint32_t buffer_size_need = 0;
@@ -75,10 +123,16 @@ MXLogBuffer::Init(uint64_t start_lsn, uint64_t end_lsn) {
                 WAL_LOG_ERROR << "bad wal file " << i;
                 return false;
             }
+            if (!CheckFileHeader(file_handler.GetFilePath(), ToFileName(i))) {
+                return false;
+            }
             if (file_size > buffer_size_need) {
                 buffer_size_need = file_size;
             }
         }
+        if (!CheckFileHeader(file_handler.GetFilePath(), ToFileName(mxlog_buffer_writer_.file_no))) {
+            return false;
+        }
         if (mxlog_buffer_writer_.buf_offset > buffer_size_need) {
             buffer_size_need = mxlog_buffer_writer_.buf_offset;
         }
@@ -100,7 +154,8 @@ MXLogBuffer::Init(uint64_t start_lsn, uint64_t end_lsn) {
         mxlog_writer_.SetFileName(ToFileName(mxlog_buffer_writer_.file_no));
         if (mxlog_buffer_writer_.buf_offset == 0) {
             mxlog_writer_.SetFileOpenMode("w");
-
+            StartNewFile();
+            mxlog_buffer_reader_.buf_offset = mxlog_buffer_writer_.buf_offset;
         } else {
             mxlog_writer_.SetFileOpenMode("r+");
             if (!mxlog_writer_.FileExists()) {
@@ -108,12 +163,15 @@ MXLogBuffer::Init(uint64_t start_lsn, uint64_t end_lsn) {
                 return false;
             }
 
-            auto read_offset = mxlog_buffer_reader_.buf_offset;
-            auto read_size = mxlog_buffer_writer_.buf_offset - mxlog_buffer_reader_.buf_offset;
-            if (!mxlog_writer_.Load(buf_[0].get() + read_offset, read_offset, read_size)) {
+            // records start after the file header
+            auto read_offset = std::max(mxlog_buffer_reader_.buf_offset, SizeOfMXLogFileHeader);
+            mxlog_buffer_reader_.buf_offset = read_offset;
+            auto read_size = mxlog_buffer_writer_.buf_offset - read_offset;
+            if (!LoadLastFile(mxlog_writer_, buf_[0].get() + read_offset, read_offset, read_size)) {
                 WAL_LOG_ERROR << "load wal file error " << read_offset << " " << read_size;
                 return false;
             }
+            written_offset_ = mxlog_buffer_writer_.buf_offset;
         }
 
     } else {
@@ -124,7 +182,8 @@ MXLogBuffer::Init(uint64_t start_lsn, uint64_t end_lsn) {
         file_handler.SetFileName(ToFileName(mxlog_buffer_reader_.file_no));
         file_handler.SetFileOpenMode("r");
 
-        auto read_offset = mxlog_buffer_reader_.buf_offset;
+        auto read_offset = std::max(mxlog_buffer_reader_.buf_offset, SizeOfMXLogFileHeader);
+        mxlog_buffer_reader_.buf_offset = read_offset;
         auto read_size = file_handler.Load(buf_[0].get() + read_offset, read_offset);
         mxlog_buffer_reader_.max_offset = read_size + read_offset;
         file_handler.CloseFile();
@@ -138,10 +197,11 @@ MXLogBuffer::Init(uint64_t start_lsn, uint64_t end_lsn) {
             WAL_LOG_ERROR << "wal file not exist " << mxlog_buffer_writer_.file_no;
             return false;
         }
-        if (!mxlog_writer_.Load(buf_[1].get(), 0, mxlog_buffer_writer_.buf_offset)) {
+        if (!LoadLastFile(mxlog_writer_, buf_[1].get(), 0, mxlog_buffer_writer_.buf_offset)) {
             WAL_LOG_ERROR << "load wal file error " << mxlog_buffer_writer_.file_no;
             return false;
         }
+        written_offset_ = mxlog_buffer_writer_.buf_offset;
     }
 
     SetFileNoFrom(mxlog_buffer_reader_.file_no);
@@ -162,9 +222,11 @@ MXLogBuffer::Reset(uint64_t lsn) {
         mxlog_buffer_writer_.buf_offset = 0;
     }
     mxlog_buffer_writer_.buf_idx = 0;
+    StartNewFile();
 
     memcpy(&mxlog_buffer_reader_, &mxlog_buffer_writer_, sizeof(MXLogBufferHandler));
 
+    std::lock_guard<std::mutex> file_lck(file_mutex_);
     mxlog_writer_.CloseFile();
     mxlog_writer_.SetFileName(ToFileName(mxlog_buffer_writer_.file_no));
     mxlog_writer_.SetFileOpenMode("w");
@@ -189,10 +251,28 @@ MXLogBuffer::RecordSize(const MXLogRecord& record) {
            record.length * (uint32_t)sizeof(IDNumber) + record.data_size;
 }
 
+void
+MXLogBuffer::StartNewFile() {
+    MXLogFileHeader header{MXLogFileMagic, MXLogFileVersion};
+    memcpy(buf_[mxlog_buffer_writer_.buf_idx].get(), &header, SizeOfMXLogFileHeader);
+    mxlog_buffer_writer_.buf_offset = SizeOfMXLogFileHeader;
+    written_offset_ = 0;
+}
+
 ErrorCode
 MXLogBuffer::Append(MXLogRecord& record) {
     uint32_t record_size = RecordSize(record);
     if (SurplusSpace() < record_size) {
+        // the old wal file must be complete and durable before switching to a new one
+        uint64_t written_lsn = 0;
+        auto error_code = WritePending(written_lsn);
+        if (error_code == WAL_SUCCESS) {
+            error_code = Sync();
+        }
+        if (error_code != WAL_SUCCESS) {
+            return error_code;
+        }
+
         // writer buffer has no space, switch wal file and write to a new buffer
         std::unique_lock<std::mutex> lck(mutex_);
         if (mxlog_buffer_writer_.buf_idx == mxlog_buffer_reader_.buf_idx) {
@@ -201,10 +281,11 @@ MXLogBuffer::Append(MXLogRecord& record) {
             mxlog_buffer_writer_.buf_idx ^= 1;
         }
         mxlog_buffer_writer_.file_no++;
-        mxlog_buffer_writer_.buf_offset = 0;
+        StartNewFile();
         lck.unlock();
 
         // Reborn means close old wal file and open new wal file
+        std::lock_guard<std::mutex> file_lck(file_mutex_);
         if (!mxlog_writer_.ReBorn(ToFileName(mxlog_buffer_writer_.file_no), "w")) {
             WAL_LOG_ERROR << "ReBorn wal file error " << mxlog_buffer_writer_.file_no;
             return WAL_FILE_ERROR;
@@ -213,7 +294,8 @@ MXLogBuffer::Append(MXLogRecord& record) {
 
     // point to the offset of current record in wal file
     char* current_write_buf = buf_[mxlog_buffer_writer_.buf_idx].get();
-    uint32_t current_write_offset = mxlog_buffer_writer_.buf_offset;
+    uint32_t record_offset = mxlog_buffer_writer_.buf_offset;
+    uint32_t current_write_offset = record_offset;
 
     MXLogRecordHeader head;
     BuildLsn(mxlog_buffer_writer_.file_no, mxlog_buffer_writer_.buf_offset + (uint32_t)record_size, head.mxl_lsn);
@@ -222,6 +304,7 @@ MXLogBuffer::Append(MXLogRecord& record) {
     head.partition_tag_size = (uint16_t)record.partition_tag.size();
     head.vector_num = record.length;
     head.data_size = record.data_size;
+    head.mxl_crc = 0;
 
     memcpy(current_write_buf + current_write_offset, &head, SizeOfMXLogRecordHeader);
     current_write_offset += SizeOfMXLogRecordHeader;
@@ -245,11 +328,8 @@ MXLogBuffer::Append(MXLogRecord& record) {
         current_write_offset += record.data_size;
     }
 
-    bool write_rst = mxlog_writer_.Write(current_write_buf + mxlog_buffer_writer_.buf_offset, record_size);
-    if (!write_rst) {
-        WAL_LOG_ERROR << "write wal file error";
-        return WAL_FILE_ERROR;
-    }
+    uint32_t crc = RecordChecksum(current_write_buf + record_offset, record_size);
+    memcpy(current_write_buf + record_offset + offsetof(MXLogRecordHeader, mxl_crc), &crc, sizeof(crc));
 
     mxlog_buffer_writer_.buf_offset = current_write_offset;
 
@@ -257,6 +337,34 @@ MXLogBuffer::Append(MXLogRecord& record) {
     return WAL_SUCCESS;
 }
 
+ErrorCode
+MXLogBuffer::WritePending(uint64_t& written_lsn) {
+    uint32_t write_offset = mxlog_buffer_writer_.buf_offset;
+    if (write_offset > written_offset_) {
+        char* current_write_buf = buf_[mxlog_buffer_writer_.buf_idx].get();
+
+        std::lock_guard<std::mutex> file_lck(file_mutex_);
+        if (!mxlog_writer_.Write(current_write_buf + written_offset_, write_offset - written_offset_)) {
+            WAL_LOG_ERROR << "write wal file error";
+            return WAL_FILE_ERROR;
+        }
+        written_offset_ = write_offset;
+    }
+
+    BuildLsn(mxlog_buffer_writer_.file_no, written_offset_, written_lsn);
+    return WAL_SUCCESS;
+}
+
+ErrorCode
+MXLogBuffer::Sync() {
+    std::lock_guard<std::mutex> file_lck(file_mutex_);
+    if (!mxlog_writer_.Sync()) {
+        WAL_LOG_ERROR << "sync wal file error";
+        return WAL_FILE_ERROR;
+    }
+    return WAL_SUCCESS;
+}
+
 ErrorCode
 MXLogBuffer::Next(const uint64_t last_applied_lsn, MXLogRecord& record) {
     // init output
@@ -273,7 +381,7 @@ MXLogBuffer::Next(const uint64_t last_applied_lsn, MXLogRecord& record) {
     if (mxlog_buffer_reader_.file_no != mxlog_buffer_writer_.file_no) {
         if (mxlog_buffer_reader_.buf_offset == mxlog_buffer_reader_.max_offset) {  // last record
             mxlog_buffer_reader_.file_no++;
-            mxlog_buffer_reader_.buf_offset = 0;
+            mxlog_buffer_reader_.buf_offset = SizeOfMXLogFileHeader;
             need_load_new = (mxlog_buffer_reader_.file_no != mxlog_buffer_writer_.file_no);
             if (!need_load_new) {
                 // read reach write buffer
@@ -284,6 +392,10 @@ MXLogBuffer::Next(const uint64_t last_applied_lsn, MXLogRecord& record) {
     lck.unlock();
 
     if (need_load_new) {
+        if (!CheckFileHeader(mxlog_writer_.GetFilePath(), ToFileName(mxlog_buffer_reader_.file_no))) {
+            return WAL_FILE_ERROR;
+        }
+
         MXLogFileHandler mxlog_reader(mxlog_writer_.GetFilePath());
         mxlog_reader.SetFileName(ToFileName(mxlog_buffer_reader_.file_no));
         mxlog_reader.SetFileOpenMode("r");
@@ -298,7 +410,27 @@ MXLogBuffer::Next(const uint64_t last_applied_lsn, MXLogRecord& record) {
     char* current_read_buf = buf_[mxlog_buffer_reader_.buf_idx].get();
     uint64_t current_read_offset = mxlog_buffer_reader_.buf_offset;
 
+    // the record must end within the readable part of the file and match its checksum
+    uint32_t last_file_no, last_offset;
+    ParserLsn(last_applied_lsn, last_file_no, last_offset);
+    uint64_t read_limit =
+        (mxlog_buffer_reader_.file_no == last_file_no) ? last_offset : mxlog_buffer_reader_.max_offset;
+
     MXLogRecordHeader* head = (MXLogRecordHeader*)(current_read_buf + current_read_offset);
+    bool valid = (current_read_offset + SizeOfMXLogRecordHeader <= read_limit);
+    if (valid) {
+        uint64_t record_size = SizeOfMXLogRecordHeader + head->table_id_size + head->partition_tag_size +
+                               (uint64_t)head->vector_num * sizeof(IDNumber) + head->data_size;
+        valid = (uint32_t(head->mxl_lsn >> 32) == mxlog_buffer_reader_.file_no) &&
+                ((head->mxl_lsn & LSN_OFFSET_MASK) == current_read_offset + record_size) &&
+                (current_read_offset + record_size <= read_limit) &&
+                (head->mxl_crc == RecordChecksum((const char*)head, (uint32_t)record_size));
+    }
+    if (!valid) {
+        WAL_LOG_ERROR << "bad wal record in file " << mxlog_buffer_reader_.file_no << " offset " << current_read_offset;
+        return WAL_CHECKSUM_ERROR;
+    }
+
     record.type = (MXLogType)head->mxl_type;
     record.lsn = head->mxl_lsn;
     record.length = head->vector_num;
@@ -344,6 +476,13 @@ MXLogBuffer::GetReadLsn() {
     return read_lsn;
 }
 
+uint64_t
+MXLogBuffer::GetWriteLsn() {
+    uint64_t write_lsn;
+    BuildLsn(mxlog_buffer_writer_.file_no, mxlog_buffer_writer_.buf_offset, write_lsn);
+    return write_lsn;
+}
+
 bool
 MXLogBuffer::ResetWriteLsn(uint64_t lsn) {
     WAL_LOG_INFO << "reset write lsn " << lsn;
@@ -351,18 +490,22 @@ MXLogBuffer::ResetWriteLsn(uint64_t lsn) {
     int32_t old_file_no = mxlog_buffer_writer_.file_no;
     ParserLsn(lsn, mxlog_buffer_writer_.file_no, mxlog_buffer_writer_.buf_offset);
     if (old_file_no == mxlog_buffer_writer_.file_no) {
+        // the records after lsn have not been written yet
+        written_offset_ = std::min(written_offset_, mxlog_buffer_writer_.buf_offset);
         WAL_LOG_DEBUG << "file No. is not changed";
         return true;
     }
 
     std::unique_lock<std::mutex> lck(mutex_);
     if (mxlog_buffer_writer_.file_no == mxlog_buffer_reader_.file_no) {
+        // share the buffer with reader, the wal file still has to be reopened below
         mxlog_buffer_writer_.buf_idx = mxlog_buffer_reader_.buf_idx;
         WAL_LOG_DEBUG << "file No. is the same as reader";
-        return true;
     }
     lck.unlock();
 
+    std::lock_guard<std::mutex> file_lck(file_mutex_);
+    written_offset_ = mxlog_buffer_writer_.buf_offset;
     if (!mxlog_writer_.ReBorn(ToFileName(mxlog_buffer_writer_.file_no), "r+")) {
         WAL_LOG_ERROR << "reborn file error " << mxlog_buffer_writer_.file_no;
         return false;
@@ -375,6 +518,32 @@ MXLogBuffer::ResetWriteLsn(uint64_t lsn) {
     return true;
 }
 
+bool
+MXLogBuffer::Truncate(uint64_t lsn) {
+    uint32_t file_no, offset;
+    ParserLsn(lsn, file_no, offset);
+    if (file_no != mxlog_buffer_writer_.file_no || offset > mxlog_buffer_writer_.buf_offset) {
+        WAL_LOG_ERROR << "can not truncate wal file " << mxlog_buffer_writer_.file_no << " at lsn " << lsn;
+        return false;
+    }
+
+    WAL_LOG_WARNING << "truncate wal file " << file_no << " from " << mxlog_buffer_writer_.buf_offset << " to "
+                    << offset;
+    std::lock_guard<std::mutex> file_lck(file_mutex_);
+    if (offset <= SizeOfMXLogFileHeader) {
+        // no record is left, and the header may be torn as well, the file is written again from its start
+        StartNewFile();
+    } else {
+        mxlog_buffer_writer_.buf_offset = offset;
+        written_offset_ = offset;
+    }
+    if (!mxlog_writer_.Truncate(written_offset_)) {
+        WAL_LOG_ERROR << "truncate wal file error " << file_no;
+        return false;
+    }
+    return true;
+}
+
 void
 MXLogBuffer::SetFileNoFrom(uint32_t file_no) {
     file_no_from_ = file_no;
@@ -28,6 +28,17 @@ namespace wal {
 #pragma pack(push)
 #pragma pack(1)
 
+// Every wal file starts with this header, the records follow it. Files without it were written before records
+// carried a checksum, recovery refuses them rather than taking their records for a torn tail.
+struct MXLogFileHeader {
+    uint32_t magic;
+    uint32_t version;
+};
+
+const uint32_t SizeOfMXLogFileHeader = sizeof(MXLogFileHeader);
+const uint32_t MXLogFileMagic = 0x474C584D;  // "MXLG"
+const uint32_t MXLogFileVersion = 1;
+
 struct MXLogRecordHeader {
     uint64_t mxl_lsn;  // log sequence number (high 32 bits: file No. inc by 1, low 32 bits: offset in file, max 4GB)
     uint8_t mxl_type;  // record type, insert/delete/update/flush...
@@ -35,6 +46,7 @@ struct MXLogRecordHeader {
     uint16_t partition_tag_size;
     uint32_t vector_num;
     uint32_t data_size;
+    uint32_t mxl_crc;  // crc32c of the header fields above and the record body
 };
 
 const uint32_t SizeOfMXLogRecordHeader = sizeof(MXLogRecordHeader);
@@ -63,18 +75,35 @@ class MXLogBuffer {
     Reset(uint64_t lsn);
 
     // Note: record.lsn will be set inner
+    // the record is only copied into the write buffer, WritePending() writes it to the wal file
     ErrorCode
     Append(MXLogRecord& record);
 
+    // write all appended records which are not in the wal file yet with one write call
+    // @param written_lsn[out]: all records before this lsn are in the wal file
+    ErrorCode
+    WritePending(uint64_t& written_lsn);
+
+    // fdatasync the wal file
+    ErrorCode
+    Sync();
+
     ErrorCode
     Next(const uint64_t last_applied_lsn, MXLogRecord& record);
 
     uint64_t
     GetReadLsn();
 
+    uint64_t
+    GetWriteLsn();
+
     bool
     ResetWriteLsn(uint64_t lsn);
 
+    // cut the current wal file at lsn, used to drop a torn tail found by recovery
+    bool
+    Truncate(uint64_t lsn);
+
     void
     SetFileNoFrom(uint32_t file_no);
 
@@ -91,10 +120,16 @@ class MXLogBuffer {
     uint32_t
     RecordSize(const MXLogRecord& record);
 
+    // put the file header in the write buffer of a new wal file, it is written with the first records
+    void
+    StartNewFile();
+
  private:
     uint32_t mxlog_buffer_size_;  // from config
     BufferPtr buf_[2];
     std::mutex mutex_;
+    std::mutex file_mutex_;  // protects the wal file writer from the sync thread
+    uint32_t written_offset_ = 0;
     uint32_t file_no_from_;
     MXLogBufferHandler mxlog_buffer_reader_;
     MXLogBufferHandler mxlog_buffer_writer_;
@@ -0,0 +1,104 @@
+// Copyright (C) 2019-2020 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License.
+
+#include "db/wal/WalCrc32c.h"
+
+#include <cstring>
+
+#if defined(__x86_64__)
+#include <nmmintrin.h>
+#endif
+
+namespace milvus {
+namespace engine {
+namespace wal {
+
+namespace {
+
+constexpr uint32_t CRC32C_POLY = 0x82F63B78;  // reversed Castagnoli polynomial
+
+struct Crc32cTable {
+    uint32_t table_[8][256];
+
+    Crc32cTable() {
+        for (uint32_t i = 0; i < 256; i++) {
+            uint32_t crc = i;
+            for (int j = 0; j < 8; j++) {
+                crc = (crc & 1) ? (crc >> 1) ^ CRC32C_POLY : crc >> 1;
+            }
+            table_[0][i] = crc;
+        }
+        for (uint32_t i = 0; i < 256; i++) {
+            for (int k = 1; k < 8; k++) {
+                table_[k][i] = (table_[k - 1][i] >> 8) ^ table_[0][table_[k - 1][i] & 0xff];
+            }
+        }
+    }
+};
+
+// slicing-by-8
+uint32_t
+Crc32cSoftware(uint32_t crc, const uint8_t* p, size_t size) {
+    static const Crc32cTable tables;
+    auto& t = tables.table_;
+
+    while (size >= 8) {
+        uint64_t word;
+        memcpy(&word, p, sizeof(word));
+        word ^= crc;
+        crc = t[7][word & 0xff] ^ t[6][(word >> 8) & 0xff] ^ t[5][(word >> 16) & 0xff] ^ t[4][(word >> 24) & 0xff] ^
+              t[3][(word >> 32) & 0xff] ^ t[2][(word >> 40) & 0xff] ^ t[1][(word >> 48) & 0xff] ^ t[0][word >> 56];
+        p += 8;
+        size -= 8;
+    }
+    while (size-- > 0) {
+        crc = t[0][(crc ^ *p++) & 0xff] ^ (crc >> 8);
+    }
+    return crc;
+}
+
+#if defined(__x86_64__)
+__attribute__((target("sse4.2"))) uint32_t
+Crc32cHardware(uint32_t crc, const uint8_t* p, size_t size) {
+    uint64_t crc64 = crc;
+    while (size >= 8) {
+        uint64_t word;
+        memcpy(&word, p, sizeof(word));
+        crc64 = _mm_crc32_u64(crc64, word);
+        p += 8;
+        size -= 8;
+    }
+    crc = static_cast<uint32_t>(crc64);
+    while (size-- > 0) {
+        crc = _mm_crc32_u8(crc, *p++);
+    }
+    return crc;
+}
+#endif
+
+}  // namespace
+
+uint32_t
+Crc32c(uint32_t crc, const void* data, size_t size) {
+    auto p = static_cast<const uint8_t*>(data);
+    crc = ~crc;
+#if defined(__x86_64__)
+    static const bool has_sse42 = __builtin_cpu_supports("sse4.2");
+    if (has_sse42) {
+        return ~Crc32cHardware(crc, p, size);
+    }
+#endif
+    return ~Crc32cSoftware(crc, p, size);
+}
+
+}  // namespace wal
+}  // namespace engine
+}  // namespace milvus
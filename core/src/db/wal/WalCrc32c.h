@@ -0,0 +1,33 @@
+// Copyright (C) 2019-2020 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace milvus {
+namespace engine {
+namespace wal {
+
+/*
+ * CRC32C (Castagnoli) checksum, uses the SSE4.2 crc32 instruction when the cpu supports it
+ * @param crc: checksum of the preceding data, 0 for the first piece
+ * @param data: data
+ * @param size: data size in bytes
+ * @retval checksum of the preceding data and this piece
+ */
+uint32_t
+Crc32c(uint32_t crc, const void* data, size_t size);
+
+}  // namespace wal
+}  // namespace engine
+}  // namespace milvus
@@ -41,10 +41,15 @@ struct MXLogRecord {
     const void* data;
 };
 
+// None: write to page cache only; Batch: sync every commit group; Interval: sync periodically
+enum class MXLogSyncMode { None, Batch, Interval };
+
 struct MXLogConfiguration {
     bool recovery_error_ignore;
     uint32_t buffer_size;
     std::string mxlog_path;
+    MXLogSyncMode sync_mode = MXLogSyncMode::None;
+    int64_t sync_interval = 1000;  // milliseconds
 };
 
 }  // namespace wal
@@ -68,7 +68,32 @@ MXLogFileHandler::Write(char* buf, uint32_t data_size, bool is_sync) {
         written_size = fwrite(buf, 1, data_size, p_file_);
         fflush(p_file_);
     }
-    return (written_size == data_size);
+    if (written_size != data_size) {
+        return false;
+    }
+    return is_sync ? Sync() : true;
+}
+
+bool
+MXLogFileHandler::Sync() {
+    if (p_file_ == nullptr) {
+        return true;
+    }
+    if (fflush(p_file_) != 0) {
+        return false;
+    }
+    return fdatasync(fileno(p_file_)) == 0;
+}
+
+bool
+MXLogFileHandler::Truncate(uint32_t file_size) {
+    if (!OpenFile() || fflush(p_file_) != 0) {
+        return false;
+    }
+    if (ftruncate(fileno(p_file_), file_size) != 0) {
+        return false;
+    }
+    return fseek(p_file_, file_size, SEEK_SET) == 0;
 }
 
 bool
@@ -39,6 +39,10 @@ class MXLogFileHandler {
     bool
     Write(char* buf, uint32_t data_size, bool is_sync = false);
     bool
+    Sync();
+    bool
+    Truncate(uint32_t file_size);
+    bool
     ReBorn(const std::string& file_name, const std::string& open_mode);
     uint32_t
     GetFileSize();
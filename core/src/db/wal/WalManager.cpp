@@ -14,8 +14,10 @@
 #include <unistd.h>
 
 #include <algorithm>
+#include <chrono>
 #include <memory>
 
+#include "metrics/Metrics.h"
 #include "server/Config.h"
 #include "utils/CommonUtil.h"
 #include "utils/Exception.h"
@@ -32,6 +34,8 @@ WalManager::WalManager(const MXLogConfiguration& config) {
     mxlog_config_.recovery_error_ignore = config.recovery_error_ignore;
     mxlog_config_.buffer_size = config.buffer_size;
     mxlog_config_.mxlog_path = config.mxlog_path;
+    mxlog_config_.sync_mode = config.sync_mode;
+    mxlog_config_.sync_interval = config.sync_interval;
 
     // check the path end with '/'
     if (mxlog_config_.mxlog_path.back() != '/') {
@@ -47,6 +51,14 @@ WalManager::WalManager(const MXLogConfiguration& config) {
 }
 
 WalManager::~WalManager() {
+    if (sync_thread_.joinable()) {
+        {
+            std::lock_guard<std::mutex> lck(sync_mutex_);
+            sync_stop_ = true;
+        }
+        sync_cv_.notify_all();
+        sync_thread_.join();
+    }
 }
 
 ErrorCode
@@ -116,6 +128,11 @@ WalManager::Init(const meta::MetaPtr& meta) {
     mxlog_config_.buffer_size = p_buffer_->GetBufferSize();
 
     last_applied_lsn_ = applied_lsn;
+    committed_lsn_ = applied_lsn;
+
+    if (error_code == WAL_SUCCESS && mxlog_config_.sync_mode == MXLogSyncMode::Interval) {
+        sync_thread_ = std::thread(&WalManager::BackgroundSync, this);
+    }
     return error_code;
 }
 
@@ -124,6 +141,12 @@ WalManager::GetNextRecovery(MXLogRecord& record) {
     ErrorCode error_code = WAL_SUCCESS;
     while (true) {
         error_code = p_buffer_->Next(last_applied_lsn_, record);
+        if (error_code == WAL_CHECKSUM_ERROR && TruncateTornTail()) {
+            // the records after the torn one never completed, recovery ends here
+            record.type = MXLogType::None;
+            error_code = WAL_SUCCESS;
+            break;
+        }
         if (error_code != WAL_SUCCESS) {
             if (mxlog_config_.recovery_error_ignore) {
                 // reset and break recovery
@@ -154,6 +177,27 @@ WalManager::GetNextRecovery(MXLogRecord& record) {
     return error_code;
 }
 
+bool
+WalManager::TruncateTornTail() {
+    // only the tail of the last wal file can be torn by a crash, a bad record elsewhere is a corruption. Files of
+    // an older format are refused when the buffer is initialized, so a bad record here is never a legacy one
+    uint64_t read_lsn = p_buffer_->GetReadLsn();
+    if ((read_lsn >> 32) != (p_buffer_->GetWriteLsn() >> 32) || !p_buffer_->Truncate(read_lsn)) {
+        return false;
+    }
+
+    WAL_LOG_WARNING << "torn wal tail dropped, applied lsn " << last_applied_lsn_ << " truncated to " << read_lsn;
+    last_applied_lsn_ = read_lsn;
+    committed_lsn_ = read_lsn;
+    for (auto& table : tables_) {
+        table.second.wal_lsn = std::min(table.second.wal_lsn, read_lsn);
+    }
+    if (p_meta_handler_ != nullptr) {
+        p_meta_handler_->SetMXLogInternalMeta(read_lsn);
+    }
+    return true;
+}
+
 ErrorCode
 WalManager::GetNextRecord(MXLogRecord& record) {
     auto check_flush = [&]() -> bool {
@@ -253,43 +297,47 @@ WalManager::Insert(const std::string& table_id, const std::string& partition_tag
     record.partition_tag = partition_tag;
 
     uint64_t new_lsn = 0;
-    for (size_t i = 0; i < vector_num; i += record.length) {
-        size_t surplus_space = p_buffer_->SurplusSpace();
-        size_t max_rcd_num = 0;
-        if (surplus_space >= head_size + unit_size) {
-            max_rcd_num = (surplus_space - head_size) / unit_size;
-        } else {
-            max_rcd_num = (mxlog_config_.buffer_size - head_size) / unit_size;
-        }
-        if (max_rcd_num == 0) {
-            WAL_LOG_ERROR << "Wal buffer size is too small " << mxlog_config_.buffer_size << " unit " << unit_size;
-            return false;
-        }
+    {
+        std::lock_guard<std::mutex> append_lck(append_mutex_);
+        uint64_t start_lsn = p_buffer_->GetWriteLsn();
+        for (size_t i = 0; i < vector_num; i += record.length) {
+            size_t surplus_space = p_buffer_->SurplusSpace();
+            size_t max_rcd_num = 0;
+            if (surplus_space >= head_size + unit_size) {
+                max_rcd_num = (surplus_space - head_size) / unit_size;
+            } else {
+                // the record goes to a new file, after the file header
+                max_rcd_num = (mxlog_config_.buffer_size - SizeOfMXLogFileHeader - head_size) / unit_size;
+            }
+            if (max_rcd_num == 0) {
+                WAL_LOG_ERROR << "Wal buffer size is too small " << mxlog_config_.buffer_size << " unit " << unit_size;
+                p_buffer_->ResetWriteLsn(start_lsn);
+                return false;
+            }
 
-        record.length = std::min(vector_num - i, max_rcd_num);
-        record.ids = vector_ids.data() + i;
-        record.data_size = record.length * dim * sizeof(T);
-        record.data = vectors.data() + i * dim;
+            record.length = std::min(vector_num - i, max_rcd_num);
+            record.ids = vector_ids.data() + i;
+            record.data_size = record.length * dim * sizeof(T);
+            record.data = vectors.data() + i * dim;
 
-        auto error_code = p_buffer_->Append(record);
-        if (error_code != WAL_SUCCESS) {
-            p_buffer_->ResetWriteLsn(last_applied_lsn_);
-            return false;
+            auto error_code = p_buffer_->Append(record);
+            if (error_code != WAL_SUCCESS) {
+                p_buffer_->ResetWriteLsn(start_lsn);
+                return false;
+            }
+            new_lsn = record.lsn;
+            ++pending_records_;
         }
-        new_lsn = record.lsn;
     }
 
-    std::unique_lock<std::mutex> lck(mutex_);
-    last_applied_lsn_ = new_lsn;
-    auto it = tables_.find(table_id);
-    if (it != tables_.end()) {
-        it->second.wal_lsn = new_lsn;
+    if (Commit(new_lsn) != WAL_SUCCESS) {
+        return false;
     }
-    lck.unlock();
+    UpdateAppliedLsn(table_id, new_lsn);
 
     WAL_LOG_INFO << table_id << " insert in part " << partition_tag << " with lsn " << new_lsn;
 
-    return p_meta_handler_->SetMXLogInternalMeta(new_lsn);
+    return true;
 }
 
 bool
@@ -309,39 +357,120 @@ WalManager::DeleteById(const std::string& table_id, const IDNumbers& vector_ids)
     record.partition_tag = "";
 
     uint64_t new_lsn = 0;
-    for (size_t i = 0; i < vector_num; i += record.length) {
-        size_t surplus_space = p_buffer_->SurplusSpace();
-        size_t max_rcd_num = 0;
-        if (surplus_space >= head_size + unit_size) {
-            max_rcd_num = (surplus_space - head_size) / unit_size;
-        } else {
-            max_rcd_num = (mxlog_config_.buffer_size - head_size) / unit_size;
+    {
+        std::lock_guard<std::mutex> append_lck(append_mutex_);
+        uint64_t start_lsn = p_buffer_->GetWriteLsn();
+        for (size_t i = 0; i < vector_num; i += record.length) {
+            size_t surplus_space = p_buffer_->SurplusSpace();
+            size_t max_rcd_num = 0;
+            if (surplus_space >= head_size + unit_size) {
+                max_rcd_num = (surplus_space - head_size) / unit_size;
+            } else {
+                // the record goes to a new file, after the file header
+                max_rcd_num = (mxlog_config_.buffer_size - SizeOfMXLogFileHeader - head_size) / unit_size;
+            }
+
+            record.length = std::min(vector_num - i, max_rcd_num);
+            record.ids = vector_ids.data() + i;
+            record.data_size = 0;
+            record.data = nullptr;
+
+            auto error_code = p_buffer_->Append(record);
+            if (error_code != WAL_SUCCESS) {
+                p_buffer_->ResetWriteLsn(start_lsn);
+                return false;
+            }
+            new_lsn = record.lsn;
+            ++pending_records_;
         }
+    }
+
+    if (Commit(new_lsn) != WAL_SUCCESS) {
+        return false;
+    }
+    UpdateAppliedLsn(table_id, new_lsn);
+
+    WAL_LOG_INFO << table_id << " delete rows by id, lsn " << new_lsn;
+
+    return true;
+}
 
-        record.length = std::min(vector_num - i, max_rcd_num);
-        record.ids = vector_ids.data() + i;
-        record.data_size = 0;
-        record.data = nullptr;
+ErrorCode
+WalManager::Commit(uint64_t lsn) {
+    auto start = std::chrono::high_resolution_clock::now();
+
+    std::unique_lock<std::mutex> lck(commit_mutex_);
+    while (committed_lsn_ < lsn) {
+        if (committing_) {
+            // another caller is writing, its group may contain our records
+            commit_cv_.wait(lck);
+            continue;
+        }
+
+        // become the leader, write everything appended so far
+        committing_ = true;
+        lck.unlock();
+
+        uint64_t written_lsn = 0;
+        uint64_t group_size = 0;
+        ErrorCode error_code = WAL_SUCCESS;
+        {
+            std::lock_guard<std::mutex> append_lck(append_mutex_);
+            error_code = p_buffer_->WritePending(written_lsn);
+            group_size = pending_records_;
+            pending_records_ = 0;
+        }
+        if (error_code == WAL_SUCCESS && mxlog_config_.sync_mode == MXLogSyncMode::Batch) {
+            error_code = p_buffer_->Sync();
+        }
+        if (error_code == WAL_SUCCESS && !p_meta_handler_->SetMXLogInternalMeta(written_lsn)) {
+            error_code = WAL_META_ERROR;
+        }
+
+        lck.lock();
+        committing_ = false;
+        if (error_code == WAL_SUCCESS && written_lsn > committed_lsn_) {
+            committed_lsn_ = written_lsn;
+        }
+        commit_cv_.notify_all();
 
-        auto error_code = p_buffer_->Append(record);
         if (error_code != WAL_SUCCESS) {
-            p_buffer_->ResetWriteLsn(last_applied_lsn_);
-            return false;
+            WAL_LOG_ERROR << "commit wal records error " << error_code;
+            return error_code;
         }
-        new_lsn = record.lsn;
+        server::Metrics::GetInstance().WalGroupCommitSizeHistogramObserve(group_size);
     }
+    lck.unlock();
 
-    std::unique_lock<std::mutex> lck(mutex_);
-    last_applied_lsn_ = new_lsn;
+    auto end = std::chrono::high_resolution_clock::now();
+    auto duration = std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+    server::Metrics::GetInstance().WalCommitDurationMicrosecondsHistogramObserve(duration);
+
+    return WAL_SUCCESS;
+}
+
+void
+WalManager::UpdateAppliedLsn(const std::string& table_id, uint64_t lsn) {
+    // concurrent callers may finish in any order, lsn only moves forward
+    std::lock_guard<std::mutex> lck(mutex_);
+    if (lsn > last_applied_lsn_) {
+        last_applied_lsn_ = lsn;
+    }
     auto it = tables_.find(table_id);
-    if (it != tables_.end()) {
-        it->second.wal_lsn = new_lsn;
+    if (it != tables_.end() && lsn > it->second.wal_lsn) {
+        it->second.wal_lsn = lsn;
     }
-    lck.unlock();
-
-    WAL_LOG_INFO << table_id << " delete rows by id, lsn " << new_lsn;
+}
 
-    return p_meta_handler_->SetMXLogInternalMeta(new_lsn);
+void
+WalManager::BackgroundSync() {
+    std::unique_lock<std::mutex> lck(sync_mutex_);
+    while (!sync_stop_) {
+        sync_cv_.wait_for(lck, std::chrono::milliseconds(mxlog_config_.sync_interval));
+        if (p_buffer_->Sync() != WAL_SUCCESS) {
+            WAL_LOG_ERROR << "periodical sync of wal file failed";
+        }
+    }
 }
 
 uint64_t
@@ -12,8 +12,11 @@
 #pragma once
 
 #include <atomic>
+#include <condition_variable>
 #include <map>
+#include <mutex>
 #include <string>
+#include <thread>
 #include <utility>
 #include <vector>
 
@@ -116,6 +119,29 @@ class WalManager {
     WalManager
     operator=(WalManager&);
 
+    /*
+     * Group commit, wait until all records before lsn are written (and synced in batch mode).
+     * The first waiting caller writes the records appended by all callers so far with one write,
+     * the others wait for it.
+     * @param lsn: the last lsn of the caller
+     * @retval error_code
+     */
+    ErrorCode
+    Commit(uint64_t lsn);
+
+    void
+    UpdateAppliedLsn(const std::string& table_id, uint64_t lsn);
+
+    /*
+     * Drop the torn records at the end of the last wal file found by recovery
+     * @retval false if the bad record is not at the tail of the last wal file
+     */
+    bool
+    TruncateTornTail();
+
+    void
+    BackgroundSync();
+
     MXLogConfiguration mxlog_config_;
 
     MXLogBufferPtr p_buffer_;
@@ -144,6 +170,21 @@ class WalManager {
         }
     };
     FlushInfo flush_info_;
+
+    // serializes appending records into the wal buffer
+    std::mutex append_mutex_;
+    uint64_t pending_records_ = 0;
+
+    std::mutex commit_mutex_;
+    std::condition_variable commit_cv_;
+    bool committing_ = false;
+    uint64_t committed_lsn_ = 0;
+
+    // periodical sync of interval sync mode
+    std::thread sync_thread_;
+    std::mutex sync_mutex_;
+    std::condition_variable sync_cv_;
+    bool sync_stop_ = false;
 };
 
 extern template bool
@@ -127,6 +127,14 @@ class GetVectorIDsParamDefaultTypeInternal {
  public:
   ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<GetVectorIDsParam> _instance;
 } _GetVectorIDsParam_default_instance_;
+class VectorsIdentityDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<VectorsIdentity> _instance;
+} _VectorsIdentity_default_instance_;
+class VectorsDataDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<VectorsData> _instance;
+} _VectorsData_default_instance_;
 }  // namespace grpc
 }  // namespace milvus
 static void InitDefaultsscc_info_BoolReply_milvus_2eproto() {
@@ -511,7 +519,37 @@ static void InitDefaultsscc_info_VectorIds_milvus_2eproto() {
     {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 1, InitDefaultsscc_info_VectorIds_milvus_2eproto}, {
       &scc_info_Status_status_2eproto.base,}};
 
-static ::PROTOBUF_NAMESPACE_ID::Metadata file_level_metadata_milvus_2eproto[26];
+static void InitDefaultsscc_info_VectorsData_milvus_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::milvus::grpc::_VectorsData_default_instance_;
+    new (ptr) ::milvus::grpc::VectorsData();
+    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
+  }
+  ::milvus::grpc::VectorsData::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<2> scc_info_VectorsData_milvus_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 2, InitDefaultsscc_info_VectorsData_milvus_2eproto}, {
+      &scc_info_Status_status_2eproto.base,
+      &scc_info_RowRecord_milvus_2eproto.base,}};
+
+static void InitDefaultsscc_info_VectorsIdentity_milvus_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::milvus::grpc::_VectorsIdentity_default_instance_;
+    new (ptr) ::milvus::grpc::VectorsIdentity();
+    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
+  }
+  ::milvus::grpc::VectorsIdentity::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_VectorsIdentity_milvus_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, InitDefaultsscc_info_VectorsIdentity_milvus_2eproto}, {}};
+
+static ::PROTOBUF_NAMESPACE_ID::Metadata file_level_metadata_milvus_2eproto[28];
 static constexpr ::PROTOBUF_NAMESPACE_ID::EnumDescriptor const** file_level_enum_descriptors_milvus_2eproto = nullptr;
 static constexpr ::PROTOBUF_NAMESPACE_ID::ServiceDescriptor const** file_level_service_descriptors_milvus_2eproto = nullptr;
 
@@ -713,6 +751,20 @@ const ::PROTOBUF_NAMESPACE_ID::uint32 TableStruct_milvus_2eproto::offsets[] PROT
   ~0u,  // no _weak_field_map_
   PROTOBUF_FIELD_OFFSET(::milvus::grpc::GetVectorIDsParam, table_name_),
   PROTOBUF_FIELD_OFFSET(::milvus::grpc::GetVectorIDsParam, segment_name_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::milvus::grpc::VectorsIdentity, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  PROTOBUF_FIELD_OFFSET(::milvus::grpc::VectorsIdentity, table_name_),
+  PROTOBUF_FIELD_OFFSET(::milvus::grpc::VectorsIdentity, id_array_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::milvus::grpc::VectorsData, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  PROTOBUF_FIELD_OFFSET(::milvus::grpc::VectorsData, status_),
+  PROTOBUF_FIELD_OFFSET(::milvus::grpc::VectorsData, vectors_data_),
 };
 static const ::PROTOBUF_NAMESPACE_ID::internal::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
   { 0, -1, sizeof(::milvus::grpc::TableName)},
@@ -741,6 +793,8 @@ static const ::PROTOBUF_NAMESPACE_ID::internal::MigrationSchema schemas[] PROTOB
   { 176, -1, sizeof(::milvus::grpc::VectorIdentity)},
   { 183, -1, sizeof(::milvus::grpc::VectorData)},
   { 190, -1, sizeof(::milvus::grpc::GetVectorIDsParam)},
+  { 197, -1, sizeof(::milvus::grpc::VectorsIdentity)},
+  { 204, -1, sizeof(::milvus::grpc::VectorsData)},
 };
 
 static ::PROTOBUF_NAMESPACE_ID::Message const * const file_default_instances[] = {
@@ -770,6 +824,8 @@ static ::PROTOBUF_NAMESPACE_ID::Message const * const file_default_instances[] =
   reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::milvus::grpc::_VectorIdentity_default_instance_),
   reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::milvus::grpc::_VectorData_default_instance_),
   reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::milvus::grpc::_GetVectorIDsParam_default_instance_),
+  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::milvus::grpc::_VectorsIdentity_default_instance_),
+  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::milvus::grpc::_VectorsData_default_instance_),
 };
 
 const char descriptor_table_protodef_milvus_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
@@ -827,52 +883,58 @@ const char descriptor_table_protodef_milvus_2eproto[] PROTOBUF_SECTION_VARIABLE(
   "milvus.grpc.Status\022+\n\013vector_data\030\002 \001(\0132"
   "\026.milvus.grpc.RowRecord\"=\n\021GetVectorIDsP"
   "aram\022\022\n\ntable_name\030\001 \001(\t\022\024\n\014segment_name"
-  "\030\002 \001(\t2\313\014\n\rMilvusService\022>\n\013CreateTable\022"
-  "\030.milvus.grpc.TableSchema\032\023.milvus.grpc."
-  "Status\"\000\022<\n\010HasTable\022\026.milvus.grpc.Table"
-  "Name\032\026.milvus.grpc.BoolReply\"\000\022C\n\rDescri"
-  "beTable\022\026.milvus.grpc.TableName\032\030.milvus"
-  ".grpc.TableSchema\"\000\022B\n\nCountTable\022\026.milv"
-  "us.grpc.TableName\032\032.milvus.grpc.TableRow"
-  "Count\"\000\022@\n\nShowTables\022\024.milvus.grpc.Comm"
-  "and\032\032.milvus.grpc.TableNameList\"\000\022A\n\rSho"
-  "wTableInfo\022\026.milvus.grpc.TableName\032\026.mil"
-  "vus.grpc.TableInfo\"\000\022:\n\tDropTable\022\026.milv"
-  "us.grpc.TableName\032\023.milvus.grpc.Status\"\000"
-  "\022=\n\013CreateIndex\022\027.milvus.grpc.IndexParam"
-  "\032\023.milvus.grpc.Status\"\000\022B\n\rDescribeIndex"
-  "\022\026.milvus.grpc.TableName\032\027.milvus.grpc.I"
-  "ndexParam\"\000\022:\n\tDropIndex\022\026.milvus.grpc.T"
-  "ableName\032\023.milvus.grpc.Status\"\000\022E\n\017Creat"
-  "ePartition\022\033.milvus.grpc.PartitionParam\032"
-  "\023.milvus.grpc.Status\"\000\022F\n\016ShowPartitions"
-  "\022\026.milvus.grpc.TableName\032\032.milvus.grpc.P"
-  "artitionList\"\000\022C\n\rDropPartition\022\033.milvus"
-  ".grpc.PartitionParam\032\023.milvus.grpc.Statu"
-  "s\"\000\022<\n\006Insert\022\030.milvus.grpc.InsertParam\032"
-  "\026.milvus.grpc.VectorIds\"\000\022G\n\rGetVectorBy"
-  "ID\022\033.milvus.grpc.VectorIdentity\032\027.milvus"
-  ".grpc.VectorData\"\000\022H\n\014GetVectorIDs\022\036.mil"
-  "vus.grpc.GetVectorIDsParam\032\026.milvus.grpc"
-  ".VectorIds\"\000\022B\n\006Search\022\030.milvus.grpc.Sea"
-  "rchParam\032\034.milvus.grpc.TopKQueryResult\"\000"
-  "\022J\n\nSearchByID\022\034.milvus.grpc.SearchByIDP"
-  "aram\032\034.milvus.grpc.TopKQueryResult\"\000\022P\n\r"
-  "SearchInFiles\022\037.milvus.grpc.SearchInFile"
-  "sParam\032\034.milvus.grpc.TopKQueryResult\"\000\0227"
-  "\n\003Cmd\022\024.milvus.grpc.Command\032\030.milvus.grp"
-  "c.StringReply\"\000\022A\n\nDeleteByID\022\034.milvus.g"
-  "rpc.DeleteByIDParam\032\023.milvus.grpc.Status"
-  "\"\000\022=\n\014PreloadTable\022\026.milvus.grpc.TableNa"
-  "me\032\023.milvus.grpc.Status\"\000\0227\n\005Flush\022\027.mil"
-  "vus.grpc.FlushParam\032\023.milvus.grpc.Status"
-  "\"\000\0228\n\007Compact\022\026.milvus.grpc.TableName\032\023."
-  "milvus.grpc.Status\"\000b\006proto3"
+  "\030\002 \001(\t\"7\n\017VectorsIdentity\022\022\n\ntable_name\030"
+  "\001 \001(\t\022\020\n\010id_array\030\002 \003(\003\"`\n\013VectorsData\022#"
+  "\n\006status\030\001 \001(\0132\023.milvus.grpc.Status\022,\n\014v"
+  "ectors_data\030\002 \003(\0132\026.milvus.grpc.RowRecor"
+  "d2\227\r\n\rMilvusService\022>\n\013CreateTable\022\030.mil"
+  "vus.grpc.TableSchema\032\023.milvus.grpc.Statu"
+  "s\"\000\022<\n\010HasTable\022\026.milvus.grpc.TableName\032"
+  "\026.milvus.grpc.BoolReply\"\000\022C\n\rDescribeTab"
+  "le\022\026.milvus.grpc.TableName\032\030.milvus.grpc"
+  ".TableSchema\"\000\022B\n\nCountTable\022\026.milvus.gr"
+  "pc.TableName\032\032.milvus.grpc.TableRowCount"
+  "\"\000\022@\n\nShowTables\022\024.milvus.grpc.Command\032\032"
+  ".milvus.grpc.TableNameList\"\000\022A\n\rShowTabl"
+  "eInfo\022\026.milvus.grpc.TableName\032\026.milvus.g"
+  "rpc.TableInfo\"\000\022:\n\tDropTable\022\026.milvus.gr"
+  "pc.TableName\032\023.milvus.grpc.Status\"\000\022=\n\013C"
+  "reateIndex\022\027.milvus.grpc.IndexParam\032\023.mi"
+  "lvus.grpc.Status\"\000\022B\n\rDescribeIndex\022\026.mi"
+  "lvus.grpc.TableName\032\027.milvus.grpc.IndexP"
+  "aram\"\000\022:\n\tDropIndex\022\026.milvus.grpc.TableN"
+  "ame\032\023.milvus.grpc.Status\"\000\022E\n\017CreatePart"
+  "ition\022\033.milvus.grpc.PartitionParam\032\023.mil"
+  "vus.grpc.Status\"\000\022F\n\016ShowPartitions\022\026.mi"
+  "lvus.grpc.TableName\032\032.milvus.grpc.Partit"
+  "ionList\"\000\022C\n\rDropPartition\022\033.milvus.grpc"
+  ".PartitionParam\032\023.milvus.grpc.Status\"\000\022<"
+  "\n\006Insert\022\030.milvus.grpc.InsertParam\032\026.mil"
+  "vus.grpc.VectorIds\"\000\022G\n\rGetVectorByID\022\033."
+  "milvus.grpc.VectorIdentity\032\027.milvus.grpc"
+  ".VectorData\"\000\022H\n\014GetVectorIDs\022\036.milvus.g"
+  "rpc.GetVectorIDsParam\032\026.milvus.grpc.Vect"
+  "orIds\"\000\022B\n\006Search\022\030.milvus.grpc.SearchPa"
+  "ram\032\034.milvus.grpc.TopKQueryResult\"\000\022J\n\nS"
+  "earchByID\022\034.milvus.grpc.SearchByIDParam\032"
+  "\034.milvus.grpc.TopKQueryResult\"\000\022P\n\rSearc"
+  "hInFiles\022\037.milvus.grpc.SearchInFilesPara"
+  "m\032\034.milvus.grpc.TopKQueryResult\"\000\0227\n\003Cmd"
+  "\022\024.milvus.grpc.Command\032\030.milvus.grpc.Str"
+  "ingReply\"\000\022A\n\nDeleteByID\022\034.milvus.grpc.D"
+  "eleteByIDParam\032\023.milvus.grpc.Status\"\000\022=\n"
+  "\014PreloadTable\022\026.milvus.grpc.TableName\032\023."
+  "milvus.grpc.Status\"\000\0227\n\005Flush\022\027.milvus.g"
+  "rpc.FlushParam\032\023.milvus.grpc.Status\"\000\0228\n"
+  "\007Compact\022\026.milvus.grpc.TableName\032\023.milvu"
+  "s.grpc.Status\"\000\022J\n\016GetVectorsByID\022\034.milv"
+  "us.grpc.VectorsIdentity\032\030.milvus.grpc.Ve"
+  "ctorsData\"\000b\006proto3"
   ;
 static const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable*const descriptor_table_milvus_2eproto_deps[1] = {
   &::descriptor_table_status_2eproto,
 };
-static ::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase*const descriptor_table_milvus_2eproto_sccs[26] = {
+static ::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase*const descriptor_table_milvus_2eproto_sccs[28] = {
   &scc_info_BoolReply_milvus_2eproto.base,
   &scc_info_Command_milvus_2eproto.base,
   &scc_info_DeleteByIDParam_milvus_2eproto.base,
@@ -899,14 +961,16 @@ static ::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase*const descriptor_table_mil
   &scc_info_VectorData_milvus_2eproto.base,
   &scc_info_VectorIdentity_milvus_2eproto.base,
   &scc_info_VectorIds_milvus_2eproto.base,
+  &scc_info_VectorsData_milvus_2eproto.base,
+  &scc_info_VectorsIdentity_milvus_2eproto.base,
 };
 static ::PROTOBUF_NAMESPACE_ID::internal::once_flag descriptor_table_milvus_2eproto_once;
 static bool descriptor_table_milvus_2eproto_initialized = false;
 const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_milvus_2eproto = {
-  &descriptor_table_milvus_2eproto_initialized, descriptor_table_protodef_milvus_2eproto, "milvus.proto", 3788,
-  &descriptor_table_milvus_2eproto_once, descriptor_table_milvus_2eproto_sccs, descriptor_table_milvus_2eproto_deps, 26, 1,
+  &descriptor_table_milvus_2eproto_initialized, descriptor_table_protodef_milvus_2eproto, "milvus.proto", 4019,
+  &descriptor_table_milvus_2eproto_once, descriptor_table_milvus_2eproto_sccs, descriptor_table_milvus_2eproto_deps, 28, 1,
   schemas, file_default_instances, TableStruct_milvus_2eproto::offsets,
-  file_level_metadata_milvus_2eproto, 26, file_level_enum_descriptors_milvus_2eproto, file_level_service_descriptors_milvus_2eproto,
+  file_level_metadata_milvus_2eproto, 28, file_level_enum_descriptors_milvus_2eproto, file_level_service_descriptors_milvus_2eproto,
 };
 
 // Force running AddDescriptors() at dynamic initialization time.
@@ -10154,54 +10218,719 @@ void GetVectorIDsParam::InternalSwap(GetVectorIDsParam* other) {
 }
 
 
-// @@protoc_insertion_point(namespace_scope)
-}  // namespace grpc
-}  // namespace milvus
-PROTOBUF_NAMESPACE_OPEN
-template<> PROTOBUF_NOINLINE ::milvus::grpc::TableName* Arena::CreateMaybeMessage< ::milvus::grpc::TableName >(Arena* arena) {
-  return Arena::CreateInternal< ::milvus::grpc::TableName >(arena);
-}
-template<> PROTOBUF_NOINLINE ::milvus::grpc::TableNameList* Arena::CreateMaybeMessage< ::milvus::grpc::TableNameList >(Arena* arena) {
-  return Arena::CreateInternal< ::milvus::grpc::TableNameList >(arena);
+// ===================================================================
+
+void VectorsIdentity::InitAsDefaultInstance() {
 }
-template<> PROTOBUF_NOINLINE ::milvus::grpc::TableSchema* Arena::CreateMaybeMessage< ::milvus::grpc::TableSchema >(Arena* arena) {
-  return Arena::CreateInternal< ::milvus::grpc::TableSchema >(arena);
+class VectorsIdentity::_Internal {
+ public:
+};
+
+VectorsIdentity::VectorsIdentity()
+  : ::PROTOBUF_NAMESPACE_ID::Message(), _internal_metadata_(nullptr) {
+  SharedCtor();
+  // @@protoc_insertion_point(constructor:milvus.grpc.VectorsIdentity)
 }
-template<> PROTOBUF_NOINLINE ::milvus::grpc::PartitionParam* Arena::CreateMaybeMessage< ::milvus::grpc::PartitionParam >(Arena* arena) {
-  return Arena::CreateInternal< ::milvus::grpc::PartitionParam >(arena);
+VectorsIdentity::VectorsIdentity(const VectorsIdentity& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message(),
+      _internal_metadata_(nullptr),
+      id_array_(from.id_array_) {
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  table_name_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  if (!from.table_name().empty()) {
+    table_name_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.table_name_);
+  }
+  // @@protoc_insertion_point(copy_constructor:milvus.grpc.VectorsIdentity)
 }
-template<> PROTOBUF_NOINLINE ::milvus::grpc::PartitionList* Arena::CreateMaybeMessage< ::milvus::grpc::PartitionList >(Arena* arena) {
-  return Arena::CreateInternal< ::milvus::grpc::PartitionList >(arena);
+
+void VectorsIdentity::SharedCtor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_VectorsIdentity_milvus_2eproto.base);
+  table_name_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
 }
-template<> PROTOBUF_NOINLINE ::milvus::grpc::RowRecord* Arena::CreateMaybeMessage< ::milvus::grpc::RowRecord >(Arena* arena) {
-  return Arena::CreateInternal< ::milvus::grpc::RowRecord >(arena);
+
+VectorsIdentity::~VectorsIdentity() {
+  // @@protoc_insertion_point(destructor:milvus.grpc.VectorsIdentity)
+  SharedDtor();
 }
-template<> PROTOBUF_NOINLINE ::milvus::grpc::InsertParam* Arena::CreateMaybeMessage< ::milvus::grpc::InsertParam >(Arena* arena) {
-  return Arena::CreateInternal< ::milvus::grpc::InsertParam >(arena);
+
+void VectorsIdentity::SharedDtor() {
+  table_name_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
 }
-template<> PROTOBUF_NOINLINE ::milvus::grpc::VectorIds* Arena::CreateMaybeMessage< ::milvus::grpc::VectorIds >(Arena* arena) {
-  return Arena::CreateInternal< ::milvus::grpc::VectorIds >(arena);
+
+void VectorsIdentity::SetCachedSize(int size) const {
+  _cached_size_.Set(size);
 }
-template<> PROTOBUF_NOINLINE ::milvus::grpc::SearchParam* Arena::CreateMaybeMessage< ::milvus::grpc::SearchParam >(Arena* arena) {
-  return Arena::CreateInternal< ::milvus::grpc::SearchParam >(arena);
+const VectorsIdentity& VectorsIdentity::default_instance() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_VectorsIdentity_milvus_2eproto.base);
+  return *internal_default_instance();
 }
-template<> PROTOBUF_NOINLINE ::milvus::grpc::SearchInFilesParam* Arena::CreateMaybeMessage< ::milvus::grpc::SearchInFilesParam >(Arena* arena) {
-  return Arena::CreateInternal< ::milvus::grpc::SearchInFilesParam >(arena);
+
+
+void VectorsIdentity::Clear() {
+// @@protoc_insertion_point(message_clear_start:milvus.grpc.VectorsIdentity)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  id_array_.Clear();
+  table_name_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _internal_metadata_.Clear();
 }
-template<> PROTOBUF_NOINLINE ::milvus::grpc::SearchByIDParam* Arena::CreateMaybeMessage< ::milvus::grpc::SearchByIDParam >(Arena* arena) {
-  return Arena::CreateInternal< ::milvus::grpc::SearchByIDParam >(arena);
+
+#if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+const char* VectorsIdentity::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
+    CHK_(ptr);
+    switch (tag >> 3) {
+      // string table_name = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParserUTF8(mutable_table_name(), ptr, ctx, "milvus.grpc.VectorsIdentity.table_name");
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // repeated int64 id_array = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 18)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedInt64Parser(mutable_id_array(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 16) {
+          add_id_array(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint(&ptr));
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      default: {
+      handle_unusual:
+        if ((tag & 7) == 4 || tag == 0) {
+          ctx->SetLastTag(tag);
+          goto success;
+        }
+        ptr = UnknownFieldParse(tag, &_internal_metadata_, ptr, ctx);
+        CHK_(ptr != nullptr);
+        continue;
+      }
+    }  // switch
+  }  // while
+success:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto success;
+#undef CHK_
 }
-template<> PROTOBUF_NOINLINE ::milvus::grpc::TopKQueryResult* Arena::CreateMaybeMessage< ::milvus::grpc::TopKQueryResult >(Arena* arena) {
-  return Arena::CreateInternal< ::milvus::grpc::TopKQueryResult >(arena);
+#else  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+bool VectorsIdentity::MergePartialFromCodedStream(
+    ::PROTOBUF_NAMESPACE_ID::io::CodedInputStream* input) {
+#define DO_(EXPRESSION) if (!PROTOBUF_PREDICT_TRUE(EXPRESSION)) goto failure
+  ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+  // @@protoc_insertion_point(parse_start:milvus.grpc.VectorsIdentity)
+  for (;;) {
+    ::std::pair<::PROTOBUF_NAMESPACE_ID::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
+    tag = p.first;
+    if (!p.second) goto handle_unusual;
+    switch (::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+      // string table_name = 1;
+      case 1: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (10 & 0xFF)) {
+          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadString(
+                input, this->mutable_table_name()));
+          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+            this->table_name().data(), static_cast<int>(this->table_name().length()),
+            ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::PARSE,
+            "milvus.grpc.VectorsIdentity.table_name"));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // repeated int64 id_array = 2;
+      case 2: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (18 & 0xFF)) {
+          DO_((::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadPackedPrimitive<
+                   ::PROTOBUF_NAMESPACE_ID::int64, ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT64>(
+                 input, this->mutable_id_array())));
+        } else if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (16 & 0xFF)) {
+          DO_((::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadRepeatedPrimitiveNoInline<
+                   ::PROTOBUF_NAMESPACE_ID::int64, ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT64>(
+                 1, 18u, input, this->mutable_id_array())));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      default: {
+      handle_unusual:
+        if (tag == 0) {
+          goto success;
+        }
+        DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SkipField(
+              input, tag, _internal_metadata_.mutable_unknown_fields()));
+        break;
+      }
+    }
+  }
+success:
+  // @@protoc_insertion_point(parse_success:milvus.grpc.VectorsIdentity)
+  return true;
+failure:
+  // @@protoc_insertion_point(parse_failure:milvus.grpc.VectorsIdentity)
+  return false;
+#undef DO_
 }
-template<> PROTOBUF_NOINLINE ::milvus::grpc::StringReply* Arena::CreateMaybeMessage< ::milvus::grpc::StringReply >(Arena* arena) {
-  return Arena::CreateInternal< ::milvus::grpc::StringReply >(arena);
+#endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+
+void VectorsIdentity::SerializeWithCachedSizes(
+    ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream* output) const {
+  // @@protoc_insertion_point(serialize_start:milvus.grpc.VectorsIdentity)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string table_name = 1;
+  if (this->table_name().size() > 0) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->table_name().data(), static_cast<int>(this->table_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "milvus.grpc.VectorsIdentity.table_name");
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteStringMaybeAliased(
+      1, this->table_name(), output);
+  }
+
+  // repeated int64 id_array = 2;
+  if (this->id_array_size() > 0) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteTag(2, ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED, output);
+    output->WriteVarint32(_id_array_cached_byte_size_.load(
+        std::memory_order_relaxed));
+  }
+  for (int i = 0, n = this->id_array_size(); i < n; i++) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt64NoTag(
+      this->id_array(i), output);
+  }
+
+  if (_internal_metadata_.have_unknown_fields()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SerializeUnknownFields(
+        _internal_metadata_.unknown_fields(), output);
+  }
+  // @@protoc_insertion_point(serialize_end:milvus.grpc.VectorsIdentity)
 }
-template<> PROTOBUF_NOINLINE ::milvus::grpc::BoolReply* Arena::CreateMaybeMessage< ::milvus::grpc::BoolReply >(Arena* arena) {
-  return Arena::CreateInternal< ::milvus::grpc::BoolReply >(arena);
+
+::PROTOBUF_NAMESPACE_ID::uint8* VectorsIdentity::InternalSerializeWithCachedSizesToArray(
+    ::PROTOBUF_NAMESPACE_ID::uint8* target) const {
+  // @@protoc_insertion_point(serialize_to_array_start:milvus.grpc.VectorsIdentity)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string table_name = 1;
+  if (this->table_name().size() > 0) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->table_name().data(), static_cast<int>(this->table_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "milvus.grpc.VectorsIdentity.table_name");
+    target =
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteStringToArray(
+        1, this->table_name(), target);
+  }
+
+  // repeated int64 id_array = 2;
+  if (this->id_array_size() > 0) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteTagToArray(
+      2,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED,
+      target);
+    target = ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream::WriteVarint32ToArray(
+        _id_array_cached_byte_size_.load(std::memory_order_relaxed),
+         target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      WriteInt64NoTagToArray(this->id_array_, target);
+  }
+
+  if (_internal_metadata_.have_unknown_fields()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields(), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:milvus.grpc.VectorsIdentity)
+  return target;
 }
-template<> PROTOBUF_NOINLINE ::milvus::grpc::TableRowCount* Arena::CreateMaybeMessage< ::milvus::grpc::TableRowCount >(Arena* arena) {
-  return Arena::CreateInternal< ::milvus::grpc::TableRowCount >(arena);
+
+size_t VectorsIdentity::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:milvus.grpc.VectorsIdentity)
+  size_t total_size = 0;
+
+  if (_internal_metadata_.have_unknown_fields()) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::ComputeUnknownFieldsSize(
+        _internal_metadata_.unknown_fields());
+  }
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated int64 id_array = 2;
+  {
+    size_t data_size = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      Int64Size(this->id_array_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
+            static_cast<::PROTOBUF_NAMESPACE_ID::int32>(data_size));
+    }
+    int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(data_size);
+    _id_array_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  // string table_name = 1;
+  if (this->table_name().size() > 0) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->table_name());
+  }
+
+  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void VectorsIdentity::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:milvus.grpc.VectorsIdentity)
+  GOOGLE_DCHECK_NE(&from, this);
+  const VectorsIdentity* source =
+      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<VectorsIdentity>(
+          &from);
+  if (source == nullptr) {
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:milvus.grpc.VectorsIdentity)
+    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
+  } else {
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:milvus.grpc.VectorsIdentity)
+    MergeFrom(*source);
+  }
+}
+
+void VectorsIdentity::MergeFrom(const VectorsIdentity& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:milvus.grpc.VectorsIdentity)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  id_array_.MergeFrom(from.id_array_);
+  if (from.table_name().size() > 0) {
+
+    table_name_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.table_name_);
+  }
+}
+
+void VectorsIdentity::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:milvus.grpc.VectorsIdentity)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void VectorsIdentity::CopyFrom(const VectorsIdentity& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:milvus.grpc.VectorsIdentity)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool VectorsIdentity::IsInitialized() const {
+  return true;
+}
+
+void VectorsIdentity::InternalSwap(VectorsIdentity* other) {
+  using std::swap;
+  _internal_metadata_.Swap(&other->_internal_metadata_);
+  id_array_.InternalSwap(&other->id_array_);
+  table_name_.Swap(&other->table_name_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
+    GetArenaNoVirtual());
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata VectorsIdentity::GetMetadata() const {
+  return GetMetadataStatic();
+}
+
+
+// ===================================================================
+
+void VectorsData::InitAsDefaultInstance() {
+  ::milvus::grpc::_VectorsData_default_instance_._instance.get_mutable()->status_ = const_cast< ::milvus::grpc::Status*>(
+      ::milvus::grpc::Status::internal_default_instance());
+}
+class VectorsData::_Internal {
+ public:
+  static const ::milvus::grpc::Status& status(const VectorsData* msg);
+};
+
+const ::milvus::grpc::Status&
+VectorsData::_Internal::status(const VectorsData* msg) {
+  return *msg->status_;
+}
+void VectorsData::clear_status() {
+  if (GetArenaNoVirtual() == nullptr && status_ != nullptr) {
+    delete status_;
+  }
+  status_ = nullptr;
+}
+VectorsData::VectorsData()
+  : ::PROTOBUF_NAMESPACE_ID::Message(), _internal_metadata_(nullptr) {
+  SharedCtor();
+  // @@protoc_insertion_point(constructor:milvus.grpc.VectorsData)
+}
+VectorsData::VectorsData(const VectorsData& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message(),
+      _internal_metadata_(nullptr),
+      vectors_data_(from.vectors_data_) {
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  if (from.has_status()) {
+    status_ = new ::milvus::grpc::Status(*from.status_);
+  } else {
+    status_ = nullptr;
+  }
+  // @@protoc_insertion_point(copy_constructor:milvus.grpc.VectorsData)
+}
+
+void VectorsData::SharedCtor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_VectorsData_milvus_2eproto.base);
+  status_ = nullptr;
+}
+
+VectorsData::~VectorsData() {
+  // @@protoc_insertion_point(destructor:milvus.grpc.VectorsData)
+  SharedDtor();
+}
+
+void VectorsData::SharedDtor() {
+  if (this != internal_default_instance()) delete status_;
+}
+
+void VectorsData::SetCachedSize(int size) const {
+  _cached_size_.Set(size);
+}
+const VectorsData& VectorsData::default_instance() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_VectorsData_milvus_2eproto.base);
+  return *internal_default_instance();
+}
+
+
+void VectorsData::Clear() {
+// @@protoc_insertion_point(message_clear_start:milvus.grpc.VectorsData)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  vectors_data_.Clear();
+  if (GetArenaNoVirtual() == nullptr && status_ != nullptr) {
+    delete status_;
+  }
+  status_ = nullptr;
+  _internal_metadata_.Clear();
+}
+
+#if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+const char* VectorsData::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
+    CHK_(ptr);
+    switch (tag >> 3) {
+      // .milvus.grpc.Status status = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
+          ptr = ctx->ParseMessage(mutable_status(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // repeated .milvus.grpc.RowRecord vectors_data = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 18)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(add_vectors_data(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<::PROTOBUF_NAMESPACE_ID::uint8>(ptr) == 18);
+        } else goto handle_unusual;
+        continue;
+      default: {
+      handle_unusual:
+        if ((tag & 7) == 4 || tag == 0) {
+          ctx->SetLastTag(tag);
+          goto success;
+        }
+        ptr = UnknownFieldParse(tag, &_internal_metadata_, ptr, ctx);
+        CHK_(ptr != nullptr);
+        continue;
+      }
+    }  // switch
+  }  // while
+success:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto success;
+#undef CHK_
+}
+#else  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+bool VectorsData::MergePartialFromCodedStream(
+    ::PROTOBUF_NAMESPACE_ID::io::CodedInputStream* input) {
+#define DO_(EXPRESSION) if (!PROTOBUF_PREDICT_TRUE(EXPRESSION)) goto failure
+  ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+  // @@protoc_insertion_point(parse_start:milvus.grpc.VectorsData)
+  for (;;) {
+    ::std::pair<::PROTOBUF_NAMESPACE_ID::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
+    tag = p.first;
+    if (!p.second) goto handle_unusual;
+    switch (::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+      // .milvus.grpc.Status status = 1;
+      case 1: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (10 & 0xFF)) {
+          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadMessage(
+               input, mutable_status()));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // repeated .milvus.grpc.RowRecord vectors_data = 2;
+      case 2: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (18 & 0xFF)) {
+          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadMessage(
+                input, add_vectors_data()));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      default: {
+      handle_unusual:
+        if (tag == 0) {
+          goto success;
+        }
+        DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SkipField(
+              input, tag, _internal_metadata_.mutable_unknown_fields()));
+        break;
+      }
+    }
+  }
+success:
+  // @@protoc_insertion_point(parse_success:milvus.grpc.VectorsData)
+  return true;
+failure:
+  // @@protoc_insertion_point(parse_failure:milvus.grpc.VectorsData)
+  return false;
+#undef DO_
+}
+#endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+
+void VectorsData::SerializeWithCachedSizes(
+    ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream* output) const {
+  // @@protoc_insertion_point(serialize_start:milvus.grpc.VectorsData)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .milvus.grpc.Status status = 1;
+  if (this->has_status()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteMessageMaybeToArray(
+      1, _Internal::status(this), output);
+  }
+
+  // repeated .milvus.grpc.RowRecord vectors_data = 2;
+  for (unsigned int i = 0,
+      n = static_cast<unsigned int>(this->vectors_data_size()); i < n; i++) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteMessageMaybeToArray(
+      2,
+      this->vectors_data(static_cast<int>(i)),
+      output);
+  }
+
+  if (_internal_metadata_.have_unknown_fields()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SerializeUnknownFields(
+        _internal_metadata_.unknown_fields(), output);
+  }
+  // @@protoc_insertion_point(serialize_end:milvus.grpc.VectorsData)
+}
+
+::PROTOBUF_NAMESPACE_ID::uint8* VectorsData::InternalSerializeWithCachedSizesToArray(
+    ::PROTOBUF_NAMESPACE_ID::uint8* target) const {
+  // @@protoc_insertion_point(serialize_to_array_start:milvus.grpc.VectorsData)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .milvus.grpc.Status status = 1;
+  if (this->has_status()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessageToArray(
+        1, _Internal::status(this), target);
+  }
+
+  // repeated .milvus.grpc.RowRecord vectors_data = 2;
+  for (unsigned int i = 0,
+      n = static_cast<unsigned int>(this->vectors_data_size()); i < n; i++) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessageToArray(
+        2, this->vectors_data(static_cast<int>(i)), target);
+  }
+
+  if (_internal_metadata_.have_unknown_fields()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields(), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:milvus.grpc.VectorsData)
+  return target;
+}
+
+size_t VectorsData::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:milvus.grpc.VectorsData)
+  size_t total_size = 0;
+
+  if (_internal_metadata_.have_unknown_fields()) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::ComputeUnknownFieldsSize(
+        _internal_metadata_.unknown_fields());
+  }
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .milvus.grpc.RowRecord vectors_data = 2;
+  {
+    unsigned int count = static_cast<unsigned int>(this->vectors_data_size());
+    total_size += 1UL * count;
+    for (unsigned int i = 0; i < count; i++) {
+      total_size +=
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          this->vectors_data(static_cast<int>(i)));
+    }
+  }
+
+  // .milvus.grpc.Status status = 1;
+  if (this->has_status()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *status_);
+  }
+
+  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void VectorsData::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:milvus.grpc.VectorsData)
+  GOOGLE_DCHECK_NE(&from, this);
+  const VectorsData* source =
+      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<VectorsData>(
+          &from);
+  if (source == nullptr) {
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:milvus.grpc.VectorsData)
+    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
+  } else {
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:milvus.grpc.VectorsData)
+    MergeFrom(*source);
+  }
+}
+
+void VectorsData::MergeFrom(const VectorsData& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:milvus.grpc.VectorsData)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  vectors_data_.MergeFrom(from.vectors_data_);
+  if (from.has_status()) {
+    mutable_status()->::milvus::grpc::Status::MergeFrom(from.status());
+  }
+}
+
+void VectorsData::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:milvus.grpc.VectorsData)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void VectorsData::CopyFrom(const VectorsData& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:milvus.grpc.VectorsData)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool VectorsData::IsInitialized() const {
+  return true;
+}
+
+void VectorsData::InternalSwap(VectorsData* other) {
+  using std::swap;
+  _internal_metadata_.Swap(&other->_internal_metadata_);
+  CastToBase(&vectors_data_)->InternalSwap(CastToBase(&other->vectors_data_));
+  swap(status_, other->status_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata VectorsData::GetMetadata() const {
+  return GetMetadataStatic();
+}
+
+
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace grpc
+}  // namespace milvus
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::milvus::grpc::TableName* Arena::CreateMaybeMessage< ::milvus::grpc::TableName >(Arena* arena) {
+  return Arena::CreateInternal< ::milvus::grpc::TableName >(arena);
+}
+template<> PROTOBUF_NOINLINE ::milvus::grpc::TableNameList* Arena::CreateMaybeMessage< ::milvus::grpc::TableNameList >(Arena* arena) {
+  return Arena::CreateInternal< ::milvus::grpc::TableNameList >(arena);
+}
+template<> PROTOBUF_NOINLINE ::milvus::grpc::TableSchema* Arena::CreateMaybeMessage< ::milvus::grpc::TableSchema >(Arena* arena) {
+  return Arena::CreateInternal< ::milvus::grpc::TableSchema >(arena);
+}
+template<> PROTOBUF_NOINLINE ::milvus::grpc::PartitionParam* Arena::CreateMaybeMessage< ::milvus::grpc::PartitionParam >(Arena* arena) {
+  return Arena::CreateInternal< ::milvus::grpc::PartitionParam >(arena);
+}
+template<> PROTOBUF_NOINLINE ::milvus::grpc::PartitionList* Arena::CreateMaybeMessage< ::milvus::grpc::PartitionList >(Arena* arena) {
+  return Arena::CreateInternal< ::milvus::grpc::PartitionList >(arena);
+}
+template<> PROTOBUF_NOINLINE ::milvus::grpc::RowRecord* Arena::CreateMaybeMessage< ::milvus::grpc::RowRecord >(Arena* arena) {
+  return Arena::CreateInternal< ::milvus::grpc::RowRecord >(arena);
+}
+template<> PROTOBUF_NOINLINE ::milvus::grpc::InsertParam* Arena::CreateMaybeMessage< ::milvus::grpc::InsertParam >(Arena* arena) {
+  return Arena::CreateInternal< ::milvus::grpc::InsertParam >(arena);
+}
+template<> PROTOBUF_NOINLINE ::milvus::grpc::VectorIds* Arena::CreateMaybeMessage< ::milvus::grpc::VectorIds >(Arena* arena) {
+  return Arena::CreateInternal< ::milvus::grpc::VectorIds >(arena);
+}
+template<> PROTOBUF_NOINLINE ::milvus::grpc::SearchParam* Arena::CreateMaybeMessage< ::milvus::grpc::SearchParam >(Arena* arena) {
+  return Arena::CreateInternal< ::milvus::grpc::SearchParam >(arena);
+}
+template<> PROTOBUF_NOINLINE ::milvus::grpc::SearchInFilesParam* Arena::CreateMaybeMessage< ::milvus::grpc::SearchInFilesParam >(Arena* arena) {
+  return Arena::CreateInternal< ::milvus::grpc::SearchInFilesParam >(arena);
+}
+template<> PROTOBUF_NOINLINE ::milvus::grpc::SearchByIDParam* Arena::CreateMaybeMessage< ::milvus::grpc::SearchByIDParam >(Arena* arena) {
+  return Arena::CreateInternal< ::milvus::grpc::SearchByIDParam >(arena);
+}
+template<> PROTOBUF_NOINLINE ::milvus::grpc::TopKQueryResult* Arena::CreateMaybeMessage< ::milvus::grpc::TopKQueryResult >(Arena* arena) {
+  return Arena::CreateInternal< ::milvus::grpc::TopKQueryResult >(arena);
+}
+template<> PROTOBUF_NOINLINE ::milvus::grpc::StringReply* Arena::CreateMaybeMessage< ::milvus::grpc::StringReply >(Arena* arena) {
+  return Arena::CreateInternal< ::milvus::grpc::StringReply >(arena);
+}
+template<> PROTOBUF_NOINLINE ::milvus::grpc::BoolReply* Arena::CreateMaybeMessage< ::milvus::grpc::BoolReply >(Arena* arena) {
+  return Arena::CreateInternal< ::milvus::grpc::BoolReply >(arena);
+}
+template<> PROTOBUF_NOINLINE ::milvus::grpc::TableRowCount* Arena::CreateMaybeMessage< ::milvus::grpc::TableRowCount >(Arena* arena) {
+  return Arena::CreateInternal< ::milvus::grpc::TableRowCount >(arena);
 }
 template<> PROTOBUF_NOINLINE ::milvus::grpc::Command* Arena::CreateMaybeMessage< ::milvus::grpc::Command >(Arena* arena) {
   return Arena::CreateInternal< ::milvus::grpc::Command >(arena);
@@ -10236,6 +10965,12 @@ template<> PROTOBUF_NOINLINE ::milvus::grpc::VectorData* Arena::CreateMaybeMessa
 template<> PROTOBUF_NOINLINE ::milvus::grpc::GetVectorIDsParam* Arena::CreateMaybeMessage< ::milvus::grpc::GetVectorIDsParam >(Arena* arena) {
   return Arena::CreateInternal< ::milvus::grpc::GetVectorIDsParam >(arena);
 }
+template<> PROTOBUF_NOINLINE ::milvus::grpc::VectorsIdentity* Arena::CreateMaybeMessage< ::milvus::grpc::VectorsIdentity >(Arena* arena) {
+  return Arena::CreateInternal< ::milvus::grpc::VectorsIdentity >(arena);
+}
+template<> PROTOBUF_NOINLINE ::milvus::grpc::VectorsData* Arena::CreateMaybeMessage< ::milvus::grpc::VectorsData >(Arena* arena) {
+  return Arena::CreateInternal< ::milvus::grpc::VectorsData >(arena);
+}
 PROTOBUF_NAMESPACE_CLOSE
 
 // @@protoc_insertion_point(global_scope)
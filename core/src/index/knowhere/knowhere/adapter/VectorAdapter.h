@@ -22,6 +22,7 @@ extern const char* TENSOR;
 extern const char* ROWS;
 extern const char* IDS;
 extern const char* DISTANCE;
+extern const char* CENTROIDS;
 };  // namespace meta
 
 #define GETTENSOR(dataset)                         \
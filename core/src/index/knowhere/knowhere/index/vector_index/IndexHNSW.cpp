@@ -107,7 +107,7 @@ IndexHNSW::Search(const DatasetPtr& dataset, const Config& config) {
         // } else {
         //     ret = index_->searchKnn((float*)single_query, config->k, compare);
         // }
-        ret = index_->searchKnn((float*)single_query, config->k, compare);
+        ret = index_->searchKnn((float*)single_query, config->k, compare, bitset_);
 
         while (ret.size() < config->k) {
             ret.push_back(std::make_pair(-1, -1));
@@ -213,4 +213,14 @@ IndexHNSW::Dimension() {
     return (*(size_t*)index_->dist_func_param_);
 }
 
+void
+IndexHNSW::SetBlacklist(faiss::ConcurrentBitsetPtr list) {
+    bitset_ = std::move(list);
+}
+
+void
+IndexHNSW::GetBlacklist(faiss::ConcurrentBitsetPtr& list) {
+    list = bitset_;
+}
+
 }  // namespace knowhere
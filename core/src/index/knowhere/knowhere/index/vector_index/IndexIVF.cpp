@@ -53,12 +53,27 @@ IVF::Train(const DatasetPtr& dataset, const Config& config) {
     faiss::Index* coarse_quantizer = new faiss::IndexFlatL2(dim);
     auto index = std::make_shared<faiss::IndexIVFFlat>(coarse_quantizer, dim, build_cfg->nlist,
                                                        GetMetricType(build_cfg->metric_type));
+    LoadCoarseCentroids(dataset, index.get());
     index->train(rows, (float*)p_data);
 
     // TODO(linxj): override here. train return model or not.
     return std::make_shared<IVFIndexModel>(index);
 }
 
+void
+IVF::LoadCoarseCentroids(const DatasetPtr& dataset, faiss::IndexIVF* index) {
+    auto& data = dataset->data();
+    if (data.find(meta::CENTROIDS) == data.end()) {
+        return;
+    }
+
+    // a quantizer already holding nlist centroids is not trained again by faiss, only the residual encoding is
+    auto centroids = dataset->Get<const float*>(meta::CENTROIDS);
+    index->quantizer->reset();
+    index->quantizer->add(index->nlist, centroids);
+    index->quantizer->is_trained = true;
+}
+
 void
 IVF::Add(const DatasetPtr& dataset, const Config& config) {
     if (!index_ || !index_->is_trained) {
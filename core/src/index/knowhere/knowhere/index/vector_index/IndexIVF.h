@@ -88,6 +88,10 @@ class IVF : public VectorIndex, public FaissBaseIndex {
     virtual std::shared_ptr<faiss::IVFSearchParameters>
     GenParams(const Config& config);
 
+    // use the coarse centroids given in the dataset, if any, instead of training the quantizer
+    static void
+    LoadCoarseCentroids(const DatasetPtr& dataset, faiss::IndexIVF* index);
+
     //    virtual VectorIndexPtr
     //    Clone_impl(const std::shared_ptr<faiss::Index>& index);
 
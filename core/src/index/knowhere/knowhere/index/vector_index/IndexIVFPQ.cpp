@@ -40,6 +40,7 @@ IVFPQ::Train(const DatasetPtr& dataset, const Config& config) {
     faiss::Index* coarse_quantizer = new faiss::IndexFlat(dim, GetMetricType(build_cfg->metric_type));
     auto index =
         std::make_shared<faiss::IndexIVFPQ>(coarse_quantizer, dim, build_cfg->nlist, build_cfg->m, build_cfg->nbits);
+    LoadCoarseCentroids(dataset, index.get());
     index->train(rows, (float*)p_data);
 
     return std::make_shared<IVFIndexModel>(index);
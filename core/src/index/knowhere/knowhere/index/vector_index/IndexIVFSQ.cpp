@@ -41,6 +41,7 @@ IVFSQ::Train(const DatasetPtr& dataset, const Config& config) {
     index_type << "IVF" << build_cfg->nlist << ","
                << "SQ" << build_cfg->nbits;
     auto build_index = faiss::index_factory(dim, index_type.str().c_str(), GetMetricType(build_cfg->metric_type));
+    LoadCoarseCentroids(dataset, dynamic_cast<faiss::IndexIVF*>(build_index));
     build_index->train(rows, (float*)p_data);
 
     std::shared_ptr<faiss::Index> ret_index;
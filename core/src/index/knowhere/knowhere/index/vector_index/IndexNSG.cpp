@@ -23,6 +23,7 @@
 #endif
 
 #include <fiu-local.h>
+#include <utility>
 #include "knowhere/index/vector_index/IndexIDMAP.h"
 #include "knowhere/index/vector_index/IndexIVF.h"
 #include "knowhere/index/vector_index/nsg/NSG.h"
@@ -91,7 +92,7 @@ NSG::Search(const DatasetPtr& dataset, const Config& config) {
 
     algo::SearchParams s_params;
     s_params.search_length = build_cfg->search_length;
-    index_->Search((float*)p_data, rows, dim, build_cfg->k, p_dist, p_id, s_params);
+    index_->Search((float*)p_data, rows, dim, build_cfg->k, p_dist, p_id, s_params, bitset_);
 
     auto ret_ds = std::make_shared<Dataset>();
     ret_ds->Set(meta::IDS, p_id);
@@ -172,4 +173,14 @@ NSG::Seal() {
     // do nothing
 }
 
+void
+NSG::SetBlacklist(faiss::ConcurrentBitsetPtr list) {
+    bitset_ = std::move(list);
+}
+
+void
+NSG::GetBlacklist(faiss::ConcurrentBitsetPtr& list) {
+    list = bitset_;
+}
+
 }  // namespace knowhere
@@ -15,6 +15,7 @@
 #include <vector>
 
 #include "VectorIndex.h"
+#include "faiss/utils/ConcurrentBitset.h"
 
 namespace knowhere {
 
@@ -48,9 +49,16 @@ class NSG : public VectorIndex {
     void
     Seal() override;
 
+    void
+    SetBlacklist(faiss::ConcurrentBitsetPtr list);
+
+    void
+    GetBlacklist(faiss::ConcurrentBitsetPtr& list);
+
  private:
     std::shared_ptr<algo::NsgIndex> index_;
     int64_t gpu_;
+    faiss::ConcurrentBitsetPtr bitset_ = nullptr;
 };
 
 using NSGIndexPtr = std::shared_ptr<NSG>();
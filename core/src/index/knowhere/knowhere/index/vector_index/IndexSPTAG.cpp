@@ -15,6 +15,7 @@
 
 #include <array>
 #include <sstream>
+#include <utility>
 #include <vector>
 
 #undef mkdir
@@ -229,7 +230,14 @@ CPUSPTAGRNG::Search(const DatasetPtr& dataset, const Config& config) {
     for (auto i = 0; i < query_results.size(); ++i) {
         auto target = (float*)query_results[i].GetTarget();
         std::cout << target[0] << ", " << target[1] << ", " << target[2] << std::endl;
-        index_ptr_->SearchIndex(query_results[i]);
+        if (bitset_ != nullptr) {
+            // vector ids follow the insertion order, the same as the offsets in the blacklist
+            auto bitset = bitset_.get();
+            auto filtered = [bitset](SPTAG::SizeType id) { return bitset->test(id); };
+            index_ptr_->SearchIndexWithFilter(query_results[i], filtered);
+        } else {
+            index_ptr_->SearchIndex(query_results[i]);
+        }
     }
 
     return ConvertToDataset(query_results);
@@ -255,6 +263,16 @@ CPUSPTAGRNG::Seal() {
     return;  // do nothing
 }
 
+void
+CPUSPTAGRNG::SetBlacklist(faiss::ConcurrentBitsetPtr list) {
+    bitset_ = std::move(list);
+}
+
+void
+CPUSPTAGRNG::GetBlacklist(faiss::ConcurrentBitsetPtr& list) {
+    list = bitset_;
+}
+
 BinarySet
 CPUSPTAGRNGIndexModel::Serialize() {
     //    KNOWHERE_THROW_MSG("not support"); // not support
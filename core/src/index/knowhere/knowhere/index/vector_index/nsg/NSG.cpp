@@ -702,7 +702,7 @@ NsgIndex::FindUnconnectedNode(boost::dynamic_bitset<>& has_linked, int64_t& root
 
 void
 NsgIndex::Search(const float* query, const unsigned& nq, const unsigned& dim, const unsigned& k, float* dist,
-                 int64_t* ids, SearchParams& params) {
+                 int64_t* ids, SearchParams& params, const faiss::ConcurrentBitsetPtr& bitset) {
     std::vector<std::vector<Neighbor>> resset(nq);
 
     if (k >= 45) {
@@ -722,21 +722,20 @@ NsgIndex::Search(const float* query, const unsigned& nq, const unsigned& dim, co
     }
     rc.RecordSection("search");
     for (unsigned int i = 0; i < nq; ++i) {
-        int64_t var = resset[i].size() - k;
-        if (var >= 0) {
-            for (unsigned int j = 0; j < k; ++j) {
-                ids[i * k + j] = ids_[resset[i][j].id];
-                dist[i * k + j] = resset[i][j].distance;
-            }
-        } else {
-            for (unsigned int j = 0; j < resset[i].size(); ++j) {
-                ids[i * k + j] = ids_[resset[i][j].id];
-                dist[i * k + j] = resset[i][j].distance;
-            }
-            for (unsigned int j = resset[i].size(); j < k; ++j) {
-                ids[i * k + j] = -1;
-                dist[i * k + j] = -1;
+        // the pool is sorted by distance, deleted nodes in it have only served the navigation
+        unsigned int pos = 0;
+        for (size_t j = 0; j < resset[i].size() && pos < k; ++j) {
+            int64_t id = ids_[resset[i][j].id];
+            if (bitset != nullptr && bitset->test(id)) {
+                continue;
             }
+            ids[i * k + pos] = id;
+            dist[i * k + pos] = resset[i][j].distance;
+            ++pos;
+        }
+        for (; pos < k; ++pos) {
+            ids[i * k + pos] = -1;
+            dist[i * k + pos] = -1;
         }
     }
     rc.RecordSection("merge");
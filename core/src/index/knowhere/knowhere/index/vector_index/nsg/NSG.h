@@ -19,6 +19,7 @@
 
 #include "Distance.h"
 #include "Neighbor.h"
+#include "faiss/utils/ConcurrentBitset.h"
 #include "knowhere/common/Config.h"
 
 namespace knowhere {
@@ -74,9 +75,10 @@ class NsgIndex {
     virtual void
     Build_with_ids(size_t nb, const float* data, const int64_t* ids, const BuildParams& parameters);
 
+    // nodes whose ids are set in the bitset are still visited, but left out of the results
     void
     Search(const float* query, const unsigned& nq, const unsigned& dim, const unsigned& k, float* dist, int64_t* ids,
-           SearchParams& params);
+           SearchParams& params, const faiss::ConcurrentBitsetPtr& bitset = nullptr);
 
     // Not support yet.
     // virtual void Add() = 0;
@@ -111,6 +111,7 @@ namespace SPTAG
 
             ErrorCode BuildIndex(const void* p_data, SizeType p_vectorNum, DimensionType p_dimension);
             ErrorCode SearchIndex(QueryResult &p_query) const;
+            ErrorCode SearchIndexWithFilter(QueryResult &p_query, const std::function<bool(SizeType)> &p_filtered) const;
             ErrorCode AddIndex(const void* p_vectors, SizeType p_vectorNum, DimensionType p_dimension, SizeType* p_start = nullptr);
             ErrorCode DeleteIndex(const void* p_vectors, SizeType p_vectorNum);
             ErrorCode DeleteIndex(const SizeType& p_id);
@@ -124,6 +125,7 @@ namespace SPTAG
         private:
             void SearchIndexWithDeleted(COMMON::QueryResultSet<T> &p_query, COMMON::WorkSpace &p_space, const Helper::Concurrent::ConcurrentSet<SizeType> &p_deleted) const;
             void SearchIndexWithoutDeleted(COMMON::QueryResultSet<T> &p_query, COMMON::WorkSpace &p_space) const;
+            void SearchIndexWithFilter(COMMON::QueryResultSet<T> &p_query, COMMON::WorkSpace &p_space, const std::function<bool(SizeType)> &p_filtered) const;
         };
     } // namespace BKT
 } // namespace SPTAG
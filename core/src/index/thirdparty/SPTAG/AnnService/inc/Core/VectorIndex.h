@@ -10,6 +10,7 @@
 #include "MetadataSet.h"
 #include "inc/Helper/SimpleIniReader.h"
 
+#include <functional>
 #include <unordered_map>
 
 namespace SPTAG
@@ -29,6 +30,11 @@ public:
     virtual ErrorCode DeleteIndex(const void* p_vectors, SizeType p_vectorNum) = 0;
 
     virtual ErrorCode SearchIndex(QueryResult& p_results) const = 0;
+
+    // Same as SearchIndex, points for which p_filtered returns true are still used to navigate the graph but are
+    // never returned.
+    virtual ErrorCode SearchIndexWithFilter(QueryResult& p_results,
+                                            const std::function<bool(SizeType)>& p_filtered) const = 0;
     
     virtual float ComputeDistance(const void* pX, const void* pY) const = 0;
     virtual const void* GetSample(const SizeType idx) const = 0;
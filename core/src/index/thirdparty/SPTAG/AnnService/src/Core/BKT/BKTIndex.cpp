@@ -154,6 +154,12 @@ namespace SPTAG
             Search(;)
         }
 
+        template <typename T>
+        void Index<T>::SearchIndexWithFilter(COMMON::QueryResultSet<T> &p_query, COMMON::WorkSpace &p_space, const std::function<bool(SizeType)> &p_filtered) const
+        {
+            Search(if (!m_deletedID.contains(gnode.node) && !p_filtered(gnode.node)))
+        }
+
         template<typename T>
         ErrorCode
             Index<T>::SearchIndex(QueryResult &p_query) const
@@ -178,6 +184,28 @@ namespace SPTAG
             }
             return ErrorCode::Success;
         }
+
+        template<typename T>
+        ErrorCode
+            Index<T>::SearchIndexWithFilter(QueryResult &p_query, const std::function<bool(SizeType)> &p_filtered) const
+        {
+            auto workSpace = m_workSpacePool->Rent();
+            workSpace->Reset(m_iMaxCheck);
+
+            SearchIndexWithFilter(*((COMMON::QueryResultSet<T>*)&p_query), *workSpace, p_filtered);
+
+            m_workSpacePool->Return(workSpace);
+
+            if (p_query.WithMeta() && nullptr != m_pMetadata)
+            {
+                for (int i = 0; i < p_query.GetResultNum(); ++i)
+                {
+                    SizeType result = p_query.GetResult(i)->VID;
+                    p_query.SetMetadata(i, (result < 0) ? ByteArray::c_empty : m_pMetadata->GetMetadata(result));
+                }
+            }
+            return ErrorCode::Success;
+        }
 #pragma endregion
 
         template <typename T>
@@ -34,12 +34,23 @@ ConcurrentBitset::test(id_type_t id) {
 
 void
 ConcurrentBitset::set(id_type_t id) {
-    bitset_[id >> 3].fetch_or(0x1 << (id & 0x7));
+    unsigned char mask = 0x1 << (id & 0x7);
+    if (!(bitset_[id >> 3].fetch_or(mask) & mask)) {
+        ++count_;
+    }
 }
 
 void
 ConcurrentBitset::clear(id_type_t id) {
-    bitset_[id >> 3].fetch_and(~(0x1 << (id & 0x7)));
+    unsigned char mask = 0x1 << (id & 0x7);
+    if (bitset_[id >> 3].fetch_and(~mask) & mask) {
+        --count_;
+    }
+}
+
+ConcurrentBitset::id_type_t
+ConcurrentBitset::count() const {
+    return count_.load();
 }
 
 }  // namespace faiss
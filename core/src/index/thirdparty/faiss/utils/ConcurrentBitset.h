@@ -42,9 +42,14 @@ class ConcurrentBitset {
     void
     clear(id_type_t id);
 
+    // number of bits currently set, lets searches skip filtering when nothing is deleted
+    id_type_t
+    count() const;
+
  private:
     std::deque<std::atomic<unsigned char>> bitset_;
     id_type_t size_;
+    std::atomic<id_type_t> count_{0};
 };
 
 using ConcurrentBitsetPtr = std::shared_ptr<ConcurrentBitset>;
@@ -8,6 +8,7 @@
 #include <list>
 
 #include "knowhere/index/vector_index/helpers/FaissIO.h"
+#include "faiss/utils/ConcurrentBitset.h"
 
 namespace hnswlib {
     typedef unsigned int tableint;
@@ -250,9 +251,15 @@ namespace hnswlib {
             return top_candidates;
         }
 
+        // deleted nodes, either marked or set in the bitset by label, are navigated but never returned
+        bool isDeleted(tableint internalId, const faiss::ConcurrentBitsetPtr &bitset) const {
+            return isMarkedDeleted(internalId) || (bitset != nullptr && bitset->test(getExternalLabel(internalId)));
+        }
+
         template <bool has_deletions>
         std::priority_queue<std::pair<dist_t, tableint>, std::vector<std::pair<dist_t, tableint>>, CompareByFirst>
-        searchBaseLayerST(tableint ep_id, const void *data_point, size_t ef) const {
+        searchBaseLayerST(tableint ep_id, const void *data_point, size_t ef,
+                          const faiss::ConcurrentBitsetPtr &bitset = nullptr) const {
             VisitedList *vl = visited_list_pool_->getFreeVisitedList();
             vl_type *visited_array = vl->mass;
             vl_type visited_array_tag = vl->curV;
@@ -261,7 +268,7 @@ namespace hnswlib {
             std::priority_queue<std::pair<dist_t, tableint>, std::vector<std::pair<dist_t, tableint>>, CompareByFirst> candidate_set;
 
             dist_t lowerBound;
-            if (!has_deletions || !isMarkedDeleted(ep_id)) {
+            if (!has_deletions || !isDeleted(ep_id, bitset)) {
                 dist_t dist = fstdistfunc_(data_point, getDataByInternalId(ep_id), dist_func_param_);
                 lowerBound = dist;
                 top_candidates.emplace(dist, ep_id);
@@ -317,7 +324,7 @@ namespace hnswlib {
                                          _MM_HINT_T0);////////////////////////
 #endif
 
-                            if (!has_deletions || !isMarkedDeleted(candidate_id))
+                            if (!has_deletions || !isDeleted(candidate_id, bitset))
                                 top_candidates.emplace(dist, candidate_id);
 
                             if (top_candidates.size() > ef)
@@ -1084,6 +1091,11 @@ namespace hnswlib {
 
         std::priority_queue<std::pair<dist_t, labeltype >>
         searchKnn(const void *query_data, size_t k) const {
+            return searchKnnWithBitset(query_data, k, nullptr);
+        }
+
+        std::priority_queue<std::pair<dist_t, labeltype >>
+        searchKnnWithBitset(const void *query_data, size_t k, const faiss::ConcurrentBitsetPtr &bitset) const {
             std::priority_queue<std::pair<dist_t, labeltype >> result;
             if (cur_element_count == 0) return result;
 
@@ -1115,9 +1127,11 @@ namespace hnswlib {
             }
 
             std::priority_queue<std::pair<dist_t, tableint>, std::vector<std::pair<dist_t, tableint>>, CompareByFirst> top_candidates;
-            if (has_deletions_) {
+            // an empty blacklist filters nothing, keep such searches on the unfiltered path
+            bool has_blacklist = bitset != nullptr && bitset->count() > 0;
+            if (has_deletions_ || has_blacklist) {
                 std::priority_queue<std::pair<dist_t, tableint>, std::vector<std::pair<dist_t, tableint>>, CompareByFirst> top_candidates1=searchBaseLayerST<true>(
-                        currObj, query_data, std::max(ef_, k));
+                        currObj, query_data, std::max(ef_, k), has_blacklist ? bitset : nullptr);
                 top_candidates.swap(top_candidates1);
             }
             else{
@@ -1138,11 +1152,11 @@ namespace hnswlib {
 
         template <typename Comp>
         std::vector<std::pair<dist_t, labeltype>>
-        searchKnn(const void* query_data, size_t k, Comp comp) {
+        searchKnn(const void* query_data, size_t k, Comp comp, const faiss::ConcurrentBitsetPtr& bitset = nullptr) {
             std::vector<std::pair<dist_t, labeltype>> result;
             if (cur_element_count == 0) return result;
 
-            auto ret = searchKnn(query_data, k);
+            auto ret = searchKnnWithBitset(query_data, k, bitset);
 
             while (!ret.empty()) {
                 result.push_back(ret.top());
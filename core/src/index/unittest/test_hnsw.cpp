@@ -0,0 +1,86 @@
+// Copyright (C) 2019-2020 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License.
+
+#include <gtest/gtest.h>
+#include <iostream>
+
+#include "knowhere/adapter/VectorAdapter.h"
+#include "knowhere/common/Exception.h"
+#include "knowhere/index/vector_index/IndexHNSW.h"
+#include "knowhere/index/vector_index/helpers/IndexParameter.h"
+#include "unittest/utils.h"
+
+class HNSWTest : public DataGen, public ::testing::Test {
+ protected:
+    void
+    SetUp() override {
+        Init_with_default();
+        index_ = std::make_shared<knowhere::IndexHNSW>();
+
+        conf_ = std::make_shared<knowhere::HNSWCfg>();
+        conf_->d = dim;
+        conf_->k = k;
+        conf_->M = 16;
+        conf_->ef = 200;
+        conf_->metric_type = knowhere::METRICTYPE::L2;
+    }
+
+ protected:
+    std::shared_ptr<knowhere::IndexHNSW> index_ = nullptr;
+    knowhere::HNSWConfig conf_ = nullptr;
+};
+
+TEST_F(HNSWTest, hnsw_basic) {
+    ASSERT_ANY_THROW(index_->Search(query_dataset, conf_));
+    ASSERT_ANY_THROW(index_->Add(base_dataset, conf_));
+
+    index_->Train(base_dataset, conf_);
+    index_->Add(base_dataset, conf_);
+    EXPECT_EQ(index_->Count(), nb);
+    EXPECT_EQ(index_->Dimension(), dim);
+
+    auto result = index_->Search(query_dataset, conf_);
+    AssertAnns(result, nq, k);
+}
+
+TEST_F(HNSWTest, hnsw_blacklist) {
+    index_->Train(base_dataset, conf_);
+    index_->Add(base_dataset, conf_);
+
+    // an empty blacklist must not change the results
+    faiss::ConcurrentBitsetPtr concurrent_bitset_ptr = std::make_shared<faiss::ConcurrentBitset>(nb);
+    ASSERT_EQ(concurrent_bitset_ptr->count(), 0);
+    index_->SetBlacklist(concurrent_bitset_ptr);
+    auto result = index_->Search(query_dataset, conf_);
+    AssertAnns(result, nq, k);
+
+    // setting a bit twice counts it once
+    for (int64_t i = 0; i < nq; ++i) {
+        concurrent_bitset_ptr->set(i);
+        concurrent_bitset_ptr->set(i);
+    }
+    ASSERT_EQ(concurrent_bitset_ptr->count(), nq);
+
+    // the blacklist is shared, so bits set after SetBlacklist are honored
+    auto result_bs = index_->Search(query_dataset, conf_);
+    AssertAnns(result_bs, nq, k, CheckMode::CHECK_NOT_EQUAL);
+    auto ids = result_bs->Get<int64_t*>(knowhere::meta::IDS);
+    for (int64_t i = 0; i < nq * k; ++i) {
+        ASSERT_TRUE(ids[i] < 0 || !concurrent_bitset_ptr->test(ids[i]));
+    }
+
+    for (int64_t i = 0; i < nq; ++i) {
+        concurrent_bitset_ptr->clear(i);
+    }
+    ASSERT_EQ(concurrent_bitset_ptr->count(), 0);
+    auto result_clear = index_->Search(query_dataset, conf_);
+    AssertAnns(result_clear, nq, k);
+}
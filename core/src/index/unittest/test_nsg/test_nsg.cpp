@@ -114,6 +114,14 @@ TEST_F(NSGInterfaceTest, basic_test) {
 
     ASSERT_EQ(index_->Count(), nb);
     ASSERT_EQ(index_->Dimension(), dim);
+
+    faiss::ConcurrentBitsetPtr concurrent_bitset_ptr = std::make_shared<faiss::ConcurrentBitset>(nb);
+    for (int64_t i = 0; i < nq; ++i) {
+        concurrent_bitset_ptr->set(i);
+    }
+    index_->SetBlacklist(concurrent_bitset_ptr);
+    auto result_bs = index_->Search(query_dataset, search_conf);
+    AssertAnns(result_bs, nq, k, CheckMode::CHECK_NOT_EQUAL);
     //    ASSERT_THROW({ index_->Clone(); }, knowhere::KnowhereException);
     ASSERT_NO_THROW({
         index_->Add(base_dataset, knowhere::Config());
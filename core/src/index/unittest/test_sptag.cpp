@@ -90,6 +90,14 @@ TEST_P(SPTAGTest, sptag_basic) {
         std::cout << "dist\n" << ss_dist.str() << std::endl;
     }
 
+    faiss::ConcurrentBitsetPtr concurrent_bitset_ptr = std::make_shared<faiss::ConcurrentBitset>(nb);
+    for (int64_t i = 0; i < nq; ++i) {
+        concurrent_bitset_ptr->set(i);
+    }
+    index_->SetBlacklist(concurrent_bitset_ptr);
+    auto result_bs = index_->Search(query_dataset, conf);
+    AssertAnns(result_bs, nq, k, CheckMode::CHECK_NOT_EQUAL);
+
     // Though these functions do nothing, use them to improve code coverage
     {
         index_->Seal();
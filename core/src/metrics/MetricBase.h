@@ -83,6 +83,18 @@ class MetricsBase {
     CacheAccessTotalIncrement(double value = 1) {
     }
 
+    virtual void
+    CacheHitTotalIncrement(const std::string& cache, const std::string& table_id) {
+    }
+
+    virtual void
+    CacheMissTotalIncrement(const std::string& cache, const std::string& table_id) {
+    }
+
+    virtual void
+    CacheEvictionTotalIncrement(const std::string& cache, const std::string& table_id) {
+    }
+
     virtual void
     MemTableMergeDurationSecondsHistogramObserve(double value) {
     }
@@ -143,6 +155,22 @@ class MetricsBase {
     QueryVectorResponsePerSecondGaugeSet(double value) {
     }
 
+    virtual void
+    SearchCombineSizeHistogramObserve(double value) {
+    }
+
+    virtual void
+    SearchCombineNqHistogramObserve(double value) {
+    }
+
+    virtual void
+    WalGroupCommitSizeHistogramObserve(double value) {
+    }
+
+    virtual void
+    WalCommitDurationMicrosecondsHistogramObserve(double value) {
+    }
+
     virtual void
     CPUUsagePercentSet() {
     }
@@ -146,6 +146,27 @@ class PrometheusMetrics : public MetricsBase {
         }
     }
 
+    void
+    CacheHitTotalIncrement(const std::string& cache, const std::string& table_id) override {
+        if (startup_) {
+            cache_table_access_.Add({{"cache", cache}, {"table", table_id}, {"outcome", "hit"}}).Increment();
+        }
+    }
+
+    void
+    CacheMissTotalIncrement(const std::string& cache, const std::string& table_id) override {
+        if (startup_) {
+            cache_table_access_.Add({{"cache", cache}, {"table", table_id}, {"outcome", "miss"}}).Increment();
+        }
+    }
+
+    void
+    CacheEvictionTotalIncrement(const std::string& cache, const std::string& table_id) override {
+        if (startup_) {
+            cache_table_access_.Add({{"cache", cache}, {"table", table_id}, {"outcome", "eviction"}}).Increment();
+        }
+    }
+
     void
     MemTableMergeDurationSecondsHistogramObserve(double value) override {
         if (startup_) {
@@ -246,6 +267,34 @@ class PrometheusMetrics : public MetricsBase {
         }
     }
 
+    void
+    SearchCombineSizeHistogramObserve(double value) override {
+        if (startup_) {
+            search_combine_size_histogram_.Observe(value);
+        }
+    }
+
+    void
+    SearchCombineNqHistogramObserve(double value) override {
+        if (startup_) {
+            search_combine_nq_histogram_.Observe(value);
+        }
+    }
+
+    void
+    WalGroupCommitSizeHistogramObserve(double value) override {
+        if (startup_) {
+            wal_group_commit_size_histogram_.Observe(value);
+        }
+    }
+
+    void
+    WalCommitDurationMicrosecondsHistogramObserve(double value) override {
+        if (startup_) {
+            wal_commit_duration_histogram_.Observe(value);
+        }
+    }
+
     void
     CPUUsagePercentSet() override;
     void
@@ -390,6 +439,34 @@ class PrometheusMetrics : public MetricsBase {
     prometheus::Histogram& search_duration_histogram_ =
         search_request_duration_seconds_.Add({}, BucketBoundaries{0.1, 1.0, 10.0});
 
+    // record how many search requests and vectors are combined into one search job
+    prometheus::Family<prometheus::Histogram>& search_combine_ =
+        prometheus::BuildHistogram()
+            .Name("search_combine_batch")
+            .Help("histogram of search requests and query vectors combined into one search")
+            .Register(*registry_);
+    prometheus::Histogram& search_combine_size_histogram_ =
+        search_combine_.Add({{"type", "request"}}, BucketBoundaries{1, 2, 4, 8, 16, 32, 64});
+    prometheus::Histogram& search_combine_nq_histogram_ =
+        search_combine_.Add({{"type", "nq"}}, BucketBoundaries{1, 10, 100, 500, 1000, 2000, 4000});
+
+    // record how many wal records are written by one group commit and how long a commit waits
+    prometheus::Family<prometheus::Histogram>& wal_group_commit_size_ =
+        prometheus::BuildHistogram()
+            .Name("wal_group_commit_records")
+            .Help("histogram of wal records written by one group commit")
+            .Register(*registry_);
+    prometheus::Histogram& wal_group_commit_size_histogram_ =
+        wal_group_commit_size_.Add({}, BucketBoundaries{1, 2, 4, 8, 16, 32, 64, 128});
+
+    prometheus::Family<prometheus::Histogram>& wal_commit_duration_ =
+        prometheus::BuildHistogram()
+            .Name("wal_commit_duration_microseconds")
+            .Help("histogram of time an insert or delete waits for its wal records to be committed")
+            .Register(*registry_);
+    prometheus::Histogram& wal_commit_duration_histogram_ =
+        wal_commit_duration_.Add({}, BucketBoundaries{10, 100, 500, 1000, 5000, 10000, 50000, 100000});
+
     // record raw_files size histogram
     prometheus::Family<prometheus::Histogram>& raw_files_size_ = prometheus::BuildHistogram()
                                                                      .Name("search_raw_files_bytes")
@@ -543,6 +620,13 @@ class PrometheusMetrics : public MetricsBase {
                                                                  .Register(*registry_);
     prometheus::Counter& cache_access_total_ = cache_access_.Add({});
 
+    // record cache hit, miss and eviction count of every table
+    prometheus::Family<prometheus::Counter>& cache_table_access_ =
+        prometheus::BuildCounter()
+            .Name("cache_table_access_total")
+            .Help("the count of cache hit, miss and eviction per table")
+            .Register(*registry_);
+
     // record CPU cache usage and %
     prometheus::Family<prometheus::Gauge>& cpu_cache_usage_ =
         prometheus::BuildGauge().Name("cache_usage_bytes").Help("current cache usage by bytes").Register(*registry_);
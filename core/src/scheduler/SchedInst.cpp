@@ -44,7 +44,15 @@ load_simple_config() {
     ResMgrInst::GetInstance()->Add(ResourceFactory::Create("disk", "DISK", 0, false));
 
     auto io = Connection("io", 500);
-    ResMgrInst::GetInstance()->Add(ResourceFactory::Create("cpu", "CPU", 0));
+    auto cpu_resource = ResourceFactory::Create("cpu", "CPU", 0);
+    {
+        server::Config& config = server::Config::GetInstance();
+        int64_t loader_thread_num = 1, executor_thread_num = 1;
+        config.GetEngineConfigCpuLoaderThreadNum(loader_thread_num);
+        config.GetEngineConfigCpuExecutorThreadNum(executor_thread_num);
+        cpu_resource->SetThreadNum(loader_thread_num, executor_thread_num);
+    }
+    ResMgrInst::GetInstance()->Add(std::move(cpu_resource));
     ResMgrInst::GetInstance()->Connect("disk", "cpu", io);
 
 // get resources
@@ -119,8 +119,11 @@ class TaskTable : public interface::dumpable {
     size_t
     TaskToExecute();
 
+    /*
+     * Pick at most limit tasks to load, nothing is picked if more than max_loaded tasks wait to execute;
+     */
     std::vector<uint64_t>
-    PickToLoad(uint64_t limit);
+    PickToLoad(uint64_t limit, uint64_t max_loaded = 2);
 
     std::vector<uint64_t>
     PickToExecute(uint64_t limit);
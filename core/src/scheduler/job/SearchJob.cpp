@@ -11,14 +11,32 @@
 
 #include "scheduler/job/SearchJob.h"
 
+#include <algorithm>
+#include <limits>
+#include <list>
+
 #include "utils/Log.h"
 
 namespace milvus {
 namespace scheduler {
 
+namespace {
+constexpr uint64_t MAX_RESULT_SHARD_NUM = 16;
+}  // namespace
+
 SearchJob::SearchJob(const std::shared_ptr<server::Context>& context, uint64_t topk, uint64_t nprobe,
                      const engine::VectorsData& vectors)
-    : Job(JobType::SEARCH), context_(context), topk_(topk), nprobe_(nprobe), vectors_(vectors) {
+    : Job(JobType::SEARCH),
+      context_(context),
+      topk_(topk),
+      nprobe_(nprobe),
+      vectors_(vectors),
+      result_ids_(vectors.vector_count_ * topk, -1),
+      result_distances_(vectors.vector_count_ * topk, std::numeric_limits<float>::max()),
+      result_shards_(std::min(vectors.vector_count_, MAX_RESULT_SHARD_NUM)) {
+    if (!result_shards_.empty()) {
+        shard_size_ = (vectors.vector_count_ + result_shards_.size() - 1) / result_shards_.size();
+    }
 }
 
 bool
@@ -38,6 +56,18 @@ void
 SearchJob::WaitResult() {
     std::unique_lock<std::mutex> lock(mutex_);
     cv_.wait(lock, [this] { return index_files_.empty(); });
+
+    // every task merges into all shards with the same k, compact results to nq * result_k
+    uint64_t result_k = result_shards_.empty() ? 0 : result_shards_.front().result_k_;
+    if (result_k > 0 && result_k < topk_) {
+        uint64_t nq = vectors_.vector_count_;
+        for (uint64_t i = 1; i < nq; ++i) {
+            std::copy_n(result_ids_.begin() + i * topk_, result_k, result_ids_.begin() + i * result_k);
+            std::copy_n(result_distances_.begin() + i * topk_, result_k, result_distances_.begin() + i * result_k);
+        }
+        result_ids_.resize(nq * result_k);
+        result_distances_.resize(nq * result_k);
+    }
     SERVER_LOG_DEBUG << "SearchJob " << id() << " all done";
 }
 
@@ -52,6 +82,86 @@ SearchJob::SearchDone(size_t index_id) {
     SERVER_LOG_DEBUG << "SearchJob " << id() << " finish index file: " << index_id;
 }
 
+void
+SearchJob::ReduceTopk(const ResultIds& src_ids, const ResultDistances& src_distances, uint64_t src_k,
+                      bool ascending) {
+    if (src_ids.empty() || src_k == 0) {
+        return;
+    }
+
+    std::list<uint64_t> pending;
+    for (uint64_t i = 0; i < result_shards_.size(); ++i) {
+        pending.push_back(i);
+    }
+
+    while (!pending.empty()) {
+        bool merged = false;
+        for (auto iter = pending.begin(); iter != pending.end();) {
+            std::unique_lock<std::mutex> lock(result_shards_[*iter].mutex_, std::try_to_lock);
+            if (lock.owns_lock()) {
+                ReduceShard(*iter, src_ids, src_distances, src_k, ascending);
+                iter = pending.erase(iter);
+                merged = true;
+            } else {
+                ++iter;
+            }
+        }
+
+        // all remaining shards are busy, wait for the first one
+        if (!merged && !pending.empty()) {
+            std::lock_guard<std::mutex> lock(result_shards_[pending.front()].mutex_);
+            ReduceShard(pending.front(), src_ids, src_distances, src_k, ascending);
+            pending.pop_front();
+        }
+    }
+}
+
+void
+SearchJob::ReduceShard(uint64_t shard_index, const ResultIds& src_ids, const ResultDistances& src_distances,
+                       uint64_t src_k, bool ascending) {
+    auto& shard = result_shards_[shard_index];
+    uint64_t tar_k = shard.result_k_;
+    uint64_t out_k = std::min(topk_, tar_k + src_k);
+    auto better = [ascending](float lhs, float rhs) { return ascending ? lhs < rhs : lhs > rhs; };
+
+    uint64_t begin = shard_index * shard_size_;
+    uint64_t end = std::min(begin + shard_size_, static_cast<uint64_t>(vectors_.vector_count_));
+    for (uint64_t q = begin; q < end; ++q) {
+        int64_t* tar_id = result_ids_.data() + q * topk_;
+        float* tar_dist = result_distances_.data() + q * topk_;
+        const int64_t* src_id = src_ids.data() + q * topk_;
+        const float* src_dist = src_distances.data() + q * topk_;
+
+        // step 1: count how many results are taken from target and source
+        uint64_t i = 0, j = 0;
+        while (i + j < out_k) {
+            if (j < src_k && (i >= tar_k || better(src_dist[j], tar_dist[i]))) {
+                ++j;
+            } else {
+                ++i;
+            }
+        }
+
+        // step 2: merge from the back, so target can be overwritten in place
+        uint64_t w = out_k;
+        while (j > 0) {
+            if (i > 0 && better(src_dist[j - 1], tar_dist[i - 1])) {
+                --w;
+                --i;
+                tar_id[w] = tar_id[i];
+                tar_dist[w] = tar_dist[i];
+            } else {
+                --w;
+                --j;
+                tar_id[w] = src_id[j];
+                tar_dist[w] = src_dist[j];
+            }
+        }
+    }
+
+    shard.result_k_ = out_k;
+}
+
 ResultIds&
 SearchJob::GetResultIds() {
     return result_ids_;
@@ -53,6 +53,14 @@ class SearchJob : public Job {
     void
     SearchDone(size_t index_id);
 
+    /*
+     * Merge topk result of one index file into job result, src is laid out as nq * topk and has src_k valid
+     * results per query. Queries are split into shards with their own lock, a task merges whichever shard is
+     * free first, so concurrent tasks don't queue up on a single lock. Merge is done in place without allocation.
+     */
+    void
+    ReduceTopk(const ResultIds& src_ids, const ResultDistances& src_distances, uint64_t src_k, bool ascending);
+
     ResultIds&
     GetResultIds();
 
@@ -99,6 +107,11 @@ class SearchJob : public Job {
         return mutex_;
     }
 
+ private:
+    void
+    ReduceShard(uint64_t shard_index, const ResultIds& src_ids, const ResultDistances& src_distances, uint64_t src_k,
+                bool ascending);
+
  private:
     const std::shared_ptr<server::Context> context_;
 
@@ -111,6 +124,13 @@ class SearchJob : public Job {
     // TODO: column-base better ?
     ResultIds result_ids_;
     ResultDistances result_distances_;
+
+    struct ResultShard {
+        std::mutex mutex_;
+        uint64_t result_k_ = 0;  // valid results per query merged so far
+    };
+    uint64_t shard_size_ = 0;  // queries per shard
+    std::vector<ResultShard> result_shards_;
     Status status_;
 
     std::mutex mutex_;
@@ -13,6 +13,7 @@
 #include "scheduler/SchedInst.h"
 #include "scheduler/Utils.h"
 
+#include <algorithm>
 #include <iostream>
 #include <limits>
 #include <utility>
@@ -56,9 +57,17 @@ Resource::Resource(std::string name, ResourceType type, uint64_t device_id, bool
 void
 Resource::Start() {
     running_ = true;
-    loader_thread_ = std::thread(&Resource::loader_function, this);
+    for (uint64_t i = 0; i < loader_thread_num_; ++i) {
+        loader_threads_.emplace_back(&Resource::loader_function, this);
+    }
     if (enable_executor_) {
-        executor_thread_ = std::thread(&Resource::executor_function, this);
+        if (subscriber_) {
+            auto event = std::make_shared<StartUpEvent>(shared_from_this());
+            subscriber_(std::static_pointer_cast<Event>(event));
+        }
+        for (uint64_t i = 0; i < executor_thread_num_; ++i) {
+            executor_threads_.emplace_back(&Resource::executor_function, this);
+        }
     }
 }
 
@@ -66,29 +75,41 @@ void
 Resource::Stop() {
     running_ = false;
     WakeupLoader();
-    loader_thread_.join();
+    for (auto& thread : loader_threads_) {
+        thread.join();
+    }
+    loader_threads_.clear();
     if (enable_executor_) {
         WakeupExecutor();
-        executor_thread_.join();
+        for (auto& thread : executor_threads_) {
+            thread.join();
+        }
+        executor_threads_.clear();
     }
 }
 
+void
+Resource::SetThreadNum(uint64_t loader_thread_num, uint64_t executor_thread_num) {
+    loader_thread_num_ = std::max(loader_thread_num, (uint64_t)1);
+    executor_thread_num_ = std::max(executor_thread_num, (uint64_t)1);
+}
+
 void
 Resource::WakeupLoader() {
     {
         std::lock_guard<std::mutex> lock(load_mutex_);
-        load_flag_ = true;
+        ++load_round_;
     }
-    load_cv_.notify_one();
+    load_cv_.notify_all();
 }
 
 void
 Resource::WakeupExecutor() {
     {
         std::lock_guard<std::mutex> lock(exec_mutex_);
-        exec_flag_ = true;
+        ++exec_round_;
     }
-    exec_cv_.notify_one();
+    exec_cv_.notify_all();
 }
 
 json
@@ -98,10 +119,12 @@ Resource::Dump() const {
         {"name", name_},
         {"type", ToString(type_)},
         {"task_average_cost", TaskAvgCost()},
-        {"task_total_cost", total_cost_},
-        {"total_tasks", total_task_},
+        {"task_total_cost", total_cost_.load()},
+        {"total_tasks", total_task_.load()},
         {"running", running_},
         {"enable_executor", enable_executor_},
+        {"loader_thread_num", loader_thread_num_},
+        {"executor_thread_num", executor_thread_num_},
     };
     return ret;
 }
@@ -113,7 +136,8 @@ Resource::NumOfTaskToExec() {
 
 TaskTableItemPtr
 Resource::pick_task_load() {
-    auto indexes = task_table_.PickToLoad(10);
+    // keep one more loaded task than executors, so no executor idles while the next task is loading
+    auto indexes = task_table_.PickToLoad(10, executor_thread_num_ + 1);
     for (auto index : indexes) {
         // try to set one task loading, then return
         if (task_table_.Load(index))
@@ -153,10 +177,11 @@ Resource::pick_task_execute() {
 
 void
 Resource::loader_function() {
+    uint64_t round = 0;
     while (running_) {
         std::unique_lock<std::mutex> lock(load_mutex_);
-        load_cv_.wait(lock, [&] { return load_flag_; });
-        load_flag_ = false;
+        load_cv_.wait(lock, [&] { return load_round_ != round; });
+        round = load_round_;
         lock.unlock();
         while (true) {
             auto task_item = pick_task_load();
@@ -183,14 +208,11 @@ Resource::loader_function() {
 
 void
 Resource::executor_function() {
-    if (subscriber_) {
-        auto event = std::make_shared<StartUpEvent>(shared_from_this());
-        subscriber_(std::static_pointer_cast<Event>(event));
-    }
+    uint64_t round = 0;
     while (running_) {
         std::unique_lock<std::mutex> lock(exec_mutex_);
-        exec_cv_.wait(lock, [&] { return exec_flag_; });
-        exec_flag_ = false;
+        exec_cv_.wait(lock, [&] { return exec_round_ != round; });
+        round = exec_round_;
         lock.unlock();
         while (true) {
             auto task_item = pick_task_execute();
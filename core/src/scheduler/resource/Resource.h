@@ -11,6 +11,7 @@
 
 #pragma once
 
+#include <atomic>
 #include <condition_variable>
 #include <functional>
 #include <memory>
@@ -54,6 +55,12 @@ class Resource : public Node, public std::enable_shared_from_this<Resource> {
     void
     Stop();
 
+    /*
+     * Set number of loader and executor threads, must be called before Start;
+     */
+    void
+    SetThreadNum(uint64_t loader_thread_num, uint64_t executor_thread_num);
+
     /*
      * wake up loader;
      */
@@ -108,10 +115,11 @@ class Resource : public Node, public std::enable_shared_from_this<Resource> {
     // TODO(wxyu): need double ?
     inline uint64_t
     TaskAvgCost() const {
-        if (total_task_ == 0) {
+        uint64_t total_task = total_task_;
+        if (total_task == 0) {
             return 0;
         }
-        return total_cost_ / total_task_;
+        return total_cost_ / total_task;
     }
 
     inline uint64_t
@@ -176,18 +184,21 @@ class Resource : public Node, public std::enable_shared_from_this<Resource> {
 
     TaskTable task_table_;
 
-    uint64_t total_cost_ = 0;
-    uint64_t total_task_ = 0;
+    std::atomic<uint64_t> total_cost_{0};
+    std::atomic<uint64_t> total_task_{0};
 
     std::function<void(EventPtr)> subscriber_ = nullptr;
 
     bool running_ = false;
     bool enable_executor_ = true;
-    std::thread loader_thread_;
-    std::thread executor_thread_;
-
-    bool load_flag_ = false;
-    bool exec_flag_ = false;
+    uint64_t loader_thread_num_ = 1;
+    uint64_t executor_thread_num_ = 1;
+    std::vector<std::thread> loader_threads_;
+    std::vector<std::thread> executor_threads_;
+
+    // bumped by every wakeup, each thread remembers the last round it has seen, so all threads drain the table
+    uint64_t load_round_ = 0;
+    uint64_t exec_round_ = 0;
     std::mutex load_mutex_;
     std::mutex exec_mutex_;
     std::condition_variable load_cv_;
@@ -17,6 +17,7 @@
 #include <thread>
 #include <utility>
 
+#include "db/Utils.h"
 #include "db/engine/EngineFactory.h"
 #include "metrics/Metrics.h"
 #include "scheduler/job/BuildIndexJob.h"
@@ -139,7 +140,13 @@ XBuildIndexTask::Execute() {
         // step 3: build index
         try {
             ENGINE_LOG_DEBUG << "Begin build index for file:" + table_file.location_;
-            index = to_index_engine_->BuildIndex(table_file.location_, (EngineType)table_file.engine_type_);
+            std::string centroids_path;
+            auto options = build_index_job->options();
+            if (options.shared_ivf_centroids_) {
+                centroids_path = engine::utils::GetTableCentroidsPath(options.meta_, file_->table_id_);
+            }
+            index = to_index_engine_->BuildIndex(table_file.location_, (EngineType)table_file.engine_type_,
+                                                 centroids_path);
             fiu_do_on("XBuildIndexTask.Execute.build_index_fail", index = nullptr);
             if (index == nullptr) {
                 throw Exception(DB_ERROR, "index NULL");
@@ -167,8 +167,11 @@ XSearchTask::Load(LoadType type, uint8_t device_id) {
 
         if (auto job = job_.lock()) {
             auto search_job = std::static_pointer_cast<scheduler::SearchJob>(job);
+            {
+                std::unique_lock<std::mutex> lock(search_job->mutex());
+                search_job->GetStatus() = s;
+            }
             search_job->SearchDone(file_->id_);
-            search_job->GetStatus() = s;
         }
 
         return;
@@ -248,7 +251,10 @@ XSearchTask::Execute() {
             fiu_do_on("XSearchTask.Execute.search_fail", s = Status(SERVER_UNEXPECTED_ERROR, ""));
 
             if (!s.ok()) {
-                search_job->GetStatus() = s;
+                {
+                    std::unique_lock<std::mutex> lock(search_job->mutex());
+                    search_job->GetStatus() = s;
+                }
                 search_job->SearchDone(index_id_);
                 return;
             }
@@ -258,16 +264,7 @@ XSearchTask::Execute() {
 
             // step 3: pick up topk result
             auto spec_k = file_->row_count_ < topk ? file_->row_count_ : topk;
-            if (search_job->GetResultIds().front() == -1 && search_job->GetResultIds().size() > spec_k) {
-                // initialized results set
-                search_job->GetResultIds().resize(spec_k);
-                search_job->GetResultDistances().resize(spec_k);
-            }
-            {
-                std::unique_lock<std::mutex> lock(search_job->mutex());
-                XSearchTask::MergeTopkToResultSet(output_ids, output_distance, spec_k, nq, topk, ascending_reduce,
-                                                  search_job->GetResultIds(), search_job->GetResultDistances());
-            }
+            search_job->ReduceTopk(output_ids, output_distance, spec_k, ascending_reduce);
 
             span = rc.RecordSection(hdr + ", reduce topk");
             //            search_job->AccumReduceCost(span);
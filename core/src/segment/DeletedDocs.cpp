@@ -43,5 +43,10 @@ DeletedDocs::GetSize() const {
     return deleted_doc_offsets_.size();
 }
 
+int64_t
+DeletedDocs::Size() {
+    return deleted_doc_offsets_.size() * sizeof(offset_t);
+}
+
 }  // namespace segment
 }  // namespace milvus
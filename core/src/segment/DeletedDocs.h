@@ -20,12 +20,14 @@
 #include <memory>
 #include <vector>
 
+#include "cache/DataObj.h"
+
 namespace milvus {
 namespace segment {
 
 using offset_t = int32_t;
 
-class DeletedDocs {
+class DeletedDocs : public cache::DataObj {
  public:
     explicit DeletedDocs(const std::vector<offset_t>& deleted_doc_offsets);
 
@@ -34,6 +36,7 @@ class DeletedDocs {
     void
     AddDeletedDoc(offset_t offset);
 
+    // offsets read from a segment are sorted and unique
     const std::vector<offset_t>&
     GetDeletedDocs() const;
 
@@ -44,6 +47,9 @@ class DeletedDocs {
     size_t
     GetSize() const;
 
+    int64_t
+    Size() override;
+
     //    void
     //    GetBitset(faiss::ConcurrentBitsetPtr& bitset);
 
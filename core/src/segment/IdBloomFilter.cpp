@@ -16,69 +16,142 @@
 // under the License.
 
 #include "segment/IdBloomFilter.h"
-#include "utils/Log.h"
-#include "utils/Status.h"
 
-#include <string>
+#include <immintrin.h>
+
+#include <algorithm>
+#include <utility>
 
 namespace milvus {
 namespace segment {
 
-IdBloomFilter::IdBloomFilter(scaling_bloom_t* bloom_filter) : bloom_filter_(bloom_filter) {
+namespace {
+
+// bits per id of the filter, a split block filter at 12 bits per id has a false positive rate of about 0.5%
+constexpr uint64_t BITS_PER_ID = 12;
+constexpr uint64_t BLOCK_BITS = 256;
+
+// odd constants from the split block bloom filter of parquet, the top 5 bits of hash * salt pick the bit of a word
+alignas(32) constexpr uint32_t SALT[IdBloomFilter::BLOCK_WORDS] = {0x47b6137bU, 0x44974d91U, 0x8824ad5bU,
+                                                                   0xa2b7289dU, 0x705495c7U, 0x2df1424bU,
+                                                                   0x9efc4947U, 0x5c6bfb31U};
+
+inline void
+MakeMask(uint32_t key, uint32_t* mask) {
+    for (uint32_t i = 0; i < IdBloomFilter::BLOCK_WORDS; ++i) {
+        mask[i] = 1U << ((key * SALT[i]) >> 27);
+    }
 }
 
-IdBloomFilter::~IdBloomFilter() {
-    const std::lock_guard<std::mutex> lock(mutex_);
-    if (bloom_filter_) {
-        free_scaling_bloom(bloom_filter_);
+bool
+BlockCheckScalar(const uint32_t* block, uint32_t key) {
+    uint32_t mask[IdBloomFilter::BLOCK_WORDS];
+    MakeMask(key, mask);
+    for (uint32_t i = 0; i < IdBloomFilter::BLOCK_WORDS; ++i) {
+        if ((block[i] & mask[i]) == 0) {
+            return false;
+        }
     }
+    return true;
+}
+
+__attribute__((target("avx2"))) bool
+BlockCheckAvx2(const uint32_t* block, uint32_t key) {
+    __m256i salt = _mm256_load_si256(reinterpret_cast<const __m256i*>(SALT));
+    __m256i bits = _mm256_srli_epi32(_mm256_mullo_epi32(_mm256_set1_epi32(key), salt), 27);
+    __m256i mask = _mm256_sllv_epi32(_mm256_set1_epi32(1), bits);
+    __m256i words = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(block));
+    // every masked bit is set in the block
+    return _mm256_testc_si256(words, mask);
 }
 
-scaling_bloom_t*
-IdBloomFilter::GetBloomFilter() {
-    const std::lock_guard<std::mutex> lock(mutex_);
-    return bloom_filter_;
+using BlockCheckFunc = bool (*)(const uint32_t*, uint32_t);
+
+BlockCheckFunc
+GetBlockCheck() {
+    static const BlockCheckFunc func = __builtin_cpu_supports("avx2") ? BlockCheckAvx2 : BlockCheckScalar;
+    return func;
+}
+
+}  // namespace
+
+IdBloomFilter::IdBloomFilter(uint64_t capacity) {
+    num_blocks_ = std::max<uint64_t>(1, (capacity * BITS_PER_ID + BLOCK_BITS - 1) / BLOCK_BITS);
+    blocks_.assign(num_blocks_ * BLOCK_WORDS, 0);
+}
+
+IdBloomFilter::IdBloomFilter(std::vector<uint32_t> blocks) : blocks_(std::move(blocks)) {
+    num_blocks_ = blocks_.size() / BLOCK_WORDS;
+    if (num_blocks_ == 0) {
+        num_blocks_ = 1;
+        blocks_.assign(BLOCK_WORDS, 0);
+    }
+}
+
+uint64_t
+IdBloomFilter::Hash(doc_id_t uid) const {
+    // finalizer of murmur3, ids are often sequential
+    auto h = static_cast<uint64_t>(uid);
+    h ^= h >> 33;
+    h *= 0xff51afd7ed558ccdULL;
+    h ^= h >> 33;
+    h *= 0xc4ceb9fe1a85ec53ULL;
+    h ^= h >> 33;
+    return h;
+}
+
+uint64_t
+IdBloomFilter::BlockOffset(uint64_t hash) const {
+    // high 32 bits pick the block without a division, low 32 bits pick the bits within the block
+    return (((hash >> 32) * num_blocks_) >> 32) * BLOCK_WORDS;
 }
 
 bool
-IdBloomFilter::Check(doc_id_t uid) {
-    std::string s = std::to_string(uid);
-    const std::lock_guard<std::mutex> lock(mutex_);
-    return scaling_bloom_check(bloom_filter_, s.c_str(), s.size());
+IdBloomFilter::Check(doc_id_t uid) const {
+    auto hash = Hash(uid);
+    return GetBlockCheck()(blocks_.data() + BlockOffset(hash), static_cast<uint32_t>(hash));
 }
 
-Status
-IdBloomFilter::Add(doc_id_t uid) {
-    std::string s = std::to_string(uid);
-    const std::lock_guard<std::mutex> lock(mutex_);
-    if (scaling_bloom_add(bloom_filter_, s.c_str(), s.size(), uid) == -1) {
-        // Counter overflow does not affect bloom filter's normal functionality
-        ENGINE_LOG_WARNING << "Warning adding id=" << s << " to bloom filter: 4 bit counter Overflow";
-        // return Status(DB_BLOOM_FILTER_ERROR, "Bloom filter error: 4 bit counter Overflow");
+void
+IdBloomFilter::Check(const doc_id_t* uids, size_t count, std::vector<uint8_t>& results) const {
+    constexpr size_t PREFETCH_DISTANCE = 8;
+    auto block_check = GetBlockCheck();
+
+    std::vector<uint64_t> hashes(count);
+    for (size_t i = 0; i < count; ++i) {
+        hashes[i] = Hash(uids[i]);
+    }
+
+    results.resize(count);
+    for (size_t i = 0; i < count; ++i) {
+        if (i + PREFETCH_DISTANCE < count) {
+            __builtin_prefetch(blocks_.data() + BlockOffset(hashes[i + PREFETCH_DISTANCE]));
+        }
+        auto block = blocks_.data() + BlockOffset(hashes[i]);
+        results[i] = block_check(block, static_cast<uint32_t>(hashes[i])) ? 1 : 0;
     }
-    return Status::OK();
 }
 
 Status
-IdBloomFilter::Remove(doc_id_t uid) {
-    std::string s = std::to_string(uid);
-    const std::lock_guard<std::mutex> lock(mutex_);
-    if (scaling_bloom_remove(bloom_filter_, s.c_str(), s.size(), uid) == -1) {
-        // Should never go in here, but just to be safe
-        ENGINE_LOG_WARNING << "Warning removing id=" << s << " in bloom filter: Decrementing zero in counter";
-        // return Status(DB_BLOOM_FILTER_ERROR, "Error removing in bloom filter: Decrementing zero in counter");
+IdBloomFilter::Add(doc_id_t uid) {
+    auto hash = Hash(uid);
+    auto block = blocks_.data() + BlockOffset(hash);
+    uint32_t mask[BLOCK_WORDS];
+    MakeMask(static_cast<uint32_t>(hash), mask);
+    for (uint32_t i = 0; i < BLOCK_WORDS; ++i) {
+        block[i] |= mask[i];
     }
     return Status::OK();
 }
 
-// const std::string&
-// IdBloomFilter::GetName() const {
-//    return name_;
-//}
+const std::vector<uint32_t>&
+IdBloomFilter::GetBlocks() const {
+    return blocks_;
+}
 
-size_t
+int64_t
 IdBloomFilter::Size() {
-    return bloom_filter_->num_bytes;
+    return blocks_.size() * sizeof(uint32_t);
 }
 
 }  // namespace segment
@@ -17,10 +17,11 @@
 
 #pragma once
 
+#include <cstdint>
 #include <memory>
-#include <mutex>
+#include <vector>
 
-#include "dablooms/dablooms.h"
+#include "cache/DataObj.h"
 #include "utils/Status.h"
 
 namespace milvus {
@@ -28,29 +29,36 @@ namespace segment {
 
 using doc_id_t = int64_t;
 
-class IdBloomFilter {
+// Split block bloom filter on 64 bit ids: an id hashes to one 256 bits block, and sets one bit in each of the
+// 8 words of the block, so a check touches a single cache line. Segments are immutable after flush, the filter
+// is filled while the segment is written and only read afterwards, so reads take no lock.
+// Deletes don't clear bits, a deleted id is a false positive: searches by id skip the deleted docs of the segment.
+class IdBloomFilter : public cache::DataObj {
  public:
-    explicit IdBloomFilter(scaling_bloom_t* bloom_filter);
+    static constexpr uint32_t BLOCK_WORDS = 8;
 
-    ~IdBloomFilter();
+    // sized for capacity ids at about 0.5% false positive rate
+    explicit IdBloomFilter(uint64_t capacity);
 
-    scaling_bloom_t*
-    GetBloomFilter();
+    // blocks as written by GetBlocks()
+    explicit IdBloomFilter(std::vector<uint32_t> blocks);
 
     bool
-    Check(doc_id_t uid);
+    Check(doc_id_t uid) const;
 
-    Status
-    Add(doc_id_t uid);
+    // results[i] is whether uids[i] may be present
+    void
+    Check(const doc_id_t* uids, size_t count, std::vector<uint8_t>& results) const;
 
+    // not safe against concurrent checks, only called while the segment is written
     Status
-    Remove(doc_id_t uid);
+    Add(doc_id_t uid);
 
-    size_t
-    Size();
+    const std::vector<uint32_t>&
+    GetBlocks() const;
 
-    //    const std::string&
-    //    GetName() const;
+    int64_t
+    Size() override;
 
     // No copy and move
     IdBloomFilter(const IdBloomFilter&) = delete;
@@ -62,9 +70,15 @@ class IdBloomFilter {
     operator=(IdBloomFilter&&) = delete;
 
  private:
-    scaling_bloom_t* bloom_filter_;
-    //    const std::string name_ = "bloom_filter";
-    std::mutex mutex_;
+    uint64_t
+    Hash(doc_id_t uid) const;
+
+    uint64_t
+    BlockOffset(uint64_t hash) const;
+
+ private:
+    std::vector<uint32_t> blocks_;
+    uint64_t num_blocks_;
 };
 
 using IdBloomFilterPtr = std::shared_ptr<IdBloomFilter>;
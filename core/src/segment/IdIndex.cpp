@@ -0,0 +1,106 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "segment/IdIndex.h"
+
+namespace milvus {
+namespace segment {
+
+namespace {
+
+constexpr offset_t EMPTY_SLOT = -1;
+
+}  // namespace
+
+IdIndex::IdIndex(const std::vector<doc_id_t>& uids) {
+    Build(uids, std::vector<bool>());
+}
+
+IdIndex::IdIndex(const std::vector<doc_id_t>& uids, const std::vector<offset_t>& deleted_doc_offsets) {
+    std::vector<bool> deleted(uids.size(), false);
+    for (auto offset : deleted_doc_offsets) {
+        if (offset >= 0 && static_cast<size_t>(offset) < deleted.size()) {
+            deleted[offset] = true;
+        }
+    }
+    Build(uids, deleted);
+}
+
+void
+IdIndex::Build(const std::vector<doc_id_t>& uids, const std::vector<bool>& deleted) {
+    // keep the load factor at or below 0.5 so that probe sequences stay short
+    size_t capacity = 16;
+    while (capacity < uids.size() * 2) {
+        capacity <<= 1;
+    }
+    mask_ = capacity - 1;
+    keys_.assign(capacity, 0);
+    offsets_.assign(capacity, EMPTY_SLOT);
+
+    for (size_t i = 0; i < uids.size(); ++i) {
+        if (!deleted.empty() && deleted[i]) {
+            continue;
+        }
+        size_t slot = Slot(uids[i]);
+        while (offsets_[slot] != EMPTY_SLOT && keys_[slot] != uids[i]) {
+            slot = (slot + 1) & mask_;
+        }
+        if (offsets_[slot] == EMPTY_SLOT) {
+            keys_[slot] = uids[i];
+            offsets_[slot] = static_cast<offset_t>(i);
+            ++size_;
+        }
+    }
+}
+
+size_t
+IdIndex::Slot(doc_id_t uid) const {
+    // murmur3 finalizer, uids are often sequential so spread them before masking
+    auto h = static_cast<uint64_t>(uid);
+    h ^= h >> 33;
+    h *= 0xff51afd7ed558ccdULL;
+    h ^= h >> 33;
+    h *= 0xc4ceb9fe1a85ec53ULL;
+    h ^= h >> 33;
+    return static_cast<size_t>(h) & mask_;
+}
+
+bool
+IdIndex::Get(doc_id_t uid, offset_t& offset) const {
+    size_t slot = Slot(uid);
+    while (offsets_[slot] != EMPTY_SLOT) {
+        if (keys_[slot] == uid) {
+            offset = offsets_[slot];
+            return true;
+        }
+        slot = (slot + 1) & mask_;
+    }
+    return false;
+}
+
+size_t
+IdIndex::Count() const {
+    return size_;
+}
+
+int64_t
+IdIndex::Size() {
+    return keys_.size() * sizeof(doc_id_t) + offsets_.size() * sizeof(offset_t);
+}
+
+}  // namespace segment
+}  // namespace milvus
@@ -18,13 +18,56 @@
 #pragma once
 
 #include <memory>
+#include <vector>
 
-#include "AttrIndex.h"
+#include "cache/DataObj.h"
+#include "segment/DeletedDocs.h"
 
 namespace milvus {
 namespace segment {
 
-class IdIndex : public AttrIndex {};
+using doc_id_t = int64_t;
+
+// Maps uid to its offset inside a segment with an open addressing hash table, so that looking up an id
+// costs O(1) instead of a linear scan over the uids. Offsets passed as deleted are not indexed. If an uid
+// appears more than once, the first live offset wins.
+class IdIndex : public cache::DataObj {
+ public:
+    explicit IdIndex(const std::vector<doc_id_t>& uids);
+
+    IdIndex(const std::vector<doc_id_t>& uids, const std::vector<offset_t>& deleted_doc_offsets);
+
+    bool
+    Get(doc_id_t uid, offset_t& offset) const;
+
+    size_t
+    Count() const;
+
+    int64_t
+    Size() override;
+
+    // No copy and move
+    IdIndex(const IdIndex&) = delete;
+    IdIndex(IdIndex&&) = delete;
+
+    IdIndex&
+    operator=(const IdIndex&) = delete;
+    IdIndex&
+    operator=(IdIndex&&) = delete;
+
+ private:
+    void
+    Build(const std::vector<doc_id_t>& uids, const std::vector<bool>& deleted);
+
+    size_t
+    Slot(doc_id_t uid) const;
+
+ private:
+    std::vector<doc_id_t> keys_;
+    std::vector<offset_t> offsets_;  // -1 marks an empty slot
+    size_t mask_ = 0;
+    size_t size_ = 0;
+};
 
 using IdIndexPtr = std::shared_ptr<IdIndex>;
 
@@ -0,0 +1,57 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "segment/MappedVectors.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+namespace milvus {
+namespace segment {
+
+MappedVectors::MappedVectors(int fd, void* data, size_t num_bytes) : fd_(fd), data_(data), num_bytes_(num_bytes) {
+}
+
+MappedVectors::~MappedVectors() {
+    if (data_ != nullptr) {
+        munmap(data_, num_bytes_);
+    }
+    if (fd_ != -1) {
+        ::close(fd_);
+    }
+}
+
+const uint8_t*
+MappedVectors::GetData() const {
+    return static_cast<const uint8_t*>(data_);
+}
+
+size_t
+MappedVectors::GetNumBytes() const {
+    return num_bytes_;
+}
+
+void
+MappedVectors::ReleasePageCache() {
+    if (fd_ != -1) {
+        posix_fadvise(fd_, 0, 0, POSIX_FADV_DONTNEED);
+    }
+}
+
+}  // namespace segment
+}  // namespace milvus
@@ -0,0 +1,64 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+namespace milvus {
+namespace segment {
+
+// read-only memory mapping of a raw vector file, the data is served from the page cache without a heap copy
+class MappedVectors {
+ public:
+    // takes ownership of fd and of the mapping at data
+    MappedVectors(int fd, void* data, size_t num_bytes);
+
+    ~MappedVectors();
+
+    const uint8_t*
+    GetData() const;
+
+    size_t
+    GetNumBytes() const;
+
+    // drop the file pages from the page cache, call it when the data has been copied somewhere else
+    void
+    ReleasePageCache();
+
+    // No copy and move
+    MappedVectors(const MappedVectors&) = delete;
+    MappedVectors(MappedVectors&&) = delete;
+
+    MappedVectors&
+    operator=(const MappedVectors&) = delete;
+    MappedVectors&
+    operator=(MappedVectors&&) = delete;
+
+ private:
+    int fd_;
+    void* data_;
+    size_t num_bytes_;
+};
+
+using MappedVectorsPtr = std::shared_ptr<MappedVectors>;
+
+}  // namespace segment
+}  // namespace milvus
@@ -18,9 +18,12 @@
 #include "segment/SegmentReader.h"
 
 #include <memory>
+#include <utility>
 
 #include "Vectors.h"
+#include "cache/SegmentCacheMgr.h"
 #include "codecs/default/DefaultCodec.h"
+#include "segment/Uids.h"
 #include "store/Directory.h"
 #include "utils/Exception.h"
 #include "utils/Log.h"
@@ -46,11 +49,10 @@ SegmentReader::Load() {
     try {
         directory_ptr_->Create();
         default_codec.GetVectorsFormat()->read(directory_ptr_, segment_ptr_->vectors_ptr_);
-        default_codec.GetDeletedDocsFormat()->read(directory_ptr_, segment_ptr_->deleted_docs_ptr_);
     } catch (Exception& e) {
         return Status(e.code(), e.what());
     }
-    return Status::OK();
+    return LoadDeletedDocs(segment_ptr_->deleted_docs_ptr_);
 }
 
 Status
@@ -67,9 +69,42 @@ SegmentReader::LoadVectors(off_t offset, size_t num_bytes, std::vector<uint8_t>&
     return Status::OK();
 }
 
+Status
+SegmentReader::LoadVectorsMapped(segment::MappedVectorsPtr& mapped_vectors) {
+    codec::DefaultCodec default_codec;
+    try {
+        directory_ptr_->Create();
+        default_codec.GetVectorsFormat()->read_vectors_mapped(directory_ptr_, mapped_vectors);
+    } catch (Exception& e) {
+        std::string err_msg = "Failed to map raw vectors. " + std::string(e.what());
+        ENGINE_LOG_ERROR << err_msg;
+        return Status(e.code(), err_msg);
+    }
+    return Status::OK();
+}
+
 Status
 SegmentReader::LoadUids(std::vector<doc_id_t>& uids) {
+    UidsPtr uids_ptr;
+    auto status = LoadUids(uids_ptr);
+    if (status.ok()) {
+        uids = uids_ptr->GetUids();
+    }
+    return status;
+}
+
+Status
+SegmentReader::LoadUids(UidsPtr& uids_ptr) {
+    auto cache_mgr = cache::SegmentCacheMgr::GetInstance();
+    std::string key = cache::SegmentCacheMgr::UidsKey(directory_ptr_->GetDirPath());
+    uids_ptr = std::static_pointer_cast<Uids>(cache_mgr->GetItem(key));
+    if (uids_ptr != nullptr) {
+        return Status::OK();
+    }
+
+    uint64_t epoch = cache_mgr->Epoch();
     codec::DefaultCodec default_codec;
+    std::vector<doc_id_t> uids;
     try {
         directory_ptr_->Create();
         default_codec.GetVectorsFormat()->read_uids(directory_ptr_, uids);
@@ -78,6 +113,8 @@ SegmentReader::LoadUids(std::vector<doc_id_t>& uids) {
         ENGINE_LOG_ERROR << err_msg;
         return Status(e.code(), err_msg);
     }
+    uids_ptr = std::make_shared<Uids>(std::move(uids));
+    cache_mgr->InsertComponent(key, uids_ptr, epoch);
     return Status::OK();
 }
 
@@ -89,6 +126,14 @@ SegmentReader::GetSegment(SegmentPtr& segment_ptr) {
 
 Status
 SegmentReader::LoadBloomFilter(segment::IdBloomFilterPtr& id_bloom_filter_ptr) {
+    auto cache_mgr = cache::SegmentCacheMgr::GetInstance();
+    std::string key = cache::SegmentCacheMgr::BloomFilterKey(directory_ptr_->GetDirPath());
+    id_bloom_filter_ptr = std::static_pointer_cast<IdBloomFilter>(cache_mgr->GetItem(key));
+    if (id_bloom_filter_ptr != nullptr) {
+        return Status::OK();
+    }
+
+    uint64_t epoch = cache_mgr->Epoch();
     codec::DefaultCodec default_codec;
     try {
         directory_ptr_->Create();
@@ -98,11 +143,20 @@ SegmentReader::LoadBloomFilter(segment::IdBloomFilterPtr& id_bloom_filter_ptr) {
         ENGINE_LOG_ERROR << err_msg;
         return Status(e.code(), err_msg);
     }
+    cache_mgr->InsertComponent(key, id_bloom_filter_ptr, epoch);
     return Status::OK();
 }
 
 Status
 SegmentReader::LoadDeletedDocs(segment::DeletedDocsPtr& deleted_docs_ptr) {
+    auto cache_mgr = cache::SegmentCacheMgr::GetInstance();
+    std::string key = cache::SegmentCacheMgr::DeletedDocsKey(directory_ptr_->GetDirPath());
+    deleted_docs_ptr = std::static_pointer_cast<DeletedDocs>(cache_mgr->GetItem(key));
+    if (deleted_docs_ptr != nullptr) {
+        return Status::OK();
+    }
+
+    uint64_t epoch = cache_mgr->Epoch();
     codec::DefaultCodec default_codec;
     try {
         directory_ptr_->Create();
@@ -112,6 +166,56 @@ SegmentReader::LoadDeletedDocs(segment::DeletedDocsPtr& deleted_docs_ptr) {
         ENGINE_LOG_ERROR << err_msg;
         return Status(e.code(), err_msg);
     }
+    cache_mgr->InsertComponent(key, deleted_docs_ptr, epoch);
+    return Status::OK();
+}
+
+Status
+SegmentReader::LoadIdIndex(segment::IdIndexPtr& id_index_ptr) {
+    auto cache_mgr = cache::SegmentCacheMgr::GetInstance();
+    std::string key = cache::SegmentCacheMgr::IdIndexKey(directory_ptr_->GetDirPath());
+    id_index_ptr = std::static_pointer_cast<IdIndex>(cache_mgr->GetItem(key));
+    if (id_index_ptr != nullptr) {
+        return Status::OK();
+    }
+
+    uint64_t epoch = cache_mgr->Epoch();
+    std::vector<doc_id_t> uids;
+    auto status = LoadUids(uids);
+    if (!status.ok()) {
+        return status;
+    }
+
+    segment::DeletedDocsPtr deleted_docs_ptr;
+    status = LoadDeletedDocs(deleted_docs_ptr);
+    if (!status.ok()) {
+        return status;
+    }
+
+    id_index_ptr = std::make_shared<IdIndex>(uids, deleted_docs_ptr->GetDeletedDocs());
+    cache_mgr->InsertComponent(key, id_index_ptr, epoch);
+    return Status::OK();
+}
+
+Status
+SegmentReader::LoadVectorsSummary(segment::VectorsSummaryPtr& vectors_summary_ptr) {
+    auto cache_mgr = cache::SegmentCacheMgr::GetInstance();
+    std::string key = cache::SegmentCacheMgr::VectorsSummaryKey(directory_ptr_->GetDirPath());
+    vectors_summary_ptr = std::static_pointer_cast<VectorsSummary>(cache_mgr->GetItem(key));
+    if (vectors_summary_ptr != nullptr) {
+        return Status::OK();
+    }
+
+    uint64_t epoch = cache_mgr->Epoch();
+    codec::DefaultCodec default_codec;
+    try {
+        default_codec.GetVectorsSummaryFormat()->read(directory_ptr_, vectors_summary_ptr);
+    } catch (Exception& e) {
+        std::string err_msg = "Failed to load vectors summary. " + std::string(e.what());
+        ENGINE_LOG_ERROR << err_msg;
+        return Status(e.code(), err_msg);
+    }
+    cache_mgr->InsertComponent(key, vectors_summary_ptr, epoch);
     return Status::OK();
 }
 
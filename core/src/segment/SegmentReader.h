@@ -21,7 +21,11 @@
 #include <string>
 #include <vector>
 
+#include "segment/IdIndex.h"
+#include "segment/MappedVectors.h"
 #include "segment/Types.h"
+#include "segment/Uids.h"
+#include "segment/VectorsSummary.h"
 #include "store/Directory.h"
 #include "utils/Status.h"
 
@@ -42,15 +46,31 @@ class SegmentReader {
     Status
     LoadVectors(off_t offset, size_t num_bytes, std::vector<uint8_t>& raw_vectors);
 
+    // map the raw vector file instead of reading it into memory
+    Status
+    LoadVectorsMapped(segment::MappedVectorsPtr& mapped_vectors);
+
     Status
     LoadUids(std::vector<doc_id_t>& uids);
 
+    // shares the cached uids instead of copying them
+    Status
+    LoadUids(UidsPtr& uids_ptr);
+
     Status
     LoadBloomFilter(segment::IdBloomFilterPtr& id_bloom_filter_ptr);
 
     Status
     LoadDeletedDocs(segment::DeletedDocsPtr& deleted_docs_ptr);
 
+    // build the uid to offset index of live docs from uids and deleted docs
+    Status
+    LoadIdIndex(segment::IdIndexPtr& id_index_ptr);
+
+    // an empty summary if the segment was written without one
+    Status
+    LoadVectorsSummary(segment::VectorsSummaryPtr& vectors_summary_ptr);
+
     Status
     GetSegment(SegmentPtr& segment_ptr);
 
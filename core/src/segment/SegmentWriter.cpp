@@ -18,10 +18,14 @@
 #include "segment/SegmentWriter.h"
 
 #include <algorithm>
+#include <chrono>
+#include <future>
 #include <memory>
 
 #include "SegmentReader.h"
 #include "Vectors.h"
+#include "VectorsSummary.h"
+#include "cache/SegmentCacheMgr.h"
 #include "codecs/default/DefaultCodec.h"
 #include "store/Directory.h"
 #include "utils/Exception.h"
@@ -45,38 +49,61 @@ SegmentWriter::AddVectors(const std::string& name, const std::vector<uint8_t>& d
     return Status::OK();
 }
 
+Status
+SegmentWriter::AddVectors(const std::string& name, const uint8_t* data, size_t size, const doc_id_t* uids,
+                          size_t count) {
+    segment_ptr_->vectors_ptr_->AddData(data, size);
+    segment_ptr_->vectors_ptr_->AddUids(uids, count);
+    segment_ptr_->vectors_ptr_->SetName(name);
+
+    return Status::OK();
+}
+
 Status
 SegmentWriter::Serialize() {
-    auto start = std::chrono::high_resolution_clock::now();
+    cache::SegmentCacheMgr::GetInstance()->EraseSegment(directory_ptr_->GetDirPath());
 
-    auto status = WriteBloomFilter();
-    if (!status.ok()) {
-        return status;
+    // create the directory up front, the components below are written to their own files concurrently
+    try {
+        directory_ptr_->Create();
+    } catch (Exception& e) {
+        std::string err_msg = "Failed to create segment directory. " + std::string(e.what());
+        ENGINE_LOG_ERROR << err_msg;
+        return Status(e.code(), err_msg);
     }
 
-    auto end = std::chrono::high_resolution_clock::now();
-    std::chrono::duration<double> diff = end - start;
-    ENGINE_LOG_DEBUG << "Writing bloom filter took " << diff.count() << " s in total";
+    auto bloom_filter_future = std::async(std::launch::async, [this]() {
+        auto start = std::chrono::high_resolution_clock::now();
+        auto status = WriteBloomFilter();
+        std::chrono::duration<double> diff = std::chrono::high_resolution_clock::now() - start;
+        ENGINE_LOG_DEBUG << "Writing bloom filter took " << diff.count() << " s in total";
+        return status;
+    });
 
-    start = std::chrono::high_resolution_clock::now();
+    auto start = std::chrono::high_resolution_clock::now();
 
-    status = WriteVectors();
-    if (!status.ok()) {
-        return status;
-    }
+    auto status = WriteVectors();
 
-    end = std::chrono::high_resolution_clock::now();
-    diff = end - start;
+    auto end = std::chrono::high_resolution_clock::now();
+    std::chrono::duration<double> diff = end - start;
     ENGINE_LOG_DEBUG << "Writing vectors and uids took " << diff.count() << " s in total";
 
-    start = std::chrono::high_resolution_clock::now();
+    if (status.ok()) {
+        start = std::chrono::high_resolution_clock::now();
 
-    // Write an empty deleted doc
-    status = WriteDeletedDocs();
+        // Write an empty deleted doc
+        status = WriteDeletedDocs();
 
-    end = std::chrono::high_resolution_clock::now();
-    diff = end - start;
-    ENGINE_LOG_DEBUG << "Writing deleted docs took " << diff.count() << " s";
+        end = std::chrono::high_resolution_clock::now();
+        diff = end - start;
+        ENGINE_LOG_DEBUG << "Writing deleted docs took " << diff.count() << " s";
+    }
+
+    // always wait for the bloom filter, it reads the uids of this segment
+    auto bloom_filter_status = bloom_filter_future.get();
+    if (!bloom_filter_status.ok()) {
+        return bloom_filter_status;
+    }
 
     return status;
 }
@@ -103,7 +130,9 @@ SegmentWriter::WriteBloomFilter() {
 
         auto start = std::chrono::high_resolution_clock::now();
 
-        default_codec.GetIdBloomFilterFormat()->create(directory_ptr_, segment_ptr_->id_bloom_filter_ptr_);
+        // sized by the number of ids in this segment
+        auto& uids = segment_ptr_->vectors_ptr_->GetUids();
+        default_codec.GetIdBloomFilterFormat()->create(uids.size(), segment_ptr_->id_bloom_filter_ptr_);
 
         auto end = std::chrono::high_resolution_clock::now();
         std::chrono::duration<double> diff = end - start;
@@ -111,7 +140,6 @@ SegmentWriter::WriteBloomFilter() {
 
         start = std::chrono::high_resolution_clock::now();
 
-        auto& uids = segment_ptr_->vectors_ptr_->GetUids();
         for (auto& uid : uids) {
             segment_ptr_->id_bloom_filter_ptr_->Add(uid);
         }
@@ -153,29 +181,68 @@ SegmentWriter::WriteDeletedDocs() {
 Status
 SegmentWriter::WriteDeletedDocs(const DeletedDocsPtr& deleted_docs) {
     codec::DefaultCodec default_codec;
+    Status status;
     try {
         directory_ptr_->Create();
         default_codec.GetDeletedDocsFormat()->write(directory_ptr_, deleted_docs);
     } catch (Exception& e) {
         std::string err_msg = "Failed to write deleted docs. " + std::string(e.what());
         ENGINE_LOG_ERROR << err_msg;
-        return Status(e.code(), err_msg);
+        status = Status(e.code(), err_msg);
+    }
+
+    // the write merges with the file on disk and renames a temp file over it, drop the cached copies either way
+    auto cache_mgr = cache::SegmentCacheMgr::GetInstance();
+    cache_mgr->EraseComponent(cache::SegmentCacheMgr::DeletedDocsKey(directory_ptr_->GetDirPath()));
+    cache_mgr->EraseComponent(cache::SegmentCacheMgr::IdIndexKey(directory_ptr_->GetDirPath()));
+    return status;
+}
+
+Status
+SegmentWriter::WriteVectorsSummary(int64_t dimension) {
+    auto& data = segment_ptr_->vectors_ptr_->GetData();
+    int64_t count = data.size() / (dimension * sizeof(float));
+    if (count == 0) {
+        return Status::OK();
     }
+
+    codec::DefaultCodec default_codec;
+    try {
+        auto start = std::chrono::high_resolution_clock::now();
+
+        auto summary = VectorsSummary::Build(reinterpret_cast<const float*>(data.data()), count, dimension);
+        directory_ptr_->Create();
+        default_codec.GetVectorsSummaryFormat()->write(directory_ptr_, summary);
+
+        std::chrono::duration<double> diff = std::chrono::high_resolution_clock::now() - start;
+        ENGINE_LOG_DEBUG << "Summarizing " << count << " vectors took " << diff.count() << " s";
+    } catch (std::exception& e) {
+        std::string err_msg = "Failed to write vectors summary. " + std::string(e.what());
+        ENGINE_LOG_ERROR << err_msg;
+        return Status(SERVER_UNEXPECTED_ERROR, err_msg);
+    }
+
+    auto cache_mgr = cache::SegmentCacheMgr::GetInstance();
+    cache_mgr->EraseComponent(cache::SegmentCacheMgr::VectorsSummaryKey(directory_ptr_->GetDirPath()));
     return Status::OK();
 }
 
 Status
 SegmentWriter::WriteBloomFilter(const IdBloomFilterPtr& id_bloom_filter_ptr) {
     codec::DefaultCodec default_codec;
+    Status status;
     try {
         directory_ptr_->Create();
         default_codec.GetIdBloomFilterFormat()->write(directory_ptr_, id_bloom_filter_ptr);
     } catch (Exception& e) {
         std::string err_msg = "Failed to write bloom filter. " + std::string(e.what());
         ENGINE_LOG_ERROR << err_msg;
-        return Status(e.code(), err_msg);
+        status = Status(e.code(), err_msg);
     }
-    return Status::OK();
+
+    std::string key = cache::SegmentCacheMgr::BloomFilterKey(directory_ptr_->GetDirPath());
+    cache::SegmentCacheMgr::GetInstance()->EraseComponent(key);
+    return status;
 }
 
 Status
@@ -35,12 +35,20 @@ class SegmentWriter {
     Status
     AddVectors(const std::string& name, const std::vector<uint8_t>& data, const std::vector<doc_id_t>& uids);
 
+    // append count vectors of size bytes in total straight from the caller's buffers
+    Status
+    AddVectors(const std::string& name, const uint8_t* data, size_t size, const doc_id_t* uids, size_t count);
+
     Status
     WriteBloomFilter(const IdBloomFilterPtr& bloom_filter_ptr);
 
     Status
     WriteDeletedDocs(const DeletedDocsPtr& deleted_docs);
 
+    // summarize the vectors added so far, taken as float vectors of the given dimension, see VectorsSummary
+    Status
+    WriteVectorsSummary(int64_t dimension);
+
     Status
     Serialize();
 
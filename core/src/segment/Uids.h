@@ -0,0 +1,57 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "cache/DataObj.h"
+
+namespace milvus {
+namespace segment {
+
+using doc_id_t = int64_t;
+
+// uids of a segment, kept in the segment cache
+class Uids : public cache::DataObj {
+ public:
+    explicit Uids(std::vector<doc_id_t> uids);
+
+    const std::vector<doc_id_t>&
+    GetUids() const;
+
+    int64_t
+    Size() override;
+
+    // No copy and move
+    Uids(const Uids&) = delete;
+    Uids(Uids&&) = delete;
+
+    Uids&
+    operator=(const Uids&) = delete;
+    Uids&
+    operator=(Uids&&) = delete;
+
+ private:
+    std::vector<doc_id_t> uids_;
+};
+
+using UidsPtr = std::shared_ptr<Uids>;
+
+}  // namespace segment
+}  // namespace milvus
@@ -28,29 +28,77 @@
 namespace milvus {
 namespace segment {
 
+namespace {
+
+template <typename T>
+void
+Append(std::shared_ptr<std::vector<T>>& buffer, const T* begin, const T* end) {
+    size_t size = buffer->size() + (end - begin);
+    if (buffer.use_count() > 1 && size > buffer->capacity()) {
+        // a view still reads the buffer, grow into a new one instead of reallocating it under the view
+        auto grown = std::make_shared<std::vector<T>>();
+        grown->reserve(std::max(size, buffer->capacity() * 2));
+        grown->assign(buffer->begin(), buffer->end());
+        buffer = grown;
+    }
+    // no exact reserve here, it would defeat the geometric growth of the buffer over many small appends
+    buffer->insert(buffer->end(), begin, end);
+}
+
+template <typename T>
+void
+Detach(std::shared_ptr<std::vector<T>>& buffer) {
+    if (buffer.use_count() > 1) {
+        buffer = std::make_shared<std::vector<T>>(*buffer);
+    }
+}
+
+}  // namespace
+
 Vectors::Vectors(std::vector<uint8_t> data, std::vector<doc_id_t> uids, const std::string& name)
-    : data_(std::move(data)), uids_(std::move(uids)), name_(name) {
+    : data_(std::make_shared<std::vector<uint8_t>>(std::move(data))),
+      uids_(std::make_shared<std::vector<doc_id_t>>(std::move(uids))),
+      name_(name) {
 }
 
 void
 Vectors::AddData(const std::vector<uint8_t>& data) {
-    data_.reserve(data_.size() + data.size());
-    data_.insert(data_.end(), std::make_move_iterator(data.begin()), std::make_move_iterator(data.end()));
+    Append(data_, data.data(), data.data() + data.size());
+}
+
+void
+Vectors::AddData(std::vector<uint8_t>&& data) {
+    if (data_->empty()) {
+        data_ = std::make_shared<std::vector<uint8_t>>(std::move(data));
+    } else {
+        Append(data_, data.data(), data.data() + data.size());
+    }
+}
+
+void
+Vectors::AddData(const uint8_t* data, size_t size) {
+    Append(data_, data, data + size);
 }
 
 void
 Vectors::AddUids(const std::vector<doc_id_t>& uids) {
-    uids_.reserve(uids_.size() + uids.size());
-    uids_.insert(uids_.end(), std::make_move_iterator(uids.begin()), std::make_move_iterator(uids.end()));
+    Append(uids_, uids.data(), uids.data() + uids.size());
+}
+
+void
+Vectors::AddUids(const doc_id_t* uids, size_t count) {
+    Append(uids_, uids, uids + count);
 }
 
 void
 Vectors::Erase(int32_t offset) {
     auto code_length = GetCodeLength();
     if (code_length != 0) {
+        Detach(data_);
+        Detach(uids_);
         auto step = offset * code_length;
-        data_.erase(data_.begin() + step, data_.begin() + step + code_length);
-        uids_.erase(uids_.begin() + offset, uids_.begin() + offset + 1);
+        data_->erase(data_->begin() + step, data_->begin() + step + code_length);
+        uids_->erase(uids_->begin() + offset, uids_->begin() + offset + 1);
     }
 }
 
@@ -80,17 +128,17 @@ Vectors::Erase(std::vector<int32_t>& offsets) {
     // Reconstruct raw vectors and uids
     ENGINE_LOG_DEBUG << "Begin erasing...";
 
-    size_t new_size = uids_.size() - offsets.size();
+    size_t new_size = uids_->size() - offsets.size();
     std::vector<doc_id_t> new_uids(new_size);
     auto code_length = GetCodeLength();
     std::vector<uint8_t> new_data(new_size * code_length);
 
     auto count = 0;
     auto skip = offsets.cbegin();
-    auto loop_size = uids_.size();
+    auto loop_size = uids_->size();
 
     for (size_t i = 0; i < loop_size;) {
-        while (i == *skip && skip != offsets.cend()) {
+        while (skip != offsets.cend() && i == *skip) {
             ++i;
             ++skip;
         }
@@ -99,20 +147,24 @@ Vectors::Erase(std::vector<int32_t>& offsets) {
             break;
         }
 
-        new_uids[count] = uids_[i];
+        new_uids[count] = (*uids_)[i];
 
         for (size_t j = 0; j < code_length; ++j) {
-            new_data[count * code_length + j] = data_[i * code_length + j];
+            new_data[count * code_length + j] = (*data_)[i * code_length + j];
         }
 
         ++count;
         ++i;
     }
 
-    data_.clear();
-    uids_.clear();
-    data_.swap(new_data);
-    uids_.swap(new_uids);
+    // the rebuilt buffers replace shared ones, unshared ones are swapped in place so references to them stay valid
+    if (data_.use_count() > 1 || uids_.use_count() > 1) {
+        data_ = std::make_shared<std::vector<uint8_t>>(std::move(new_data));
+        uids_ = std::make_shared<std::vector<doc_id_t>>(std::move(new_uids));
+    } else {
+        data_->swap(new_data);
+        uids_->swap(new_uids);
+    }
 
     end = std::chrono::high_resolution_clock::now();
     diff = end - start;
@@ -122,27 +174,38 @@ Vectors::Erase(std::vector<int32_t>& offsets) {
 
 const std::vector<uint8_t>&
 Vectors::GetData() const {
-    return data_;
+    return *data_;
 }
 
 const std::vector<doc_id_t>&
 Vectors::GetUids() const {
-    return uids_;
+    return *uids_;
 }
 
 size_t
 Vectors::GetCount() const {
-    return uids_.size();
+    return uids_->size();
 }
 
 size_t
 Vectors::GetCodeLength() const {
-    return uids_.empty() ? 0 : data_.size() / uids_.size();
+    return uids_->empty() ? 0 : data_->size() / uids_->size();
+}
+
+Vectors::View
+Vectors::GetView() const {
+    View view;
+    view.data_holder_ = data_;
+    view.uids_holder_ = uids_;
+    view.data_ = data_->data();
+    view.uids_ = uids_->data();
+    view.count_ = uids_->size();
+    return view;
 }
 
 size_t
 Vectors::Size() {
-    return data_.size() + uids_.size() * sizeof(doc_id_t);
+    return data_->size() + uids_->size() * sizeof(doc_id_t);
 }
 
 void
@@ -157,10 +220,19 @@ Vectors::GetName() const {
 
 void
 Vectors::Clear() {
-    data_.clear();
-    data_.shrink_to_fit();
-    uids_.clear();
-    uids_.shrink_to_fit();
+    // shared buffers are left to their views
+    if (data_.use_count() > 1) {
+        data_ = std::make_shared<std::vector<uint8_t>>();
+    } else {
+        data_->clear();
+        data_->shrink_to_fit();
+    }
+    if (uids_.use_count() > 1) {
+        uids_ = std::make_shared<std::vector<doc_id_t>>();
+    } else {
+        uids_->clear();
+        uids_->shrink_to_fit();
+    }
 }
 
 }  // namespace segment
@@ -28,6 +28,16 @@ using doc_id_t = int64_t;
 
 class Vectors {
  public:
+    // the first count_ rows of the buffers, unchanged while the view is held: a shared buffer is appended in place
+    // only within its capacity, any other write copies it first
+    struct View {
+        std::shared_ptr<const std::vector<uint8_t>> data_holder_;
+        std::shared_ptr<const std::vector<doc_id_t>> uids_holder_;
+        const uint8_t* data_ = nullptr;
+        const doc_id_t* uids_ = nullptr;
+        size_t count_ = 0;
+    };
+
     Vectors(std::vector<uint8_t> data, std::vector<doc_id_t> uids, const std::string& name);
 
     Vectors() = default;
@@ -35,9 +45,18 @@ class Vectors {
     void
     AddData(const std::vector<uint8_t>& data);
 
+    void
+    AddData(std::vector<uint8_t>&& data);
+
+    void
+    AddData(const uint8_t* data, size_t size);
+
     void
     AddUids(const std::vector<doc_id_t>& uids);
 
+    void
+    AddUids(const doc_id_t* uids, size_t count);
+
     void
     SetName(const std::string& name);
 
@@ -56,6 +75,9 @@ class Vectors {
     size_t
     GetCodeLength() const;
 
+    View
+    GetView() const;
+
     void
     Erase(int32_t offset);
 
@@ -78,8 +100,8 @@ class Vectors {
     operator=(Vectors&&) = delete;
 
  private:
-    std::vector<uint8_t> data_;
-    std::vector<doc_id_t> uids_;
+    std::shared_ptr<std::vector<uint8_t>> data_ = std::make_shared<std::vector<uint8_t>>();
+    std::shared_ptr<std::vector<doc_id_t>> uids_ = std::make_shared<std::vector<doc_id_t>>();
     std::string name_;
 };
 
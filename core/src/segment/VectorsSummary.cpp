@@ -0,0 +1,150 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "segment/VectorsSummary.h"
+
+#include <faiss/Clustering.h>
+#include <faiss/IndexFlat.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <utility>
+
+namespace milvus {
+namespace segment {
+
+namespace {
+
+// vectors assigned per faiss search, bounds the memory of the assignment
+constexpr int64_t ASSIGN_BATCH = 65536;
+
+// faiss computes L2 distances by expanding the norms, which loses a little precision on large vectors. The radiuses
+// are widened by this much so that the bound holds anyway
+constexpr float RADIUS_SLACK = 1.001f;
+
+}  // namespace
+
+VectorsSummary::VectorsSummary(int64_t dimension, std::vector<float> centroids, std::vector<float> radiuses)
+    : dimension_(dimension), centroids_(std::move(centroids)), radiuses_(std::move(radiuses)) {
+}
+
+std::shared_ptr<VectorsSummary>
+VectorsSummary::Build(const float* vectors, int64_t count, int64_t dimension) {
+    int64_t clusters = std::min(MAX_CLUSTERS, count);
+    if (clusters <= 0 || dimension <= 0) {
+        return std::make_shared<VectorsSummary>();
+    }
+
+    std::vector<float> centroids(clusters * dimension);
+    if (clusters == count) {
+        std::copy(vectors, vectors + count * dimension, centroids.begin());
+    } else {
+        faiss::kmeans_clustering(dimension, count, clusters, vectors, centroids.data());
+    }
+
+    faiss::IndexFlatL2 index(dimension);
+    index.add(clusters, centroids.data());
+
+    std::vector<float> radiuses(clusters, 0);
+    std::vector<float> distances(std::min(ASSIGN_BATCH, count));
+    std::vector<faiss::Index::idx_t> labels(distances.size());
+    for (int64_t begin = 0; begin < count; begin += ASSIGN_BATCH) {
+        int64_t n = std::min(ASSIGN_BATCH, count - begin);
+        index.search(n, vectors + begin * dimension, 1, distances.data(), labels.data());
+        for (int64_t i = 0; i < n; ++i) {
+            if (labels[i] >= 0) {
+                radiuses[labels[i]] = std::max(radiuses[labels[i]], distances[i]);
+            }
+        }
+    }
+
+    for (auto& radius : radiuses) {
+        radius = std::sqrt(radius) * RADIUS_SLACK;
+    }
+
+    return std::make_shared<VectorsSummary>(dimension, std::move(centroids), std::move(radiuses));
+}
+
+bool
+VectorsSummary::Empty() const {
+    return radiuses_.empty();
+}
+
+int64_t
+VectorsSummary::GetDimension() const {
+    return dimension_;
+}
+
+const std::vector<float>&
+VectorsSummary::GetCentroids() const {
+    return centroids_;
+}
+
+const std::vector<float>&
+VectorsSummary::GetRadiuses() const {
+    return radiuses_;
+}
+
+float
+VectorsSummary::BestDistance(const float* query, bool inner_product, float factor) const {
+    if (Empty()) {
+        // bounds nothing, any distance is possible
+        return inner_product ? std::numeric_limits<float>::max() : 0;
+    }
+
+    float query_norm = 0;
+    if (inner_product) {
+        for (int64_t d = 0; d < dimension_; ++d) {
+            query_norm += query[d] * query[d];
+        }
+        query_norm = std::sqrt(query_norm);
+    }
+
+    // by the triangle and Cauchy-Schwarz inequalities, a vector within radius r of centroid c has an L2 distance
+    // to q of at least |q - c| - r, and an inner product with q of at most q.c + |q| * r
+    float best = inner_product ? std::numeric_limits<float>::lowest() : std::numeric_limits<float>::max();
+    for (size_t i = 0; i < radiuses_.size(); ++i) {
+        const float* centroid = centroids_.data() + i * dimension_;
+        float radius = radiuses_[i] * factor;
+        if (inner_product) {
+            float product = 0;
+            for (int64_t d = 0; d < dimension_; ++d) {
+                product += query[d] * centroid[d];
+            }
+            best = std::max(best, product + query_norm * radius);
+        } else {
+            float square = 0;
+            for (int64_t d = 0; d < dimension_; ++d) {
+                float diff = query[d] - centroid[d];
+                square += diff * diff;
+            }
+            float gap = std::max(0.0f, std::sqrt(square) - radius);
+            best = std::min(best, gap * gap);
+        }
+    }
+
+    return best;
+}
+
+int64_t
+VectorsSummary::Size() {
+    return (centroids_.size() + radiuses_.size()) * sizeof(float);
+}
+
+}  // namespace segment
+}  // namespace milvus
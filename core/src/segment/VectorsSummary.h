@@ -0,0 +1,85 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "cache/DataObj.h"
+
+namespace milvus {
+namespace segment {
+
+// A coarse description of where the float vectors of a segment lie: up to MAX_CLUSTERS k-means centroids, each with
+// the radius of the ball holding the vectors assigned to it. It gives a bound on the best distance any vector of the
+// segment may have to a query, a segment whose bound can't beat the current top k needs not be searched.
+// An empty summary describes nothing, segments written without one are always searched.
+class VectorsSummary : public cache::DataObj {
+ public:
+    static constexpr int64_t MAX_CLUSTERS = 16;
+
+    VectorsSummary() = default;
+
+    // radiuses[i] belongs to the centroid at centroids[i * dimension]
+    VectorsSummary(int64_t dimension, std::vector<float> centroids, std::vector<float> radiuses);
+
+    // clusters count vectors, may throw on a faiss failure
+    static std::shared_ptr<VectorsSummary>
+    Build(const float* vectors, int64_t count, int64_t dimension);
+
+    bool
+    Empty() const;
+
+    int64_t
+    GetDimension() const;
+
+    const std::vector<float>&
+    GetCentroids() const;
+
+    const std::vector<float>&
+    GetRadiuses() const;
+
+    // The best distance a vector of the segment may have to the query: a lower bound of the squared L2 distance,
+    // or an upper bound of the inner product. The radiuses are scaled by factor, 1 gives an exact bound and lower
+    // factors a tighter but optimistic one.
+    float
+    BestDistance(const float* query, bool inner_product, float factor) const;
+
+    int64_t
+    Size() override;
+
+    // No copy and move
+    VectorsSummary(const VectorsSummary&) = delete;
+    VectorsSummary(VectorsSummary&&) = delete;
+
+    VectorsSummary&
+    operator=(const VectorsSummary&) = delete;
+    VectorsSummary&
+    operator=(VectorsSummary&&) = delete;
+
+ private:
+    int64_t dimension_ = 0;
+    std::vector<float> centroids_;
+    std::vector<float> radiuses_;
+};
+
+using VectorsSummaryPtr = std::shared_ptr<VectorsSummary>;
+
+}  // namespace segment
+}  // namespace milvus
@@ -31,6 +31,7 @@
 
 #include <cache/CpuCacheMgr.h>
 #include <cache/GpuCacheMgr.h>
+#include <cache/SegmentCacheMgr.h>
 #include <fiu-local.h>
 
 namespace milvus {
@@ -126,6 +127,15 @@ Config::ValidateConfig() {
     std::string server_web_port;
     CONFIG_CHECK(GetServerConfigWebPort(server_web_port));
 
+    int64_t server_dql_thread_num;
+    CONFIG_CHECK(GetServerConfigDqlThreadNum(server_dql_thread_num));
+
+    int64_t server_request_queue_depth;
+    CONFIG_CHECK(GetServerConfigRequestQueueDepth(server_request_queue_depth));
+
+    int64_t server_dql_queue_depth;
+    CONFIG_CHECK(GetServerConfigDqlQueueDepth(server_dql_queue_depth));
+
     /* db config */
     std::string db_backend_url;
     CONFIG_CHECK(GetDBConfigBackendUrl(db_backend_url));
@@ -136,6 +146,12 @@ Config::ValidateConfig() {
     int64_t db_archive_days_threshold;
     CONFIG_CHECK(GetDBConfigArchiveDaysThreshold(db_archive_days_threshold));
 
+    int64_t search_combine_max_wait;
+    CONFIG_CHECK(GetDBConfigSearchCombineMaxWait(search_combine_max_wait));
+
+    int64_t search_combine_max_nq;
+    CONFIG_CHECK(GetDBConfigSearchCombineMaxNq(search_combine_max_nq));
+
     int64_t auto_flush_interval;
     CONFIG_CHECK(GetDBConfigAutoFlushInterval(auto_flush_interval));
 
@@ -182,6 +198,12 @@ Config::ValidateConfig() {
     float cache_cpu_cache_threshold;
     CONFIG_CHECK(GetCacheConfigCpuCacheThreshold(cache_cpu_cache_threshold));
 
+    int64_t cache_segment_cache_capacity;
+    CONFIG_CHECK(GetCacheConfigSegmentCacheCapacity(cache_segment_cache_capacity));
+
+    int64_t cache_cpu_cache_snapshot_interval;
+    CONFIG_CHECK(GetCacheConfigCpuCacheSnapshotInterval(cache_cpu_cache_snapshot_interval));
+
     int64_t cache_insert_buffer_size;
     CONFIG_CHECK(GetCacheConfigInsertBufferSize(cache_insert_buffer_size));
 
@@ -195,9 +217,21 @@ Config::ValidateConfig() {
     int64_t engine_omp_thread_num;
     CONFIG_CHECK(GetEngineConfigOmpThreadNum(engine_omp_thread_num));
 
+    int64_t engine_cpu_executor_thread_num;
+    CONFIG_CHECK(GetEngineConfigCpuExecutorThreadNum(engine_cpu_executor_thread_num));
+
+    int64_t engine_cpu_loader_thread_num;
+    CONFIG_CHECK(GetEngineConfigCpuLoaderThreadNum(engine_cpu_loader_thread_num));
+
     bool engine_use_avx512;
     CONFIG_CHECK(GetEngineConfigUseAVX512(engine_use_avx512));
 
+    bool engine_shared_ivf_centroids;
+    CONFIG_CHECK(GetEngineConfigSharedIvfCentroids(engine_shared_ivf_centroids));
+
+    float engine_segment_pruning_factor;
+    CONFIG_CHECK(GetEngineConfigSegmentPruningFactor(engine_segment_pruning_factor));
+
 #ifdef MILVUS_GPU_VERSION
     int64_t engine_gpu_search_threshold;
     CONFIG_CHECK(GetEngineConfigGpuSearchThreshold(engine_gpu_search_threshold));
@@ -241,6 +275,12 @@ Config::ValidateConfig() {
     std::string wal_path;
     CONFIG_CHECK(GetWalConfigWalPath(wal_path));
 
+    std::string wal_sync_mode;
+    CONFIG_CHECK(GetWalConfigSyncMode(wal_sync_mode));
+
+    int64_t wal_sync_interval;
+    CONFIG_CHECK(GetWalConfigSyncInterval(wal_sync_interval));
+
     return Status::OK();
 }
 
@@ -252,11 +292,16 @@ Config::ResetDefaultConfig() {
     CONFIG_CHECK(SetServerConfigDeployMode(CONFIG_SERVER_DEPLOY_MODE_DEFAULT));
     CONFIG_CHECK(SetServerConfigTimeZone(CONFIG_SERVER_TIME_ZONE_DEFAULT));
     CONFIG_CHECK(SetServerConfigWebPort(CONFIG_SERVER_WEB_PORT_DEFAULT));
+    CONFIG_CHECK(SetServerConfigDqlThreadNum(CONFIG_SERVER_DQL_THREAD_NUM_DEFAULT));
+    CONFIG_CHECK(SetServerConfigRequestQueueDepth(CONFIG_SERVER_REQUEST_QUEUE_DEPTH_DEFAULT));
+    CONFIG_CHECK(SetServerConfigDqlQueueDepth(CONFIG_SERVER_DQL_QUEUE_DEPTH_DEFAULT));
 
     /* db config */
     CONFIG_CHECK(SetDBConfigBackendUrl(CONFIG_DB_BACKEND_URL_DEFAULT));
     CONFIG_CHECK(SetDBConfigArchiveDiskThreshold(CONFIG_DB_ARCHIVE_DISK_THRESHOLD_DEFAULT));
     CONFIG_CHECK(SetDBConfigArchiveDaysThreshold(CONFIG_DB_ARCHIVE_DAYS_THRESHOLD_DEFAULT));
+    CONFIG_CHECK(SetDBConfigSearchCombineMaxWait(CONFIG_DB_SEARCH_COMBINE_MAX_WAIT_DEFAULT));
+    CONFIG_CHECK(SetDBConfigSearchCombineMaxNq(CONFIG_DB_SEARCH_COMBINE_MAX_NQ_DEFAULT));
 
     /* storage config */
     CONFIG_CHECK(SetStorageConfigPrimaryPath(CONFIG_STORAGE_PRIMARY_PATH_DEFAULT));
@@ -276,13 +321,19 @@ Config::ResetDefaultConfig() {
     /* cache config */
     CONFIG_CHECK(SetCacheConfigCpuCacheCapacity(CONFIG_CACHE_CPU_CACHE_CAPACITY_DEFAULT));
     CONFIG_CHECK(SetCacheConfigCpuCacheThreshold(CONFIG_CACHE_CPU_CACHE_THRESHOLD_DEFAULT));
+    CONFIG_CHECK(SetCacheConfigSegmentCacheCapacity(CONFIG_CACHE_SEGMENT_CACHE_CAPACITY_DEFAULT));
+    CONFIG_CHECK(SetCacheConfigCpuCacheSnapshotInterval(CONFIG_CACHE_CPU_CACHE_SNAPSHOT_INTERVAL_DEFAULT));
     CONFIG_CHECK(SetCacheConfigInsertBufferSize(CONFIG_CACHE_INSERT_BUFFER_SIZE_DEFAULT));
     CONFIG_CHECK(SetCacheConfigCacheInsertData(CONFIG_CACHE_CACHE_INSERT_DATA_DEFAULT));
 
     /* engine config */
     CONFIG_CHECK(SetEngineConfigUseBlasThreshold(CONFIG_ENGINE_USE_BLAS_THRESHOLD_DEFAULT));
     CONFIG_CHECK(SetEngineConfigOmpThreadNum(CONFIG_ENGINE_OMP_THREAD_NUM_DEFAULT));
+    CONFIG_CHECK(SetEngineConfigCpuExecutorThreadNum(CONFIG_ENGINE_CPU_EXECUTOR_THREAD_NUM_DEFAULT));
+    CONFIG_CHECK(SetEngineConfigCpuLoaderThreadNum(CONFIG_ENGINE_CPU_LOADER_THREAD_NUM_DEFAULT));
     CONFIG_CHECK(SetEngineConfigUseAVX512(CONFIG_ENGINE_USE_AVX512_DEFAULT));
+    CONFIG_CHECK(SetEngineConfigSharedIvfCentroids(CONFIG_ENGINE_SHARED_IVF_CENTROIDS_DEFAULT));
+    CONFIG_CHECK(SetEngineConfigSegmentPruningFactor(CONFIG_ENGINE_SEGMENT_PRUNING_FACTOR_DEFAULT));
 #ifdef MILVUS_GPU_VERSION
     CONFIG_CHECK(SetEngineConfigGpuSearchThreshold(CONFIG_ENGINE_GPU_SEARCH_THRESHOLD_DEFAULT));
 #endif
@@ -332,10 +383,20 @@ Config::SetConfigCli(const std::string& parent_key, const std::string& child_key
             status = SetServerConfigTimeZone(value);
         } else if (child_key == CONFIG_SERVER_WEB_PORT) {
             status = SetServerConfigWebPort(value);
+        } else if (child_key == CONFIG_SERVER_DQL_THREAD_NUM) {
+            status = SetServerConfigDqlThreadNum(value);
+        } else if (child_key == CONFIG_SERVER_REQUEST_QUEUE_DEPTH) {
+            status = SetServerConfigRequestQueueDepth(value);
+        } else if (child_key == CONFIG_SERVER_DQL_QUEUE_DEPTH) {
+            status = SetServerConfigDqlQueueDepth(value);
         }
     } else if (parent_key == CONFIG_DB) {
         if (child_key == CONFIG_DB_BACKEND_URL) {
             status = SetDBConfigBackendUrl(value);
+        } else if (child_key == CONFIG_DB_SEARCH_COMBINE_MAX_WAIT) {
+            status = SetDBConfigSearchCombineMaxWait(value);
+        } else if (child_key == CONFIG_DB_SEARCH_COMBINE_MAX_NQ) {
+            status = SetDBConfigSearchCombineMaxNq(value);
         }
     } else if (parent_key == CONFIG_STORAGE) {
         if (child_key == CONFIG_STORAGE_PRIMARY_PATH) {
@@ -368,6 +429,10 @@ Config::SetConfigCli(const std::string& parent_key, const std::string& child_key
             status = SetCacheConfigCpuCacheCapacity(value);
         } else if (child_key == CONFIG_CACHE_CPU_CACHE_THRESHOLD) {
             status = SetCacheConfigCpuCacheThreshold(value);
+        } else if (child_key == CONFIG_CACHE_SEGMENT_CACHE_CAPACITY) {
+            status = SetCacheConfigSegmentCacheCapacity(value);
+        } else if (child_key == CONFIG_CACHE_CPU_CACHE_SNAPSHOT_INTERVAL) {
+            status = SetCacheConfigCpuCacheSnapshotInterval(value);
         } else if (child_key == CONFIG_CACHE_CACHE_INSERT_DATA) {
             status = SetCacheConfigCacheInsertData(value);
         } else if (child_key == CONFIG_CACHE_INSERT_BUFFER_SIZE) {
@@ -378,8 +443,16 @@ Config::SetConfigCli(const std::string& parent_key, const std::string& child_key
             status = SetEngineConfigUseBlasThreshold(value);
         } else if (child_key == CONFIG_ENGINE_OMP_THREAD_NUM) {
             status = SetEngineConfigOmpThreadNum(value);
+        } else if (child_key == CONFIG_ENGINE_CPU_EXECUTOR_THREAD_NUM) {
+            status = SetEngineConfigCpuExecutorThreadNum(value);
+        } else if (child_key == CONFIG_ENGINE_CPU_LOADER_THREAD_NUM) {
+            status = SetEngineConfigCpuLoaderThreadNum(value);
         } else if (child_key == CONFIG_ENGINE_USE_AVX512) {
             status = SetEngineConfigUseAVX512(value);
+        } else if (child_key == CONFIG_ENGINE_SHARED_IVF_CENTROIDS) {
+            status = SetEngineConfigSharedIvfCentroids(value);
+        } else if (child_key == CONFIG_ENGINE_SEGMENT_PRUNING_FACTOR) {
+            status = SetEngineConfigSegmentPruningFactor(value);
 #ifdef MILVUS_GPU_VERSION
         } else if (child_key == CONFIG_ENGINE_GPU_SEARCH_THRESHOLD) {
             status = SetEngineConfigGpuSearchThreshold(value);
@@ -409,6 +482,11 @@ Config::SetConfigCli(const std::string& parent_key, const std::string& child_key
             !(parent_key == CONFIG_CACHE || parent_key == CONFIG_ENGINE || parent_key == CONFIG_GPU_RESOURCE)) {
             restart_required_ = true;
         }
+        // scheduler threads are created at startup
+        if (status.ok() && parent_key == CONFIG_ENGINE &&
+            (child_key == CONFIG_ENGINE_CPU_EXECUTOR_THREAD_NUM || child_key == CONFIG_ENGINE_CPU_LOADER_THREAD_NUM)) {
+            restart_required_ = true;
+        }
     }
 
     return status;
@@ -703,6 +781,59 @@ Config::CheckServerConfigWebPort(const std::string& value) {
     return Status::OK();
 }
 
+Status
+Config::CheckServerConfigDqlThreadNum(const std::string& value) {
+    if (!ValidationUtil::ValidateStringIsNumber(value).ok()) {
+        std::string msg = "Invalid dql thread num: " + value +
+                          ". Possible reason: server_config.dql_thread_num is not a positive integer.";
+        return Status(SERVER_INVALID_ARGUMENT, msg);
+    }
+
+    int64_t dql_thread = std::stoll(value);
+    int64_t sys_thread_cnt = 8;
+    CommonUtil::GetSystemAvailableThreads(sys_thread_cnt);
+    if (dql_thread > sys_thread_cnt) {
+        std::string msg = "Invalid dql thread num: " + value +
+                          ". Possible reason: server_config.dql_thread_num exceeds system cpu cores.";
+        return Status(SERVER_INVALID_ARGUMENT, msg);
+    }
+    return Status::OK();
+}
+
+Status
+Config::CheckServerConfigRequestQueueDepth(const std::string& value) {
+    if (!ValidationUtil::ValidateStringIsNumber(value).ok()) {
+        std::string msg = "Invalid request queue depth: " + value +
+                          ". Possible reason: server_config.request_queue_depth is not a positive integer.";
+        return Status(SERVER_INVALID_ARGUMENT, msg);
+    } else {
+        int64_t depth = std::stoll(value);
+        if (depth <= 0) {
+            std::string msg = "Invalid request queue depth: " + value +
+                              ". Possible reason: server_config.request_queue_depth is not a positive integer.";
+            return Status(SERVER_INVALID_ARGUMENT, msg);
+        }
+    }
+    return Status::OK();
+}
+
+Status
+Config::CheckServerConfigDqlQueueDepth(const std::string& value) {
+    if (!ValidationUtil::ValidateStringIsNumber(value).ok()) {
+        std::string msg = "Invalid dql queue depth: " + value +
+                          ". Possible reason: server_config.dql_queue_depth is not a positive integer.";
+        return Status(SERVER_INVALID_ARGUMENT, msg);
+    } else {
+        int64_t depth = std::stoll(value);
+        if (depth <= 0) {
+            std::string msg = "Invalid dql queue depth: " + value +
+                              ". Possible reason: server_config.dql_queue_depth is not a positive integer.";
+            return Status(SERVER_INVALID_ARGUMENT, msg);
+        }
+    }
+    return Status::OK();
+}
+
 /* DB config */
 Status
 Config::CheckDBConfigBackendUrl(const std::string& value) {
@@ -744,6 +875,33 @@ Config::CheckDBConfigArchiveDaysThreshold(const std::string& value) {
     return Status::OK();
 }
 
+Status
+Config::CheckDBConfigSearchCombineMaxWait(const std::string& value) {
+    if (!ValidationUtil::ValidateStringIsNumber(value).ok()) {
+        std::string msg = "Invalid search combine max wait: " + value +
+                          ". Possible reason: db_config.search_combine_max_wait is not a positive integer.";
+        return Status(SERVER_INVALID_ARGUMENT, msg);
+    }
+    return Status::OK();
+}
+
+Status
+Config::CheckDBConfigSearchCombineMaxNq(const std::string& value) {
+    if (!ValidationUtil::ValidateStringIsNumber(value).ok()) {
+        std::string msg = "Invalid search combine max nq: " + value +
+                          ". Possible reason: db_config.search_combine_max_nq is not a positive integer.";
+        return Status(SERVER_INVALID_ARGUMENT, msg);
+    } else {
+        int64_t search_combine_max_nq = std::stoll(value);
+        if (search_combine_max_nq <= 0) {
+            std::string msg = "Invalid search combine max nq: " + value +
+                              ". Possible reason: db_config.search_combine_max_nq is not a positive integer.";
+            return Status(SERVER_INVALID_ARGUMENT, msg);
+        }
+    }
+    return Status::OK();
+}
+
 Status
 Config::CheckDBConfigAutoFlushInterval(const std::string& value) {
     if (!ValidationUtil::ValidateStringIsNumber(value).ok()) {
@@ -955,6 +1113,26 @@ Config::CheckCacheConfigCpuCacheThreshold(const std::string& value) {
     return Status::OK();
 }
 
+Status
+Config::CheckCacheConfigSegmentCacheCapacity(const std::string& value) {
+    if (!ValidationUtil::ValidateStringIsNumber(value).ok()) {
+        std::string msg = "Invalid segment cache capacity: " + value +
+                          ". Possible reason: cache_config.segment_cache_capacity is not a non-negative integer.";
+        return Status(SERVER_INVALID_ARGUMENT, msg);
+    }
+    return Status::OK();
+}
+
+Status
+Config::CheckCacheConfigCpuCacheSnapshotInterval(const std::string& value) {
+    if (!ValidationUtil::ValidateStringIsNumber(value).ok()) {
+        std::string msg = "Invalid cpu cache snapshot interval: " + value +
+                          ". Possible reason: cache_config.cpu_cache_snapshot_interval is not a non-negative integer.";
+        return Status(SERVER_INVALID_ARGUMENT, msg);
+    }
+    return Status::OK();
+}
+
 Status
 Config::CheckCacheConfigInsertBufferSize(const std::string& value) {
     fiu_return_on("check_config_insert_buffer_size_fail", Status(SERVER_INVALID_ARGUMENT, ""));
@@ -1027,6 +1205,40 @@ Config::CheckEngineConfigOmpThreadNum(const std::string& value) {
     return Status::OK();
 }
 
+Status
+Config::CheckEngineConfigCpuExecutorThreadNum(const std::string& value) {
+    if (!ValidationUtil::ValidateStringIsNumber(value).ok()) {
+        std::string msg = "Invalid cpu executor thread num: " + value +
+                          ". Possible reason: engine_config.cpu_executor_thread_num is not a positive integer.";
+        return Status(SERVER_INVALID_ARGUMENT, msg);
+    } else {
+        int64_t cpu_executor_thread_num = std::stoll(value);
+        if (cpu_executor_thread_num <= 0) {
+            std::string msg = "Invalid cpu executor thread num: " + value +
+                              ". Possible reason: engine_config.cpu_executor_thread_num is not a positive integer.";
+            return Status(SERVER_INVALID_ARGUMENT, msg);
+        }
+    }
+    return Status::OK();
+}
+
+Status
+Config::CheckEngineConfigCpuLoaderThreadNum(const std::string& value) {
+    if (!ValidationUtil::ValidateStringIsNumber(value).ok()) {
+        std::string msg = "Invalid cpu loader thread num: " + value +
+                          ". Possible reason: engine_config.cpu_loader_thread_num is not a positive integer.";
+        return Status(SERVER_INVALID_ARGUMENT, msg);
+    } else {
+        int64_t cpu_loader_thread_num = std::stoll(value);
+        if (cpu_loader_thread_num <= 0) {
+            std::string msg = "Invalid cpu loader thread num: " + value +
+                              ". Possible reason: engine_config.cpu_loader_thread_num is not a positive integer.";
+            return Status(SERVER_INVALID_ARGUMENT, msg);
+        }
+    }
+    return Status::OK();
+}
+
 Status
 Config::CheckEngineConfigUseAVX512(const std::string& value) {
     if (!ValidationUtil::ValidateStringIsBool(value).ok()) {
@@ -1037,6 +1249,30 @@ Config::CheckEngineConfigUseAVX512(const std::string& value) {
     return Status::OK();
 }
 
+Status
+Config::CheckEngineConfigSharedIvfCentroids(const std::string& value) {
+    if (!ValidationUtil::ValidateStringIsBool(value).ok()) {
+        std::string msg = "Invalid engine config: " + value +
+                          ". Possible reason: engine_config.shared_ivf_centroids is not a boolean.";
+        return Status(SERVER_INVALID_ARGUMENT, msg);
+    }
+    return Status::OK();
+}
+
+Status
+Config::CheckEngineConfigSegmentPruningFactor(const std::string& value) {
+    std::string msg = "Invalid segment pruning factor: " + value +
+                      ". Possible reason: engine_config.segment_pruning_factor is not in range [0.0, 1.0].";
+    if (!ValidationUtil::ValidateStringIsFloat(value).ok()) {
+        return Status(SERVER_INVALID_ARGUMENT, msg);
+    }
+    float segment_pruning_factor = std::stof(value);
+    if (segment_pruning_factor < 0.0 || segment_pruning_factor > 1.0) {
+        return Status(SERVER_INVALID_ARGUMENT, msg);
+    }
+    return Status::OK();
+}
+
 #ifdef MILVUS_GPU_VERSION
 
 Status
@@ -1224,6 +1460,28 @@ Config::CheckWalConfigBufferSize(const std::string& value) {
     return Status::OK();
 }
 
+Status
+Config::CheckWalConfigSyncMode(const std::string& value) {
+    std::string mode = value;
+    std::transform(mode.begin(), mode.end(), mode.begin(), ::tolower);
+    if (mode != "none" && mode != "batch" && mode != "interval") {
+        std::string msg = "Invalid wal sync mode: " + value +
+                          ". Possible reason: wal_config.sync_mode is not one of none, batch and interval.";
+        return Status(SERVER_INVALID_ARGUMENT, msg);
+    }
+    return Status::OK();
+}
+
+Status
+Config::CheckWalConfigSyncInterval(const std::string& value) {
+    if (!ValidationUtil::ValidateStringIsNumber(value).ok() || std::stoll(value) <= 0) {
+        std::string msg = "Invalid wal sync interval: " + value +
+                          ". Possible reason: wal_config.sync_interval is not a positive integer.";
+        return Status(SERVER_INVALID_ARGUMENT, msg);
+    }
+    return Status::OK();
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 ConfigNode&
 Config::GetConfigRoot() {
@@ -1352,6 +1610,31 @@ Config::GetServerConfigWebPort(std::string& value) {
     return CheckServerConfigWebPort(value);
 }
 
+Status
+Config::GetServerConfigDqlThreadNum(int64_t& value) {
+    std::string str = GetConfigStr(CONFIG_SERVER, CONFIG_SERVER_DQL_THREAD_NUM, CONFIG_SERVER_DQL_THREAD_NUM_DEFAULT);
+    CONFIG_CHECK(CheckServerConfigDqlThreadNum(str));
+    value = std::stoll(str);
+    return Status::OK();
+}
+
+Status
+Config::GetServerConfigRequestQueueDepth(int64_t& value) {
+    std::string str =
+        GetConfigStr(CONFIG_SERVER, CONFIG_SERVER_REQUEST_QUEUE_DEPTH, CONFIG_SERVER_REQUEST_QUEUE_DEPTH_DEFAULT);
+    CONFIG_CHECK(CheckServerConfigRequestQueueDepth(str));
+    value = std::stoll(str);
+    return Status::OK();
+}
+
+Status
+Config::GetServerConfigDqlQueueDepth(int64_t& value) {
+    std::string str = GetConfigStr(CONFIG_SERVER, CONFIG_SERVER_DQL_QUEUE_DEPTH, CONFIG_SERVER_DQL_QUEUE_DEPTH_DEFAULT);
+    CONFIG_CHECK(CheckServerConfigDqlQueueDepth(str));
+    value = std::stoll(str);
+    return Status::OK();
+}
+
 /* DB config */
 Status
 Config::GetDBConfigBackendUrl(std::string& value) {
@@ -1377,6 +1660,23 @@ Config::GetDBConfigArchiveDaysThreshold(int64_t& value) {
     return Status::OK();
 }
 
+Status
+Config::GetDBConfigSearchCombineMaxWait(int64_t& value) {
+    std::string str =
+        GetConfigStr(CONFIG_DB, CONFIG_DB_SEARCH_COMBINE_MAX_WAIT, CONFIG_DB_SEARCH_COMBINE_MAX_WAIT_DEFAULT);
+    CONFIG_CHECK(CheckDBConfigSearchCombineMaxWait(str));
+    value = std::stoll(str);
+    return Status::OK();
+}
+
+Status
+Config::GetDBConfigSearchCombineMaxNq(int64_t& value) {
+    std::string str = GetConfigStr(CONFIG_DB, CONFIG_DB_SEARCH_COMBINE_MAX_NQ, CONFIG_DB_SEARCH_COMBINE_MAX_NQ_DEFAULT);
+    CONFIG_CHECK(CheckDBConfigSearchCombineMaxNq(str));
+    value = std::stoll(str);
+    return Status::OK();
+}
+
 Status
 Config::GetDBConfigPreloadTable(std::string& value) {
     value = GetConfigStr(CONFIG_DB, CONFIG_DB_PRELOAD_TABLE);
@@ -1484,6 +1784,24 @@ Config::GetCacheConfigCpuCacheThreshold(float& value) {
     return Status::OK();
 }
 
+Status
+Config::GetCacheConfigSegmentCacheCapacity(int64_t& value) {
+    std::string str =
+        GetConfigStr(CONFIG_CACHE, CONFIG_CACHE_SEGMENT_CACHE_CAPACITY, CONFIG_CACHE_SEGMENT_CACHE_CAPACITY_DEFAULT);
+    CONFIG_CHECK(CheckCacheConfigSegmentCacheCapacity(str));
+    value = std::stoll(str);
+    return Status::OK();
+}
+
+Status
+Config::GetCacheConfigCpuCacheSnapshotInterval(int64_t& value) {
+    std::string str = GetConfigStr(CONFIG_CACHE, CONFIG_CACHE_CPU_CACHE_SNAPSHOT_INTERVAL,
+                                   CONFIG_CACHE_CPU_CACHE_SNAPSHOT_INTERVAL_DEFAULT);
+    CONFIG_CHECK(CheckCacheConfigCpuCacheSnapshotInterval(str));
+    value = std::stoll(str);
+    return Status::OK();
+}
+
 Status
 Config::GetCacheConfigInsertBufferSize(int64_t& value) {
     std::string str =
@@ -1521,6 +1839,24 @@ Config::GetEngineConfigOmpThreadNum(int64_t& value) {
     return Status::OK();
 }
 
+Status
+Config::GetEngineConfigCpuExecutorThreadNum(int64_t& value) {
+    std::string str = GetConfigStr(CONFIG_ENGINE, CONFIG_ENGINE_CPU_EXECUTOR_THREAD_NUM,
+                                   CONFIG_ENGINE_CPU_EXECUTOR_THREAD_NUM_DEFAULT);
+    CONFIG_CHECK(CheckEngineConfigCpuExecutorThreadNum(str));
+    value = std::stoll(str);
+    return Status::OK();
+}
+
+Status
+Config::GetEngineConfigCpuLoaderThreadNum(int64_t& value) {
+    std::string str =
+        GetConfigStr(CONFIG_ENGINE, CONFIG_ENGINE_CPU_LOADER_THREAD_NUM, CONFIG_ENGINE_CPU_LOADER_THREAD_NUM_DEFAULT);
+    CONFIG_CHECK(CheckEngineConfigCpuLoaderThreadNum(str));
+    value = std::stoll(str);
+    return Status::OK();
+}
+
 Status
 Config::GetEngineConfigUseAVX512(bool& value) {
     std::string str = GetConfigStr(CONFIG_ENGINE, CONFIG_ENGINE_USE_AVX512, CONFIG_ENGINE_USE_AVX512_DEFAULT);
@@ -1530,6 +1866,25 @@ Config::GetEngineConfigUseAVX512(bool& value) {
     return Status::OK();
 }
 
+Status
+Config::GetEngineConfigSharedIvfCentroids(bool& value) {
+    std::string str =
+        GetConfigStr(CONFIG_ENGINE, CONFIG_ENGINE_SHARED_IVF_CENTROIDS, CONFIG_ENGINE_SHARED_IVF_CENTROIDS_DEFAULT);
+    CONFIG_CHECK(CheckEngineConfigSharedIvfCentroids(str));
+    std::transform(str.begin(), str.end(), str.begin(), ::tolower);
+    value = (str == "true" || str == "on" || str == "yes" || str == "1");
+    return Status::OK();
+}
+
+Status
+Config::GetEngineConfigSegmentPruningFactor(float& value) {
+    std::string str = GetConfigStr(CONFIG_ENGINE, CONFIG_ENGINE_SEGMENT_PRUNING_FACTOR,
+                                   CONFIG_ENGINE_SEGMENT_PRUNING_FACTOR_DEFAULT);
+    CONFIG_CHECK(CheckEngineConfigSegmentPruningFactor(str));
+    value = std::stof(str);
+    return Status::OK();
+}
+
 #ifdef MILVUS_GPU_VERSION
 
 Status
@@ -1687,6 +2042,23 @@ Config::GetWalConfigWalPath(std::string& wal_path) {
     return Status::OK();
 }
 
+Status
+Config::GetWalConfigSyncMode(std::string& sync_mode) {
+    std::string str = GetConfigStr(CONFIG_WAL, CONFIG_WAL_SYNC_MODE, CONFIG_WAL_SYNC_MODE_DEFAULT);
+    CONFIG_CHECK(CheckWalConfigSyncMode(str));
+    std::transform(str.begin(), str.end(), str.begin(), ::tolower);
+    sync_mode = str;
+    return Status::OK();
+}
+
+Status
+Config::GetWalConfigSyncInterval(int64_t& sync_interval) {
+    std::string str = GetConfigStr(CONFIG_WAL, CONFIG_WAL_SYNC_INTERVAL, CONFIG_WAL_SYNC_INTERVAL_DEFAULT);
+    CONFIG_CHECK(CheckWalConfigSyncInterval(str));
+    sync_interval = std::stoll(str);
+    return Status::OK();
+}
+
 Status
 Config::GetServerRestartRequired(bool& required) {
     required = restart_required_;
@@ -1725,6 +2097,24 @@ Config::SetServerConfigWebPort(const std::string& value) {
     return SetConfigValueInMem(CONFIG_SERVER, CONFIG_SERVER_WEB_PORT, value);
 }
 
+Status
+Config::SetServerConfigDqlThreadNum(const std::string& value) {
+    CONFIG_CHECK(CheckServerConfigDqlThreadNum(value));
+    return SetConfigValueInMem(CONFIG_SERVER, CONFIG_SERVER_DQL_THREAD_NUM, value);
+}
+
+Status
+Config::SetServerConfigRequestQueueDepth(const std::string& value) {
+    CONFIG_CHECK(CheckServerConfigRequestQueueDepth(value));
+    return SetConfigValueInMem(CONFIG_SERVER, CONFIG_SERVER_REQUEST_QUEUE_DEPTH, value);
+}
+
+Status
+Config::SetServerConfigDqlQueueDepth(const std::string& value) {
+    CONFIG_CHECK(CheckServerConfigDqlQueueDepth(value));
+    return SetConfigValueInMem(CONFIG_SERVER, CONFIG_SERVER_DQL_QUEUE_DEPTH, value);
+}
+
 /* db config */
 Status
 Config::SetDBConfigBackendUrl(const std::string& value) {
@@ -1744,6 +2134,18 @@ Config::SetDBConfigArchiveDaysThreshold(const std::string& value) {
     return SetConfigValueInMem(CONFIG_DB, CONFIG_DB_ARCHIVE_DAYS_THRESHOLD, value);
 }
 
+Status
+Config::SetDBConfigSearchCombineMaxWait(const std::string& value) {
+    CONFIG_CHECK(CheckDBConfigSearchCombineMaxWait(value));
+    return SetConfigValueInMem(CONFIG_DB, CONFIG_DB_SEARCH_COMBINE_MAX_WAIT, value);
+}
+
+Status
+Config::SetDBConfigSearchCombineMaxNq(const std::string& value) {
+    CONFIG_CHECK(CheckDBConfigSearchCombineMaxNq(value));
+    return SetConfigValueInMem(CONFIG_DB, CONFIG_DB_SEARCH_COMBINE_MAX_NQ, value);
+}
+
 /* storage config */
 Status
 Config::SetStorageConfigPrimaryPath(const std::string& value) {
@@ -1827,6 +2229,20 @@ Config::SetCacheConfigCpuCacheThreshold(const std::string& value) {
     return SetConfigValueInMem(CONFIG_CACHE, CONFIG_CACHE_CPU_CACHE_THRESHOLD, value);
 }
 
+Status
+Config::SetCacheConfigSegmentCacheCapacity(const std::string& value) {
+    CONFIG_CHECK(CheckCacheConfigSegmentCacheCapacity(value));
+    CONFIG_CHECK(SetConfigValueInMem(CONFIG_CACHE, CONFIG_CACHE_SEGMENT_CACHE_CAPACITY, value));
+    cache::SegmentCacheMgr::GetInstance()->SetCapacity(std::stol(value) << 30);
+    return Status::OK();
+}
+
+Status
+Config::SetCacheConfigCpuCacheSnapshotInterval(const std::string& value) {
+    CONFIG_CHECK(CheckCacheConfigCpuCacheSnapshotInterval(value));
+    return SetConfigValueInMem(CONFIG_CACHE, CONFIG_CACHE_CPU_CACHE_SNAPSHOT_INTERVAL, value);
+}
+
 Status
 Config::SetCacheConfigInsertBufferSize(const std::string& value) {
     CONFIG_CHECK(CheckCacheConfigInsertBufferSize(value));
@@ -1855,12 +2271,36 @@ Config::SetEngineConfigOmpThreadNum(const std::string& value) {
     return SetConfigValueInMem(CONFIG_ENGINE, CONFIG_ENGINE_OMP_THREAD_NUM, value);
 }
 
+Status
+Config::SetEngineConfigCpuExecutorThreadNum(const std::string& value) {
+    CONFIG_CHECK(CheckEngineConfigCpuExecutorThreadNum(value));
+    return SetConfigValueInMem(CONFIG_ENGINE, CONFIG_ENGINE_CPU_EXECUTOR_THREAD_NUM, value);
+}
+
+Status
+Config::SetEngineConfigCpuLoaderThreadNum(const std::string& value) {
+    CONFIG_CHECK(CheckEngineConfigCpuLoaderThreadNum(value));
+    return SetConfigValueInMem(CONFIG_ENGINE, CONFIG_ENGINE_CPU_LOADER_THREAD_NUM, value);
+}
+
 Status
 Config::SetEngineConfigUseAVX512(const std::string& value) {
     CONFIG_CHECK(CheckEngineConfigUseAVX512(value));
     return SetConfigValueInMem(CONFIG_ENGINE, CONFIG_ENGINE_USE_AVX512, value);
 }
 
+Status
+Config::SetEngineConfigSharedIvfCentroids(const std::string& value) {
+    CONFIG_CHECK(CheckEngineConfigSharedIvfCentroids(value));
+    return SetConfigValueInMem(CONFIG_ENGINE, CONFIG_ENGINE_SHARED_IVF_CENTROIDS, value);
+}
+
+Status
+Config::SetEngineConfigSegmentPruningFactor(const std::string& value) {
+    CONFIG_CHECK(CheckEngineConfigSegmentPruningFactor(value));
+    return SetConfigValueInMem(CONFIG_ENGINE, CONFIG_ENGINE_SEGMENT_PRUNING_FACTOR, value);
+}
+
 #ifdef MILVUS_GPU_VERSION
 Status
 Config::SetEngineConfigGpuSearchThreshold(const std::string& value) {
@@ -48,6 +48,12 @@ static const char* CONFIG_SERVER_TIME_ZONE = "time_zone";
 static const char* CONFIG_SERVER_TIME_ZONE_DEFAULT = "UTC+8";
 static const char* CONFIG_SERVER_WEB_PORT = "web_port";
 static const char* CONFIG_SERVER_WEB_PORT_DEFAULT = "19121";
+static const char* CONFIG_SERVER_DQL_THREAD_NUM = "dql_thread_num";
+static const char* CONFIG_SERVER_DQL_THREAD_NUM_DEFAULT = "0";
+static const char* CONFIG_SERVER_REQUEST_QUEUE_DEPTH = "request_queue_depth";
+static const char* CONFIG_SERVER_REQUEST_QUEUE_DEPTH_DEFAULT = "1024";
+static const char* CONFIG_SERVER_DQL_QUEUE_DEPTH = "dql_queue_depth";
+static const char* CONFIG_SERVER_DQL_QUEUE_DEPTH_DEFAULT = "1024";
 
 /* db config */
 static const char* CONFIG_DB = "db_config";
@@ -61,6 +67,10 @@ static const char* CONFIG_DB_PRELOAD_TABLE = "preload_table";
 static const char* CONFIG_DB_PRELOAD_TABLE_DEFAULT = "";
 static const char* CONFIG_DB_AUTO_FLUSH_INTERVAL = "auto_flush_interval";
 static const char* CONFIG_DB_AUTO_FLUSH_INTERVAL_DEFAULT = "1";
+static const char* CONFIG_DB_SEARCH_COMBINE_MAX_WAIT = "search_combine_max_wait";
+static const char* CONFIG_DB_SEARCH_COMBINE_MAX_WAIT_DEFAULT = "0";
+static const char* CONFIG_DB_SEARCH_COMBINE_MAX_NQ = "search_combine_max_nq";
+static const char* CONFIG_DB_SEARCH_COMBINE_MAX_NQ_DEFAULT = "2048";
 
 /* storage config */
 static const char* CONFIG_STORAGE = "storage_config";
@@ -91,6 +101,10 @@ static const char* CONFIG_CACHE_INSERT_BUFFER_SIZE = "insert_buffer_size";
 static const char* CONFIG_CACHE_INSERT_BUFFER_SIZE_DEFAULT = "1";
 static const char* CONFIG_CACHE_CACHE_INSERT_DATA = "cache_insert_data";
 static const char* CONFIG_CACHE_CACHE_INSERT_DATA_DEFAULT = "false";
+static const char* CONFIG_CACHE_SEGMENT_CACHE_CAPACITY = "segment_cache_capacity";
+static const char* CONFIG_CACHE_SEGMENT_CACHE_CAPACITY_DEFAULT = "1";
+static const char* CONFIG_CACHE_CPU_CACHE_SNAPSHOT_INTERVAL = "cpu_cache_snapshot_interval";
+static const char* CONFIG_CACHE_CPU_CACHE_SNAPSHOT_INTERVAL_DEFAULT = "60";
 
 /* metric config */
 static const char* CONFIG_METRIC = "metric_config";
@@ -109,8 +123,16 @@ static const char* CONFIG_ENGINE_OMP_THREAD_NUM = "omp_thread_num";
 static const char* CONFIG_ENGINE_OMP_THREAD_NUM_DEFAULT = "0";
 static const char* CONFIG_ENGINE_USE_AVX512 = "use_avx512";
 static const char* CONFIG_ENGINE_USE_AVX512_DEFAULT = "true";
+static const char* CONFIG_ENGINE_SHARED_IVF_CENTROIDS = "shared_ivf_centroids";
+static const char* CONFIG_ENGINE_SHARED_IVF_CENTROIDS_DEFAULT = "false";
+static const char* CONFIG_ENGINE_SEGMENT_PRUNING_FACTOR = "segment_pruning_factor";
+static const char* CONFIG_ENGINE_SEGMENT_PRUNING_FACTOR_DEFAULT = "0";
 static const char* CONFIG_ENGINE_GPU_SEARCH_THRESHOLD = "gpu_search_threshold";
 static const char* CONFIG_ENGINE_GPU_SEARCH_THRESHOLD_DEFAULT = "1000";
+static const char* CONFIG_ENGINE_CPU_EXECUTOR_THREAD_NUM = "cpu_executor_thread_num";
+static const char* CONFIG_ENGINE_CPU_EXECUTOR_THREAD_NUM_DEFAULT = "1";
+static const char* CONFIG_ENGINE_CPU_LOADER_THREAD_NUM = "cpu_loader_thread_num";
+static const char* CONFIG_ENGINE_CPU_LOADER_THREAD_NUM_DEFAULT = "1";
 
 /* gpu resource config */
 static const char* CONFIG_GPU_RESOURCE = "gpu_resource_config";
@@ -146,6 +168,10 @@ static const int64_t CONFIG_WAL_BUFFER_SIZE_MAX = 4096;
 static const int64_t CONFIG_WAL_BUFFER_SIZE_MIN = 64;
 static const char* CONFIG_WAL_WAL_PATH = "wal_path";
 static const char* CONFIG_WAL_WAL_PATH_DEFAULT = "/tmp/milvus/wal";
+static const char* CONFIG_WAL_SYNC_MODE = "sync_mode";
+static const char* CONFIG_WAL_SYNC_MODE_DEFAULT = "none";
+static const char* CONFIG_WAL_SYNC_INTERVAL = "sync_interval";
+static const char* CONFIG_WAL_SYNC_INTERVAL_DEFAULT = "1000";
 
 class Config {
  private:
@@ -209,6 +235,12 @@ class Config {
     CheckServerConfigTimeZone(const std::string& value);
     Status
     CheckServerConfigWebPort(const std::string& value);
+    Status
+    CheckServerConfigDqlThreadNum(const std::string& value);
+    Status
+    CheckServerConfigRequestQueueDepth(const std::string& value);
+    Status
+    CheckServerConfigDqlQueueDepth(const std::string& value);
 
     /* db config */
     Status
@@ -218,6 +250,10 @@ class Config {
     Status
     CheckDBConfigArchiveDaysThreshold(const std::string& value);
     Status
+    CheckDBConfigSearchCombineMaxWait(const std::string& value);
+    Status
+    CheckDBConfigSearchCombineMaxNq(const std::string& value);
+    Status
     CheckDBConfigAutoFlushInterval(const std::string& value);
 
     /* storage config */
@@ -252,6 +288,10 @@ class Config {
     Status
     CheckCacheConfigCpuCacheThreshold(const std::string& value);
     Status
+    CheckCacheConfigSegmentCacheCapacity(const std::string& value);
+    Status
+    CheckCacheConfigCpuCacheSnapshotInterval(const std::string& value);
+    Status
     CheckCacheConfigInsertBufferSize(const std::string& value);
     Status
     CheckCacheConfigCacheInsertData(const std::string& value);
@@ -262,7 +302,15 @@ class Config {
     Status
     CheckEngineConfigOmpThreadNum(const std::string& value);
     Status
+    CheckEngineConfigCpuExecutorThreadNum(const std::string& value);
+    Status
+    CheckEngineConfigCpuLoaderThreadNum(const std::string& value);
+    Status
     CheckEngineConfigUseAVX512(const std::string& value);
+    Status
+    CheckEngineConfigSharedIvfCentroids(const std::string& value);
+    Status
+    CheckEngineConfigSegmentPruningFactor(const std::string& value);
 
 #ifdef MILVUS_GPU_VERSION
     Status
@@ -288,6 +336,10 @@ class Config {
     CheckWalConfigRecoveryErrorIgnore(const std::string& value);
     Status
     CheckWalConfigBufferSize(const std::string& value);
+    Status
+    CheckWalConfigSyncMode(const std::string& value);
+    Status
+    CheckWalConfigSyncInterval(const std::string& value);
 
     std::string
     GetConfigStr(const std::string& parent_key, const std::string& child_key, const std::string& default_value = "");
@@ -312,6 +364,12 @@ class Config {
     GetServerConfigTimeZone(std::string& value);
     Status
     GetServerConfigWebPort(std::string& value);
+    Status
+    GetServerConfigDqlThreadNum(int64_t& value);
+    Status
+    GetServerConfigRequestQueueDepth(int64_t& value);
+    Status
+    GetServerConfigDqlQueueDepth(int64_t& value);
 
     /* db config */
     Status
@@ -321,6 +379,10 @@ class Config {
     Status
     GetDBConfigArchiveDaysThreshold(int64_t& value);
     Status
+    GetDBConfigSearchCombineMaxWait(int64_t& value);
+    Status
+    GetDBConfigSearchCombineMaxNq(int64_t& value);
+    Status
     GetDBConfigPreloadTable(std::string& value);
     Status
     GetDBConfigAutoFlushInterval(int64_t& value);
@@ -357,6 +419,10 @@ class Config {
     Status
     GetCacheConfigCpuCacheThreshold(float& value);
     Status
+    GetCacheConfigSegmentCacheCapacity(int64_t& value);
+    Status
+    GetCacheConfigCpuCacheSnapshotInterval(int64_t& value);
+    Status
     GetCacheConfigInsertBufferSize(int64_t& value);
     Status
     GetCacheConfigCacheInsertData(bool& value);
@@ -367,7 +433,15 @@ class Config {
     Status
     GetEngineConfigOmpThreadNum(int64_t& value);
     Status
+    GetEngineConfigCpuExecutorThreadNum(int64_t& value);
+    Status
+    GetEngineConfigCpuLoaderThreadNum(int64_t& value);
+    Status
     GetEngineConfigUseAVX512(bool& value);
+    Status
+    GetEngineConfigSharedIvfCentroids(bool& value);
+    Status
+    GetEngineConfigSegmentPruningFactor(float& value);
 
 #ifdef MILVUS_GPU_VERSION
     Status
@@ -399,6 +473,10 @@ class Config {
     GetWalConfigBufferSize(int64_t& buffer_size);
     Status
     GetWalConfigWalPath(std::string& wal_path);
+    Status
+    GetWalConfigSyncMode(std::string& sync_mode);
+    Status
+    GetWalConfigSyncInterval(int64_t& sync_interval);
 
     Status
     GetServerRestartRequired(bool& required);
@@ -415,6 +493,12 @@ class Config {
     SetServerConfigTimeZone(const std::string& value);
     Status
     SetServerConfigWebPort(const std::string& value);
+    Status
+    SetServerConfigDqlThreadNum(const std::string& value);
+    Status
+    SetServerConfigRequestQueueDepth(const std::string& value);
+    Status
+    SetServerConfigDqlQueueDepth(const std::string& value);
 
     /* db config */
     Status
@@ -423,6 +507,10 @@ class Config {
     SetDBConfigArchiveDiskThreshold(const std::string& value);
     Status
     SetDBConfigArchiveDaysThreshold(const std::string& value);
+    Status
+    SetDBConfigSearchCombineMaxWait(const std::string& value);
+    Status
+    SetDBConfigSearchCombineMaxNq(const std::string& value);
 
     /* storage config */
     Status
@@ -456,6 +544,10 @@ class Config {
     Status
     SetCacheConfigCpuCacheThreshold(const std::string& value);
     Status
+    SetCacheConfigSegmentCacheCapacity(const std::string& value);
+    Status
+    SetCacheConfigCpuCacheSnapshotInterval(const std::string& value);
+    Status
     SetCacheConfigInsertBufferSize(const std::string& value);
     Status
     SetCacheConfigCacheInsertData(const std::string& value);
@@ -466,7 +558,15 @@ class Config {
     Status
     SetEngineConfigOmpThreadNum(const std::string& value);
     Status
+    SetEngineConfigCpuExecutorThreadNum(const std::string& value);
+    Status
+    SetEngineConfigCpuLoaderThreadNum(const std::string& value);
+    Status
     SetEngineConfigUseAVX512(const std::string& value);
+    Status
+    SetEngineConfigSharedIvfCentroids(const std::string& value);
+    Status
+    SetEngineConfigSegmentPruningFactor(const std::string& value);
 
 #ifdef MILVUS_GPU_VERSION
     Status
@@ -44,6 +44,36 @@ DBWrapper::StartService() {
         return s;
     }
 
+    s = config.GetDBConfigSearchCombineMaxWait(opt.search_combine_max_wait_);
+    if (!s.ok()) {
+        std::cerr << s.ToString() << std::endl;
+        return s;
+    }
+
+    s = config.GetDBConfigSearchCombineMaxNq(opt.search_combine_max_nq_);
+    if (!s.ok()) {
+        std::cerr << s.ToString() << std::endl;
+        return s;
+    }
+
+    s = config.GetEngineConfigSharedIvfCentroids(opt.shared_ivf_centroids_);
+    if (!s.ok()) {
+        std::cerr << s.ToString() << std::endl;
+        return s;
+    }
+
+    s = config.GetEngineConfigSegmentPruningFactor(opt.segment_pruning_factor_);
+    if (!s.ok()) {
+        std::cerr << s.ToString() << std::endl;
+        return s;
+    }
+
+    s = config.GetCacheConfigCpuCacheSnapshotInterval(opt.cache_snapshot_interval_);
+    if (!s.ok()) {
+        std::cerr << s.ToString() << std::endl;
+        return s;
+    }
+
     std::string path;
     s = config.GetStorageConfigPrimaryPath(path);
     if (!s.ok()) {
@@ -117,6 +147,20 @@ DBWrapper::StartService() {
             std::cerr << s.ToString() << std::endl;
             kill(0, SIGUSR1);
         }
+
+        s = config.GetWalConfigSyncMode(opt.wal_sync_mode_);
+        if (!s.ok()) {
+            std::cerr << "ERROR! Failed to get wal sync_mode configuration." << std::endl;
+            std::cerr << s.ToString() << std::endl;
+            kill(0, SIGUSR1);
+        }
+
+        s = config.GetWalConfigSyncInterval(opt.wal_sync_interval_);
+        if (!s.ok()) {
+            std::cerr << "ERROR! Failed to get wal sync_interval configuration." << std::endl;
+            std::cerr << s.ToString() << std::endl;
+            kill(0, SIGUSR1);
+        }
     }
 
     // engine config
@@ -30,6 +30,7 @@
 #include "server/delivery/request/FlushRequest.h"
 #include "server/delivery/request/GetVectorByIDRequest.h"
 #include "server/delivery/request/GetVectorIDsRequest.h"
+#include "server/delivery/request/GetVectorsByIDRequest.h"
 #include "server/delivery/request/HasTableRequest.h"
 #include "server/delivery/request/InsertRequest.h"
 #include "server/delivery/request/PreloadTableRequest.h"
@@ -95,6 +96,15 @@ RequestHandler::GetVectorByID(const std::shared_ptr<Context>& context, const std
     return request_ptr->status();
 }
 
+Status
+RequestHandler::GetVectorsByID(const std::shared_ptr<Context>& context, const std::string& table_name,
+                               const std::vector<int64_t>& ids, std::vector<engine::VectorsData>& vectors) {
+    BaseRequestPtr request_ptr = GetVectorsByIDRequest::Create(context, table_name, ids, vectors);
+    RequestScheduler::ExecRequest(request_ptr);
+
+    return request_ptr->status();
+}
+
 Status
 RequestHandler::GetVectorIDs(const std::shared_ptr<Context>& context, const std::string& table_name,
                              const std::string& segment_name, std::vector<int64_t>& vector_ids) {
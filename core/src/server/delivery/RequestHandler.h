@@ -48,6 +48,10 @@ class RequestHandler {
     GetVectorByID(const std::shared_ptr<Context>& context, const std::string& table_name,
                   const std::vector<int64_t>& ids, engine::VectorsData& vectors);
 
+    Status
+    GetVectorsByID(const std::shared_ptr<Context>& context, const std::string& table_name,
+                   const std::vector<int64_t>& ids, std::vector<engine::VectorsData>& vectors);
+
     Status
     GetVectorIDs(const std::shared_ptr<Context>& context, const std::string& table_name,
                  const std::string& segment_name, std::vector<int64_t>& vector_ids);
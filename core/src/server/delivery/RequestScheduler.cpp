@@ -10,6 +10,8 @@
 // or implied. See the License for the specific language governing permissions and limitations under the License.
 
 #include "server/delivery/RequestScheduler.h"
+#include "server/Config.h"
+#include "utils/CommonUtil.h"
 #include "utils/Log.h"
 
 #include <fiu-local.h>
@@ -53,31 +55,60 @@ RequestScheduler::Start() {
 
 void
 RequestScheduler::Stop() {
-    if (stopped_ && request_groups_.empty() && execute_threads_.empty()) {
-        return;
+    // requests arriving from now on go to new queues, the old ones are stopped without holding the lock,
+    // a full queue would otherwise block every caller of PutToQueue until its workers catch up
+    std::map<std::string, RequestQueuePtr> request_groups;
+    std::map<std::string, int64_t> group_thread_num;
+    std::vector<ThreadPtr> execute_threads;
+    {
+        std::lock_guard<std::mutex> lock(queue_mtx_);
+        if (stopped_ && request_groups_.empty() && execute_threads_.empty()) {
+            return;
+        }
+        request_groups.swap(request_groups_);
+        group_thread_num.swap(group_thread_num_);
+        execute_threads.swap(execute_threads_);
+        stopped_ = true;
     }
 
     SERVER_LOG_INFO << "Scheduler gonna stop...";
-    {
-        std::lock_guard<std::mutex> lock(queue_mtx_);
-        for (auto& iter : request_groups_) {
-            if (iter.second != nullptr) {
+    for (auto& iter : request_groups) {
+        if (iter.second != nullptr) {
+            // pending requests are dropped so the stop requests get queue space without waiting for them,
+            // each worker of the group exits after taking one null request
+            CancelPendingRequests(iter.second);
+            for (int64_t i = 0; i < group_thread_num[iter.first]; ++i) {
                 iter.second->Put(nullptr);
             }
         }
     }
 
-    for (auto& iter : execute_threads_) {
+    for (auto& iter : execute_threads) {
         if (iter == nullptr)
             continue;
         iter->join();
     }
-    request_groups_.clear();
-    execute_threads_.clear();
-    stopped_ = true;
+
+    // requests put by callers which took a queue before it was swapped out
+    for (auto& iter : request_groups) {
+        if (iter.second != nullptr) {
+            CancelPendingRequests(iter.second);
+        }
+    }
     SERVER_LOG_INFO << "Scheduler stopped";
 }
 
+void
+RequestScheduler::CancelPendingRequests(const RequestQueuePtr& request_queue) {
+    BaseRequestPtr request;
+    while (request_queue->TryTake(request)) {
+        if (request != nullptr) {
+            request->set_status(Status(SERVER_UNEXPECTED_ERROR, "Request scheduler is stopped"));
+            request->Done();
+        }
+    }
+}
+
 Status
 RequestScheduler::ExecuteRequest(const BaseRequestPtr& request_ptr) {
     if (request_ptr == nullptr) {
@@ -127,26 +158,70 @@ RequestScheduler::TakeToExecute(RequestQueuePtr request_queue) {
 
 Status
 RequestScheduler::PutToQueue(const BaseRequestPtr& request_ptr) {
-    std::lock_guard<std::mutex> lock(queue_mtx_);
-
     std::string group_name = request_ptr->RequestGroup();
-    if (request_groups_.count(group_name) > 0) {
-        request_groups_[group_name]->Put(request_ptr);
-    } else {
-        RequestQueuePtr queue = std::make_shared<RequestQueue>();
+    RequestQueuePtr queue;
+    {
+        std::lock_guard<std::mutex> lock(queue_mtx_);
+        if (request_groups_.count(group_name) > 0) {
+            queue = request_groups_[group_name];
+        } else {
+            int64_t queue_depth = 0;
+            if (group_name == DQL_REQUEST_GROUP) {
+                Config::GetInstance().GetServerConfigDqlQueueDepth(queue_depth);
+            } else {
+                Config::GetInstance().GetServerConfigRequestQueueDepth(queue_depth);
+            }
+
+            queue = std::make_shared<RequestQueue>();
+            queue->SetCapacity(queue_depth);
+            request_groups_.insert(std::make_pair(group_name, queue));
+            fiu_do_on("RequestScheduler.PutToQueue.null_queue", queue = nullptr);
+
+            // start worker threads, all of them take requests from the same queue
+            int64_t thread_num = GroupThreadNum(group_name);
+            group_thread_num_[group_name] = thread_num;
+            for (int64_t i = 0; i < thread_num; ++i) {
+                ThreadPtr thread = std::make_shared<std::thread>(&RequestScheduler::TakeToExecute, this, queue);
+                fiu_do_on("RequestScheduler.PutToQueue.push_null_thread", execute_threads_.push_back(nullptr));
+                execute_threads_.push_back(thread);
+            }
+            SERVER_LOG_INFO << "Create " << thread_num << " thread(s) for request group: " << group_name;
+        }
+    }
+
+    // search requests are rejected once the queue is full, so that clients get a fast failure instead of
+    // queueing behind a long backlog; ddl/dml requests keep blocking the caller to apply back pressure
+    Status status;
+    if (queue == nullptr) {
+        status = Status(SERVER_NULL_POINTER, "Request queue is null for group: " + group_name);
+    } else if (group_name != DQL_REQUEST_GROUP) {
         queue->Put(request_ptr);
-        request_groups_.insert(std::make_pair(group_name, queue));
-        fiu_do_on("RequestScheduler.PutToQueue.null_queue", queue = nullptr);
+    } else if (!queue->TryPut(request_ptr)) {
+        status = Status(SERVER_REQUEST_QUEUE_FULL, "Too many pending search requests, please retry later");
+    }
 
-        // start a thread
-        ThreadPtr thread = std::make_shared<std::thread>(&RequestScheduler::TakeToExecute, this, queue);
+    if (!status.ok()) {
+        // the request will never be executed, finish it here so that nobody waits on it forever
+        request_ptr->set_status(status);
+        request_ptr->Done();
+    }
 
-        fiu_do_on("RequestScheduler.PutToQueue.push_null_thread", execute_threads_.push_back(nullptr));
-        execute_threads_.push_back(thread);
-        SERVER_LOG_INFO << "Create new thread for request group: " << group_name;
+    return status;
+}
+
+int64_t
+RequestScheduler::GroupThreadNum(const std::string& group_name) {
+    // ddl/dml and info requests must be executed in the order they arrive
+    if (group_name != DQL_REQUEST_GROUP) {
+        return 1;
     }
 
-    return Status::OK();
+    int64_t thread_num = 0;
+    Config::GetInstance().GetServerConfigDqlThreadNum(thread_num);
+    if (thread_num <= 0) {
+        CommonUtil::GetSystemAvailableThreads(thread_num);
+    }
+    return thread_num;
 }
 
 }  // namespace server
@@ -59,11 +59,20 @@ class RequestScheduler {
     Status
     PutToQueue(const BaseRequestPtr& request_ptr);
 
+    // finish the requests left in the queue with an error, they are not executed
+    static void
+    CancelPendingRequests(const RequestQueuePtr& request_queue);
+
+    int64_t
+    GroupThreadNum(const std::string& group_name);
+
  private:
     mutable std::mutex queue_mtx_;
 
     std::map<std::string, RequestQueuePtr> request_groups_;
 
+    std::map<std::string, int64_t> group_thread_num_;
+
     std::vector<ThreadPtr> execute_threads_;
 
     bool stopped_;
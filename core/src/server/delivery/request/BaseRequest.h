@@ -143,6 +143,11 @@ class BaseRequest {
         return status_;
     }
 
+    void
+    set_status(const Status& status) {
+        status_ = status;
+    }
+
     bool
     IsAsync() const {
         return async_;
@@ -12,9 +12,12 @@
 #include "server/delivery/request/CmdRequest.h"
 #include "metrics/SystemInfo.h"
 #include "scheduler/SchedInst.h"
+#include "server/DBWrapper.h"
+#include "utils/Json.h"
 #include "utils/Log.h"
 #include "utils/TimeRecorder.h"
 
+#include <map>
 #include <memory>
 
 namespace milvus {
@@ -50,6 +53,19 @@ CmdRequest::OnExecute() {
     } else if (cmd_ == "get_system_info") {
         server::SystemInfo& sys_info_inst = server::SystemInfo::GetInstance();
         sys_info_inst.GetSysInfoJsonStr(result_);
+    } else if (cmd_ == "preload_progress") {
+        std::map<std::string, engine::PreloadProgress> progress;
+        stat = DBWrapper::DB()->GetPreloadProgress(progress);
+        json progress_json = json::object();
+        for (auto& pair : progress) {
+            auto& table_progress = pair.second;
+            progress_json[pair.first] = {{"total_files", table_progress.total_files_},
+                                         {"loaded_files", table_progress.loaded_files_},
+                                         {"total_size", table_progress.total_size_},
+                                         {"loaded_size", table_progress.loaded_size_},
+                                         {"finished", table_progress.finished_}};
+        }
+        result_ = progress_json.dump();
     } else if (cmd_ == "build_commit_id") {
         result_ = LAST_COMMIT_ID;
     } else if (cmd_.substr(0, 10) == "set_config" || cmd_.substr(0, 10) == "get_config") {
@@ -72,34 +72,30 @@ void
 CopyRowRecords(const google::protobuf::RepeatedPtrField<::milvus::grpc::RowRecord>& grpc_records,
                const google::protobuf::RepeatedField<google::protobuf::int64>& grpc_id_array,
                engine::VectorsData& vectors) {
-    // step 1: copy vector data
+    // step 1: copy vector data into one contiguous buffer, reserved up front and not zero filled
     int64_t float_data_size = 0, binary_data_size = 0;
     for (auto& record : grpc_records) {
         float_data_size += record.float_data_size();
         binary_data_size += record.binary_data().size();
     }
 
-    std::vector<float> float_array(float_data_size, 0.0f);
-    std::vector<uint8_t> binary_array(binary_data_size, 0);
-    int64_t float_offset = 0, binary_offset = 0;
+    std::vector<float> float_array;
+    std::vector<uint8_t> binary_array;
     if (float_data_size > 0) {
+        float_array.reserve(float_data_size);
         for (auto& record : grpc_records) {
-            memcpy(&float_array[float_offset], record.float_data().data(), record.float_data_size() * sizeof(float));
-            float_offset += record.float_data_size();
+            float_array.insert(float_array.end(), record.float_data().begin(), record.float_data().end());
         }
     } else if (binary_data_size > 0) {
+        binary_array.reserve(binary_data_size);
         for (auto& record : grpc_records) {
-            memcpy(&binary_array[binary_offset], record.binary_data().data(), record.binary_data().size());
-            binary_offset += record.binary_data().size();
+            auto& binary = record.binary_data();
+            binary_array.insert(binary_array.end(), binary.begin(), binary.end());
         }
     }
 
     // step 2: copy id array
-    std::vector<int64_t> id_array;
-    if (grpc_id_array.size() > 0) {
-        id_array.resize(grpc_id_array.size());
-        memcpy(id_array.data(), grpc_id_array.data(), grpc_id_array.size() * sizeof(int64_t));
-    }
+    std::vector<int64_t> id_array(grpc_id_array.begin(), grpc_id_array.end());
 
     // step 3: contruct vectors
     vectors.vector_count_ = grpc_records.size();
@@ -631,6 +627,33 @@ GrpcRequestHandler::Compact(::grpc::ServerContext* context, const ::milvus::grpc
     return ::grpc::Status::OK;
 }
 
+::grpc::Status
+GrpcRequestHandler::GetVectorsByID(::grpc::ServerContext* context, const ::milvus::grpc::VectorsIdentity* request,
+                                   ::milvus::grpc::VectorsData* response) {
+    CHECK_NULLPTR_RETURN(request);
+
+    std::vector<int64_t> vector_ids(request->id_array().begin(), request->id_array().end());
+    std::vector<engine::VectorsData> vectors;
+    Status status = request_handler_.GetVectorsByID(context_map_[context], request->table_name(), vector_ids, vectors);
+
+    // one record per requested id, left empty if the id is not found
+    for (auto& vector : vectors) {
+        auto row_record = response->add_vectors_data();
+        if (!vector.float_data_.empty()) {
+            row_record->mutable_float_data()->Resize(vector.float_data_.size(), 0);
+            memcpy(row_record->mutable_float_data()->mutable_data(), vector.float_data_.data(),
+                   vector.float_data_.size() * sizeof(float));
+        } else if (!vector.binary_data_.empty()) {
+            row_record->mutable_binary_data()->resize(vector.binary_data_.size());
+            memcpy(row_record->mutable_binary_data()->data(), vector.binary_data_.data(),
+                   vector.binary_data_.size() * sizeof(uint8_t));
+        }
+    }
+    SET_RESPONSE(response->mutable_status(), status, context);
+
+    return ::grpc::Status::OK;
+}
+
 }  // namespace grpc
 }  // namespace server
 }  // namespace milvus
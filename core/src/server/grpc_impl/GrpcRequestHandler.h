@@ -300,6 +300,16 @@ class GrpcRequestHandler final : public ::milvus::grpc::MilvusService::Service,
     ::grpc::Status
     Compact(::grpc::ServerContext* context, const ::milvus::grpc::TableName* request, ::milvus::grpc::Status* response);
 
+    // *
+    // @brief This method is used to get a batch of vectors data by id array.
+    //
+    // @param VectorsIdentity, target vector id array.
+    //
+    // @return VectorsData
+    ::grpc::Status
+    GetVectorsByID(::grpc::ServerContext* context, const ::milvus::grpc::VectorsIdentity* request,
+                   ::milvus::grpc::VectorsData* response);
+
     GrpcRequestHandler&
     RegisterRequestHandler(const RequestHandler& handler) {
         request_handler_ = handler;
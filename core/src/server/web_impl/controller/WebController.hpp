@@ -569,7 +569,7 @@ class WebController : public oatpp::web::server::api::ApiController {
     ADD_CORS(GetVectors)
     /**
      *
-     * GetVectorByID ?id=
+     * GetVectorByID ?id= or GetVectorsByID ?ids=id1,id2
      */
     ENDPOINT("GET", "/tables/{table_name}/vectors", GetVectors,
              PATH(String, table_name), QUERIES(const QueryParams&, query_params)) {
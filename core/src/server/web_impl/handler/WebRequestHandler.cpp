@@ -556,19 +556,18 @@ WebRequestHandler::DeleteByIDs(const std::string& table_name, const nlohmann::js
 Status
 WebRequestHandler::GetVectorsByIDs(const std::string& table_name, const std::vector<int64_t>& ids,
                                    nlohmann::json& json_out) {
+    if (ids.empty()) {
+        return Status::OK();
+    }
+
     std::vector<engine::VectorsData> vector_batch;
-    for (size_t i = 0; i < ids.size(); i++) {
-        auto vec_ids = std::vector<int64_t>(ids.begin() + i, ids.begin() + i + 1);
-        engine::VectorsData vectors_data;
-        auto status = request_handler_.GetVectorByID(context_ptr_, table_name, ids, vectors_data);
-        if (!status.ok()) {
-            return status;
-        }
-        vector_batch.push_back(vectors_data);
+    auto status = request_handler_.GetVectorsByID(context_ptr_, table_name, ids, vector_batch);
+    if (!status.ok()) {
+        return status;
     }
 
     bool bin;
-    auto status = IsBinaryTable(table_name, bin);
+    status = IsBinaryTable(table_name, bin);
     if (!status.ok()) {
         return status;
     }
@@ -1342,17 +1341,27 @@ WebRequestHandler::Insert(const OString& table_name, const OString& body, Vector
 
 StatusDto::ObjectWrapper
 WebRequestHandler::GetVector(const OString& table_name, const OQueryParams& query_params, OString& response) {
+    // "id" asks for a single vector, "ids" for a comma separated batch fetched in one request
+    std::vector<std::string> id_strs;
     auto id_str = query_params.get("id");
-    if (id_str.get() == nullptr) {
+    auto ids_str = query_params.get("ids");
+    if (id_str.get() != nullptr) {
+        id_strs.emplace_back(id_str->std_str());
+    } else if (ids_str.get() != nullptr) {
+        StringHelpFunctions::SplitStringByDelimeter(ids_str->std_str(), ",", id_strs);
+    } else {
         RETURN_STATUS_DTO(QUERY_PARAM_LOSS, "Need to specify vector id in query string")
     }
-    if (!ValidationUtil::ValidateStringIsNumber(id_str->std_str()).ok()) {
-        RETURN_STATUS_DTO(ILLEGAL_QUERY_PARAM, "Query param \'id\' is illegal, only non-negative integer supported");
-    }
 
-    auto id = std::stol(id_str->c_str());
+    std::vector<int64_t> ids;
+    for (auto& str : id_strs) {
+        if (!ValidationUtil::ValidateStringIsNumber(str).ok()) {
+            RETURN_STATUS_DTO(ILLEGAL_QUERY_PARAM,
+                              "Query param \'id\' is illegal, only non-negative integer supported");
+        }
+        ids.emplace_back(std::stol(str));
+    }
 
-    std::vector<int64_t> ids = {id};
     engine::VectorsData vectors;
     nlohmann::json vectors_json;
     auto status = GetVectorsByIDs(table_name->std_str(), ids, vectors_json);
@@ -34,9 +34,15 @@ class BlockingQueue {
     void
     Put(const T& task);
 
+    bool
+    TryPut(const T& task);
+
     T
     Take();
 
+    bool
+    TryTake(T& task);
+
     T
     Front();
 
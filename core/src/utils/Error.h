@@ -82,6 +82,7 @@ constexpr ErrorCode SERVER_INVALID_INDEX_METRIC_TYPE = ToServerErrorCode(115);
 constexpr ErrorCode SERVER_INVALID_INDEX_FILE_SIZE = ToServerErrorCode(116);
 constexpr ErrorCode SERVER_OUT_OF_MEMORY = ToServerErrorCode(117);
 constexpr ErrorCode SERVER_INVALID_PARTITION_TAG = ToServerErrorCode(118);
+constexpr ErrorCode SERVER_REQUEST_QUEUE_FULL = ToServerErrorCode(119);
 
 // db error code
 constexpr ErrorCode DB_META_TRANSACTION_FAILED = ToDbErrorCode(1);
@@ -105,6 +106,7 @@ constexpr ErrorCode WAL_ERROR = ToWalErrorCode(1);
 constexpr ErrorCode WAL_META_ERROR = ToWalErrorCode(2);
 constexpr ErrorCode WAL_FILE_ERROR = ToWalErrorCode(3);
 constexpr ErrorCode WAL_PATH_ERROR = ToWalErrorCode(4);
+constexpr ErrorCode WAL_CHECKSUM_ERROR = ToWalErrorCode(5);
 
 namespace server {
 class ServerException : public std::exception {
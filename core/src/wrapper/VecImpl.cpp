@@ -14,7 +14,10 @@
 #include "DataTransfer.h"
 #include "knowhere/adapter/VectorAdapter.h"
 #include "knowhere/common/Exception.h"
+#include "knowhere/index/vector_index/IndexHNSW.h"
 #include "knowhere/index/vector_index/IndexIDMAP.h"
+#include "knowhere/index/vector_index/IndexNSG.h"
+#include "knowhere/index/vector_index/IndexSPTAG.h"
 #include "utils/Log.h"
 #include "wrapper/WrapperException.h"
 #include "wrapper/gpu/GPUVecImpl.h"
@@ -39,9 +42,18 @@ namespace engine {
 Status
 VecIndexImpl::BuildAll(const int64_t& nb, const float* xb, const int64_t* ids, const Config& cfg, const int64_t& nt,
                        const float* xt) {
+    return BuildAllWithCentroids(nb, xb, ids, cfg, nullptr);
+}
+
+Status
+VecIndexImpl::BuildAllWithCentroids(const int64_t& nb, const float* xb, const int64_t* ids, const Config& cfg,
+                                    const float* centroids) {
     try {
         dim = cfg->d;
         auto dataset = GenDatasetWithIds(nb, dim, xb, ids);
+        if (centroids != nullptr) {
+            dataset->Set(knowhere::meta::CENTROIDS, centroids);
+        }
         fiu_do_on("VecIndexImpl.BuildAll.throw_knowhere_exception", throw knowhere::KnowhereException(""));
         fiu_do_on("VecIndexImpl.BuildAll.throw_std_exception", throw std::exception());
 
@@ -293,6 +305,12 @@ VecIndexImpl::SetBlacklist(faiss::ConcurrentBitsetPtr list) {
         raw_index->SetBlacklist(list);
     } else if (auto raw_index = std::dynamic_pointer_cast<knowhere::IDMAP>(index_)) {
         raw_index->SetBlacklist(list);
+    } else if (auto raw_index = std::dynamic_pointer_cast<knowhere::IndexHNSW>(index_)) {
+        raw_index->SetBlacklist(list);
+    } else if (auto raw_index = std::dynamic_pointer_cast<knowhere::NSG>(index_)) {
+        raw_index->SetBlacklist(list);
+    } else if (auto raw_index = std::dynamic_pointer_cast<knowhere::CPUSPTAGRNG>(index_)) {
+        raw_index->SetBlacklist(list);
     }
     return Status::OK();
 }
@@ -303,6 +321,12 @@ VecIndexImpl::GetBlacklist(faiss::ConcurrentBitsetPtr& list) {
         raw_index->GetBlacklist(list);
     } else if (auto raw_index = std::dynamic_pointer_cast<knowhere::IDMAP>(index_)) {
         raw_index->GetBlacklist(list);
+    } else if (auto raw_index = std::dynamic_pointer_cast<knowhere::IndexHNSW>(index_)) {
+        raw_index->GetBlacklist(list);
+    } else if (auto raw_index = std::dynamic_pointer_cast<knowhere::NSG>(index_)) {
+        raw_index->GetBlacklist(list);
+    } else if (auto raw_index = std::dynamic_pointer_cast<knowhere::CPUSPTAGRNG>(index_)) {
+        raw_index->GetBlacklist(list);
     }
     return Status::OK();
 }
@@ -370,6 +394,12 @@ BFIndex::BuildAll(const int64_t& nb, const float* xb, const int64_t* ids, const
     return Status::OK();
 }
 
+Status
+BFIndex::BuildAllWithCentroids(const int64_t& nb, const float* xb, const int64_t* ids, const Config& cfg,
+                               const float* centroids) {
+    return BuildAll(nb, xb, ids, cfg, 0, nullptr);
+}
+
 Status
 BFIndex::AddWithoutIds(const int64_t& nb, const float* xb, const Config& cfg) {
     auto ret_ds = std::make_shared<knowhere::Dataset>();
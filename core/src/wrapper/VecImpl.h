@@ -31,6 +31,10 @@ class VecIndexImpl : public VecIndex {
     BuildAll(const int64_t& nb, const float* xb, const int64_t* ids, const Config& cfg, const int64_t& nt,
              const float* xt) override;
 
+    Status
+    BuildAllWithCentroids(const int64_t& nb, const float* xb, const int64_t* ids, const Config& cfg,
+                          const float* centroids) override;
+
     VecIndexPtr
     CopyToGpu(const int64_t& device_id, const Config& cfg) override;
 
@@ -106,6 +110,10 @@ class BFIndex : public VecIndexImpl {
     BuildAll(const int64_t& nb, const float* xb, const int64_t* ids, const Config& cfg, const int64_t& nt,
              const float* xt) override;
 
+    Status
+    BuildAllWithCentroids(const int64_t& nb, const float* xb, const int64_t* ids, const Config& cfg,
+                          const float* centroids) override;
+
     const int64_t*
     GetRawIds();
 
@@ -70,6 +70,14 @@ class VecIndex : public cache::DataObj {
         return Status::OK();
     }
 
+    // build on coarse centroids (nlist * dim floats) trained beforehand, an ivf index then only assigns the vectors
+    // to the lists, indexes without a coarse quantizer ignore the centroids
+    virtual Status
+    BuildAllWithCentroids(const int64_t& nb, const float* xb, const int64_t* ids, const Config& cfg,
+                          const float* centroids) {
+        return BuildAll(nb, xb, ids, cfg);
+    }
+
     virtual Status
     Add(const int64_t& nb, const float* xb, const int64_t* ids, const Config& cfg = Config()) = 0;
 
@@ -64,6 +64,13 @@ IVFMixIndex::BuildAll(const int64_t& nb, const float* xb, const int64_t* ids, co
     return Status::OK();
 }
 
+Status
+IVFMixIndex::BuildAllWithCentroids(const int64_t& nb, const float* xb, const int64_t* ids, const Config& cfg,
+                                   const float* centroids) {
+    // the gpu index trains its own quantizer
+    return BuildAll(nb, xb, ids, cfg, 0, nullptr);
+}
+
 Status
 IVFMixIndex::Load(const knowhere::BinarySet& index_binary) {
     index_->Load(index_binary);
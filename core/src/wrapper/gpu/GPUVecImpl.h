@@ -31,6 +31,10 @@ class IVFMixIndex : public VecIndexImpl {
     BuildAll(const int64_t& nb, const float* xb, const int64_t* ids, const Config& cfg, const int64_t& nt,
              const float* xt) override;
 
+    Status
+    BuildAllWithCentroids(const int64_t& nb, const float* xb, const int64_t* ids, const Config& cfg,
+                          const float* centroids) override;
+
     Status
     Load(const knowhere::BinarySet& index_binary) override;
 };
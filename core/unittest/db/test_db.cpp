@@ -13,9 +13,13 @@
 #include <fiu-local.h>
 #include <gtest/gtest.h>
 
+#include <algorithm>
 #include <boost/filesystem.hpp>
+#include <map>
 #include <random>
+#include <set>
 #include <thread>
+#include <utility>
 
 #include "cache/CpuCacheMgr.h"
 #include "db/Constants.h"
@@ -371,11 +375,6 @@ TEST_F(DBTest, SEARCH_TEST) {
         stat = db_->QueryByFileID(dummy_context_, TABLE_NAME, file_ids, k, 10, xq, result_ids, result_distances);
         ASSERT_TRUE(stat.ok());
 
-        FIU_ENABLE_FIU("SqliteMetaImpl.FilesToSearch.throw_exception");
-        stat = db_->QueryByFileID(dummy_context_, TABLE_NAME, file_ids, k, 10, xq, result_ids, result_distances);
-        ASSERT_FALSE(stat.ok());
-        fiu_disable("SqliteMetaImpl.FilesToSearch.throw_exception");
-
         FIU_ENABLE_FIU("DBImpl.QueryByFileID.empty_files_array");
         stat = db_->QueryByFileID(dummy_context_, TABLE_NAME, file_ids, k, 10, xq, result_ids, result_distances);
         ASSERT_FALSE(stat.ok());
@@ -392,11 +391,6 @@ TEST_F(DBTest, SEARCH_TEST) {
         ASSERT_TRUE(stat.ok());
         stat = db_->Query(dummy_context_, TABLE_NAME, tags, k, 10, xq, result_ids, result_distances);
         ASSERT_TRUE(stat.ok());
-
-        FIU_ENABLE_FIU("SqliteMetaImpl.FilesToSearch.throw_exception");
-        stat = db_->Query(dummy_context_, TABLE_NAME, tags, k, 10, xq, result_ids, result_distances);
-        ASSERT_FALSE(stat.ok());
-        fiu_disable("SqliteMetaImpl.FilesToSearch.throw_exception");
     }
 #endif
 
@@ -465,10 +459,14 @@ TEST_F(DBTest, PRELOADTABLE_TEST) {
     int64_t cur_cache_usage = milvus::cache::CpuCacheMgr::GetInstance()->CacheUsage();
     ASSERT_TRUE(prev_cache_usage < cur_cache_usage);
 
-    FIU_ENABLE_FIU("SqliteMetaImpl.FilesToSearch.throw_exception");
-    stat = db_->PreloadTable(TABLE_NAME);
-    ASSERT_FALSE(stat.ok());
-    fiu_disable("SqliteMetaImpl.FilesToSearch.throw_exception");
+    std::map<std::string, milvus::engine::PreloadProgress> progress;
+    stat = db_->GetPreloadProgress(progress);
+    ASSERT_TRUE(stat.ok());
+    ASSERT_EQ(progress.count(TABLE_NAME), 1u);
+    ASSERT_TRUE(progress[TABLE_NAME].finished_);
+    ASSERT_GT(progress[TABLE_NAME].total_files_, 0);
+    ASSERT_EQ(progress[TABLE_NAME].loaded_files_, progress[TABLE_NAME].total_files_);
+    ASSERT_EQ(progress[TABLE_NAME].loaded_size_, progress[TABLE_NAME].total_size_);
 
     // create a partition
     stat = db_->CreatePartition(TABLE_NAME, "part0", "0");
@@ -492,6 +490,48 @@ TEST_F(DBTest, PRELOADTABLE_TEST) {
     fiu_disable("DBImpl.PreloadTable.engine_throw_exception");
 }
 
+TEST_F(DBTestBackendMeta, META_FAILURE_TEST) {
+    fiu_init(0);
+
+    milvus::engine::meta::TableSchema table_info = BuildTableSchema();
+    auto stat = db_->CreateTable(table_info);
+    ASSERT_TRUE(stat.ok());
+
+    uint64_t nb = 1000;
+    milvus::engine::VectorsData xb;
+    BuildVectors(nb, 0, xb);
+    stat = db_->InsertVectors(TABLE_NAME, "", xb);
+    ASSERT_TRUE(stat.ok());
+    stat = db_->Flush();
+    ASSERT_TRUE(stat.ok());
+
+    uint64_t nq = 10;
+    uint64_t k = 5;
+    milvus::engine::VectorsData xq;
+    BuildVectors(nq, 0, xq);
+    xq.id_array_.clear();
+
+    std::vector<std::string> tags;
+    std::vector<std::string> file_ids = {"1"};
+    milvus::engine::ResultIds result_ids;
+    milvus::engine::ResultDistances result_distances;
+    stat = db_->Query(dummy_context_, TABLE_NAME, tags, k, 10, xq, result_ids, result_distances);
+    ASSERT_TRUE(stat.ok());
+
+    // every read reaches the sqlite meta, so its failures are returned to the caller
+    FIU_ENABLE_FIU("SqliteMetaImpl.FilesToSearch.throw_exception");
+    stat = db_->Query(dummy_context_, TABLE_NAME, tags, k, 10, xq, result_ids, result_distances);
+    ASSERT_FALSE(stat.ok());
+    stat = db_->QueryByFileID(dummy_context_, TABLE_NAME, file_ids, k, 10, xq, result_ids, result_distances);
+    ASSERT_FALSE(stat.ok());
+    stat = db_->PreloadTable(TABLE_NAME);
+    ASSERT_FALSE(stat.ok());
+    fiu_disable("SqliteMetaImpl.FilesToSearch.throw_exception");
+
+    stat = db_->PreloadTable(TABLE_NAME);
+    ASSERT_TRUE(stat.ok());
+}
+
 TEST_F(DBTest, SHUTDOWN_TEST) {
     db_->Stop();
 
@@ -1277,6 +1317,91 @@ TEST_F(DBTest2, INSERT_DUPLICATE_ID) {
     ASSERT_TRUE(stat.ok());
 }
 
+TEST_F(DBTest2, SEGMENT_PRUNING_TEST) {
+    auto options = GetOptions();
+    options.segment_pruning_factor_ = 1;
+    options.merge_trigger_number_ = 100;  // keep the flushed segments apart
+    db_ = milvus::engine::DBFactory::Build(options);
+
+    // the vectors of each segment lie around their own axis, so queries close to an axis can skip the others
+    const int64_t dim = 16, segment_count = 4, segment_size = 100, nq = 2, k = 5;
+    std::mt19937 gen(42);
+    std::uniform_real_distribution<float> noise(0, 0.1);
+    std::vector<float> data(segment_count * segment_size * dim);
+    for (int64_t i = 0; i < segment_count * segment_size; ++i) {
+        for (int64_t d = 0; d < dim; ++d) {
+            data[i * dim + d] = noise(gen);
+        }
+        data[i * dim + i / segment_size] += 10;
+    }
+
+    milvus::engine::VectorsData xq;
+    xq.vector_count_ = nq;
+    xq.float_data_.resize(nq * dim);
+    for (int64_t j = 0; j < nq; ++j) {
+        for (int64_t d = 0; d < dim; ++d) {
+            xq.float_data_[j * dim + d] = noise(gen);
+        }
+        xq.float_data_[j * dim + j * 2] += 10;
+    }
+
+    for (auto metric_type : {milvus::engine::MetricType::L2, milvus::engine::MetricType::IP}) {
+        milvus::engine::meta::TableSchema table_schema;
+        table_schema.table_id_ = std::string(TABLE_NAME) + "_" + std::to_string((int)metric_type);
+        table_schema.dimension_ = dim;
+        table_schema.metric_type_ = (int)metric_type;
+        auto stat = db_->CreateTable(table_schema);
+        ASSERT_TRUE(stat.ok());
+
+        for (int64_t s = 0; s < segment_count; ++s) {
+            milvus::engine::VectorsData xb;
+            xb.vector_count_ = segment_size;
+            xb.float_data_.assign(data.begin() + s * segment_size * dim, data.begin() + (s + 1) * segment_size * dim);
+            for (int64_t i = 0; i < segment_size; ++i) {
+                xb.id_array_.push_back(s * segment_size + i);
+            }
+            stat = db_->InsertVectors(table_schema.table_id_, "", xb);
+            ASSERT_TRUE(stat.ok());
+            stat = db_->Flush(table_schema.table_id_);
+            ASSERT_TRUE(stat.ok());
+        }
+
+        // a segment which is searched gets loaded into the cache
+        milvus::cache::CpuCacheMgr::GetInstance()->ClearCache();
+        std::vector<std::string> tags;
+        milvus::engine::ResultIds result_ids;
+        milvus::engine::ResultDistances result_distances;
+        stat = db_->Query(dummy_context_, table_schema.table_id_, tags, k, 10, xq, result_ids, result_distances);
+        ASSERT_TRUE(stat.ok());
+        ASSERT_EQ(result_ids.size(), static_cast<size_t>(nq * k));
+        ASSERT_LT(milvus::cache::CpuCacheMgr::GetInstance()->ItemCount(), static_cast<uint64_t>(segment_count));
+
+        // the tables are brute force ones, an unpruned search returns the exact topk
+        for (int64_t j = 0; j < nq; ++j) {
+            const float* query = xq.float_data_.data() + j * dim;
+            std::vector<std::pair<float, int64_t>> distances;
+            for (int64_t i = 0; i < segment_count * segment_size; ++i) {
+                float distance = 0;
+                for (int64_t d = 0; d < dim; ++d) {
+                    float value = data[i * dim + d];
+                    distance += (metric_type == milvus::engine::MetricType::IP)
+                                    ? -value * query[d]
+                                    : (value - query[d]) * (value - query[d]);
+                }
+                distances.emplace_back(distance, i);
+            }
+            std::sort(distances.begin(), distances.end());
+
+            std::set<int64_t> expected, found;
+            for (int64_t r = 0; r < k; ++r) {
+                expected.insert(distances[r].second);
+                found.insert(result_ids[j * k + r]);
+            }
+            ASSERT_EQ(found, expected);
+        }
+    }
+}
+
 /*
 TEST_F(DBTest2, SEARCH_WITH_DIFFERENT_INDEX) {
     milvus::engine::meta::TableSchema table_info = BuildTableSchema();
@@ -425,14 +425,6 @@ TEST_F(MySqlDBTest, PARTITION_TEST) {
         ASSERT_TRUE(stat.ok());
         ASSERT_EQ(partition_schema_array.size(), PARTITION_COUNT + 1);
 
-        FIU_ENABLE_FIU("MySQLMetaImpl.ShowPartitions.null_connection");
-        stat = db_->ShowPartitions(table_name, partition_schema_array);
-        ASSERT_FALSE(stat.ok());
-
-        FIU_ENABLE_FIU("MySQLMetaImpl.ShowPartitions.throw_exception");
-        stat = db_->ShowPartitions(table_name, partition_schema_array);
-        ASSERT_FALSE(stat.ok());
-
         FIU_ENABLE_FIU("MySQLMetaImpl.DropTable.throw_exception");
         stat = db_->DropPartition(table_name + "_4");
         fiu_disable("MySQLMetaImpl.DropTable.throw_exception");
@@ -442,16 +434,6 @@ TEST_F(MySqlDBTest, PARTITION_TEST) {
     }
 
     {
-        FIU_ENABLE_FIU("MySQLMetaImpl.GetPartitionName.null_connection");
-        stat = db_->DropPartitionByTag(table_name, "1");
-        ASSERT_FALSE(stat.ok());
-        fiu_disable("MySQLMetaImpl.GetPartitionName.null_connection");
-
-        FIU_ENABLE_FIU("MySQLMetaImpl.GetPartitionName.throw_exception");
-        stat = db_->DropPartitionByTag(table_name, "1");
-        ASSERT_FALSE(stat.ok());
-        fiu_disable("MySQLMetaImpl.GetPartitionName.throw_exception");
-
         stat = db_->DropPartitionByTag(table_name, "1");
         ASSERT_TRUE(stat.ok());
 
@@ -482,3 +464,42 @@ TEST_F(MySqlDBTest, PARTITION_TEST) {
 }
 
 
+
+TEST_F(MySqlDBTestBackendMeta, PARTITION_META_FAILURE_TEST) {
+    milvus::engine::meta::TableSchema table_info = BuildTableSchema();
+    auto stat = db_->CreateTable(table_info);
+    ASSERT_TRUE(stat.ok());
+
+    std::string table_name = TABLE_NAME;
+    stat = db_->CreatePartition(table_name, table_name + "_1", "1");
+    ASSERT_TRUE(stat.ok());
+
+    std::vector<milvus::engine::meta::TableSchema> partition_schema_array;
+    stat = db_->ShowPartitions(table_name, partition_schema_array);
+    ASSERT_TRUE(stat.ok());
+    ASSERT_EQ(partition_schema_array.size(), 1u);
+
+    fiu_init(0);
+    FIU_ENABLE_FIU("MySQLMetaImpl.ShowPartitions.null_connection");
+    stat = db_->ShowPartitions(table_name, partition_schema_array);
+    ASSERT_FALSE(stat.ok());
+    fiu_disable("MySQLMetaImpl.ShowPartitions.null_connection");
+
+    FIU_ENABLE_FIU("MySQLMetaImpl.ShowPartitions.throw_exception");
+    stat = db_->ShowPartitions(table_name, partition_schema_array);
+    ASSERT_FALSE(stat.ok());
+    fiu_disable("MySQLMetaImpl.ShowPartitions.throw_exception");
+
+    FIU_ENABLE_FIU("MySQLMetaImpl.GetPartitionName.null_connection");
+    stat = db_->DropPartitionByTag(table_name, "1");
+    ASSERT_FALSE(stat.ok());
+    fiu_disable("MySQLMetaImpl.GetPartitionName.null_connection");
+
+    FIU_ENABLE_FIU("MySQLMetaImpl.GetPartitionName.throw_exception");
+    stat = db_->DropPartitionByTag(table_name, "1");
+    ASSERT_FALSE(stat.ok());
+    fiu_disable("MySQLMetaImpl.GetPartitionName.throw_exception");
+
+    stat = db_->DropPartitionByTag(table_name, "1");
+    ASSERT_TRUE(stat.ok());
+}
@@ -199,6 +199,61 @@ TEST_F(DeleteTest, delete_on_disk) {
     }
 }
 
+TEST_F(DeleteTest, delete_multiple_segments) {
+    milvus::engine::meta::TableSchema table_info = BuildTableSchema();
+    auto stat = db_->CreateTable(table_info);
+    ASSERT_TRUE(stat.ok());
+
+    // every flush creates a segment, deletes of all segments are applied concurrently by the next flush
+    int64_t segment_count = 5;
+    int64_t nb = 10000;
+    for (int64_t s = 0; s < segment_count; ++s) {
+        milvus::engine::VectorsData xb;
+        BuildVectors(nb, xb);
+        for (int64_t i = 0; i < nb; i++) {
+            xb.id_array_.push_back(s * nb + i);
+        }
+
+        stat = db_->InsertVectors(GetTableName(), "", xb);
+        ASSERT_TRUE(stat.ok());
+        stat = db_->Flush();
+        ASSERT_TRUE(stat.ok());
+    }
+
+    // delete the first 10 ids of every segment, and some ids that don't exist
+    std::vector<int64_t> ids_to_delete;
+    for (int64_t s = 0; s < segment_count; ++s) {
+        for (int64_t i = 0; i < 10; ++i) {
+            ids_to_delete.push_back(s * nb + i);
+        }
+    }
+    int64_t deleted_count = ids_to_delete.size();
+    ids_to_delete.push_back(segment_count * nb + 1);
+    ids_to_delete.push_back(segment_count * nb + 2);
+
+    stat = db_->DeleteVectors(GetTableName(), ids_to_delete);
+    ASSERT_TRUE(stat.ok());
+    stat = db_->Flush();
+    ASSERT_TRUE(stat.ok());
+
+    uint64_t row_count;
+    stat = db_->GetTableRowCount(GetTableName(), row_count);
+    ASSERT_TRUE(stat.ok());
+    ASSERT_EQ(row_count, segment_count * nb - deleted_count);
+
+    for (int64_t s = 0; s < segment_count; ++s) {
+        milvus::engine::VectorsData deleted_vector;
+        stat = db_->GetVectorByID(GetTableName(), s * nb, deleted_vector);
+        ASSERT_TRUE(stat.ok());
+        ASSERT_TRUE(deleted_vector.float_data_.empty());
+
+        milvus::engine::VectorsData vector;
+        stat = db_->GetVectorByID(GetTableName(), s * nb + 10, vector);
+        ASSERT_TRUE(stat.ok());
+        ASSERT_EQ(vector.float_data_.size(), TABLE_DIM);
+    }
+}
+
 TEST_F(DeleteTest, delete_with_index) {
     milvus::engine::meta::TableSchema table_info = BuildTableSchema();
     table_info.engine_type_ = (int32_t)milvus::engine::EngineType::FAISS_IVFFLAT;
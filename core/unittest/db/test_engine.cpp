@@ -11,10 +11,12 @@
 
 #include <gtest/gtest.h>
 #include <boost/filesystem.hpp>
+#include <random>
 #include <vector>
 
 #include "db/engine/EngineFactory.h"
 #include "db/engine/ExecutionEngineImpl.h"
+#include "db/engine/IVFCentroidsMgr.h"
 #include "db/utils.h"
 #include <fiu-local.h>
 #include <fiu-control.h>
@@ -226,3 +228,75 @@ TEST_F(EngineTest, ENGINE_IMPL_THROW_EXCEPTION_TEST) {
 
     fiu_disable("vecIndex.throw_read_exception");
 }
+
+TEST_F(EngineTest, SHARED_CENTROIDS_TEST) {
+    fiu_init(0);
+    uint16_t dimension = 64;
+    const int64_t nlist = 8;  // nlist matched by the adapter for 500 rows
+    const int64_t row_count = 500;
+    std::string centroids_path = "/tmp/milvus_test_centroids";
+    boost::filesystem::remove(centroids_path);
+
+    std::default_random_engine e;
+    std::uniform_real_distribution<float> u(0, 1);
+
+    std::vector<milvus::engine::ExecutionEnginePtr> segments;
+    for (int64_t s = 0; s < 2; ++s) {
+        auto engine_ptr = milvus::engine::EngineFactory::Build(dimension, "/tmp/milvus_index_" + std::to_string(s),
+                                                               milvus::engine::EngineType::FAISS_IVFFLAT,
+                                                               milvus::engine::MetricType::L2, nlist);
+        std::vector<float> data;
+        std::vector<int64_t> ids;
+        for (int64_t i = 0; i < row_count; i++) {
+            ids.push_back(s * row_count + i);
+            for (uint16_t k = 0; k < dimension; k++) {
+                data.push_back(u(e));
+            }
+        }
+        auto status = engine_ptr->AddWithIds((int64_t)ids.size(), data.data(), ids.data());
+        ASSERT_TRUE(status.ok());
+        segments.push_back(engine_ptr);
+    }
+
+#ifdef MILVUS_GPU_VERSION
+    FIU_ENABLE_FIU("ExecutionEngineImpl.CreatetVecIndex.gpu_res_disabled");
+#endif
+
+    // the first segment trains the centroids of the table and persists them
+    auto index_0 = segments[0]->BuildIndex("/tmp/milvus_index_ivf_0", milvus::engine::EngineType::FAISS_IVFFLAT,
+                                           centroids_path);
+    ASSERT_NE(index_0, nullptr);
+    ASSERT_TRUE(boost::filesystem::exists(centroids_path));
+
+    milvus::engine::IVFCentroidsPtr centroids;
+    auto status = milvus::engine::IVFCentroidsMgr::GetInstance().GetCentroids(centroids_path, dimension, nlist, 0,
+                                                                              nullptr, centroids);
+    ASSERT_TRUE(status.ok());
+    ASSERT_EQ(centroids->nlist_, nlist);
+    ASSERT_EQ(centroids->data_.size(), nlist * dimension);
+
+    // the second one only adds its vectors to the lists
+    auto index_1 = segments[1]->BuildIndex("/tmp/milvus_index_ivf_1", milvus::engine::EngineType::FAISS_IVFFLAT,
+                                           centroids_path);
+    ASSERT_NE(index_1, nullptr);
+    ASSERT_EQ(index_1->Count(), row_count);
+
+#ifdef MILVUS_GPU_VERSION
+    fiu_disable("ExecutionEngineImpl.CreatetVecIndex.gpu_res_disabled");
+#endif
+
+    // centroids read back from the file are the same
+    milvus::engine::IVFCentroidsMgr::GetInstance().EraseCentroids(centroids_path);
+    milvus::engine::IVFCentroidsPtr loaded;
+    status = milvus::engine::IVFCentroidsMgr::GetInstance().GetCentroids(centroids_path, dimension, nlist, 0,
+                                                                         nullptr, loaded);
+    ASSERT_TRUE(status.ok());
+    ASSERT_EQ(loaded->data_, centroids->data_);
+
+    // another nlist needs training, which fails without vectors
+    status = milvus::engine::IVFCentroidsMgr::GetInstance().GetCentroids(centroids_path, dimension, nlist * 2, 0,
+                                                                         nullptr, loaded);
+    ASSERT_FALSE(status.ok());
+
+    boost::filesystem::remove(centroids_path);
+}
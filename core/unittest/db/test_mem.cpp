@@ -9,12 +9,14 @@
 // is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
 // or implied. See the License for the specific language governing permissions and limitations under the License.
 
+#include <atomic>
 #include <boost/filesystem.hpp>
 #include <chrono>
 #include <cmath>
 #include <fstream>
 #include <iostream>
 #include <random>
+#include <set>
 #include <thread>
 #include <fiu-control.h>
 #include <fiu-local.h>
@@ -23,6 +25,7 @@
 #include "db/Constants.h"
 #include "db/Utils.h"
 #include "db/engine/EngineFactory.h"
+#include "db/insert/MemManagerImpl.h"
 #include "db/insert/MemTable.h"
 #include "db/insert/MemTableFile.h"
 #include "db/insert/VectorSource.h"
@@ -109,6 +112,48 @@ TEST_F(MemManagerTest, VECTOR_SOURCE_TEST) {
     ASSERT_EQ(vectors.id_array_.size(), 100);
 }
 
+TEST_F(MemManagerTest, VECTOR_SOURCE_BORROW_TEST) {
+    milvus::engine::meta::TableSchema table_schema = BuildTableSchema();
+    auto status = impl_->CreateTable(table_schema);
+    ASSERT_TRUE(status.ok());
+
+    milvus::engine::meta::TableFileSchema table_file_schema;
+    table_file_schema.table_id_ = GetTableName();
+    status = impl_->CreateTableFile(table_file_schema);
+    ASSERT_TRUE(status.ok());
+
+    int64_t n = 100;
+    milvus::engine::VectorsData vectors;
+    BuildVectors(n, vectors);
+    for (int64_t i = 0; i < n; i++) {
+        vectors.id_array_.push_back(i * 2);
+    }
+
+    // the source reads the caller's buffers directly
+    milvus::engine::VectorSource source(n, vectors.id_array_.data(), vectors.float_data_.data());
+
+    std::string directory;
+    milvus::engine::utils::GetParentPath(table_file_schema.location_, directory);
+    auto segment_writer_ptr = std::make_shared<milvus::segment::SegmentWriter>(directory);
+
+    size_t num_vectors_added;
+    status = source.Add(segment_writer_ptr, table_file_schema, 30, num_vectors_added);
+    ASSERT_TRUE(status.ok());
+    ASSERT_EQ(num_vectors_added, 30);
+    status = source.Add(segment_writer_ptr, table_file_schema, 100, num_vectors_added);
+    ASSERT_TRUE(status.ok());
+    ASSERT_EQ(num_vectors_added, 70);
+    ASSERT_TRUE(source.AllAdded());
+    ASSERT_EQ(source.GetVectorIds(), vectors.id_array_);
+
+    milvus::segment::SegmentPtr segment_ptr;
+    segment_writer_ptr->GetSegment(segment_ptr);
+    auto& data = segment_ptr->vectors_ptr_->GetData();
+    ASSERT_EQ(data.size(), vectors.float_data_.size() * sizeof(float));
+    ASSERT_EQ(memcmp(data.data(), vectors.float_data_.data(), data.size()), 0);
+    ASSERT_EQ(segment_ptr->vectors_ptr_->GetUids(), vectors.id_array_);
+}
+
 TEST_F(MemManagerTest, MEM_TABLE_FILE_TEST) {
     auto options = GetOptions();
     fiu_init(0);
@@ -228,6 +273,20 @@ TEST_F(MemManagerTest, MEM_TABLE_TEST) {
 
     status = mem_table.Serialize(0);
     ASSERT_TRUE(status.ok());
+    ASSERT_EQ(mem_table.GetTableFileCount(), 0);
+
+    // segments are written concurrently and registered in meta together
+    std::vector<int> file_types{milvus::engine::meta::TableFileSchema::FILE_TYPE::RAW,
+                                milvus::engine::meta::TableFileSchema::FILE_TYPE::TO_INDEX};
+    milvus::engine::meta::TableFilesSchema table_files;
+    status = impl_->FilesByType(GetTableName(), file_types, table_files);
+    ASSERT_TRUE(status.ok());
+    ASSERT_EQ(table_files.size(), expectedTableFileCount);
+    int64_t row_count = 0;
+    for (auto& file : table_files) {
+        row_count += file.row_count_;
+    }
+    ASSERT_EQ(row_count, n_100 + n_max + n_1G);
 
     milvus::engine::VectorsData vectors_10;
     BuildVectors(10, vectors_10);
@@ -238,10 +297,45 @@ TEST_F(MemManagerTest, MEM_TABLE_TEST) {
     status = mem_table.Add(source_10);
     ASSERT_TRUE(status.ok());
 
-    FIU_ENABLE_FIU("SqliteMetaImpl.UpdateTableFile.throw_exception");
+    FIU_ENABLE_FIU("SqliteMetaImpl.UpdateTableFiles.throw_exception");
     status = mem_table.Serialize(0);
     ASSERT_FALSE(status.ok());
-    fiu_disable("SqliteMetaImpl.UpdateTableFile.throw_exception");
+    fiu_disable("SqliteMetaImpl.UpdateTableFiles.throw_exception");
+}
+
+TEST_F(MemManagerTest, HOLD_FORCE_FLUSH_TEST) {
+    auto options = GetOptions();
+    options.insert_buffer_size_ = 1;
+
+    milvus::engine::meta::TableSchema table_schema = BuildTableSchema();
+    auto status = impl_->CreateTable(table_schema);
+    ASSERT_TRUE(status.ok());
+
+    int64_t n = 100;
+    milvus::engine::VectorsData vectors;
+    BuildVectors(n, vectors);
+    milvus::engine::IDNumbers ids(n);
+    for (int64_t i = 0; i < n; ++i) {
+        ids[i] = i;
+    }
+
+    milvus::engine::MemManagerImpl mem_mgr(impl_, options);
+    std::set<std::string> flushed_tables;
+
+    // the buffer exceeds its limit after the first insert, but nothing is flushed while held
+    mem_mgr.HoldForceFlush(true);
+    for (uint64_t lsn = 1; lsn <= 2; ++lsn) {
+        status = mem_mgr.InsertVectors(GetTableName(), n, ids.data(), TABLE_DIM, vectors.float_data_.data(), lsn,
+                                       flushed_tables);
+        ASSERT_TRUE(status.ok());
+        ASSERT_TRUE(flushed_tables.empty());
+    }
+
+    mem_mgr.HoldForceFlush(false);
+    status = mem_mgr.InsertVectors(GetTableName(), n, ids.data(), TABLE_DIM, vectors.float_data_.data(), 3,
+                                   flushed_tables);
+    ASSERT_TRUE(status.ok());
+    ASSERT_EQ(flushed_tables.count(GetTableName()), 1);
 }
 
 TEST_F(MemManagerTest2, SERIAL_INSERT_SEARCH_TEST) {
@@ -299,6 +393,52 @@ TEST_F(MemManagerTest2, SERIAL_INSERT_SEARCH_TEST) {
     }
 }
 
+TEST_F(MemManagerTest2, SEARCH_UNFLUSHED_TEST) {
+    milvus::engine::meta::TableSchema table_info = BuildTableSchema();
+    auto stat = db_->CreateTable(table_info);
+    ASSERT_TRUE(stat.ok());
+
+    int64_t nb = 1000;
+    milvus::engine::VectorsData xb;
+    BuildVectors(nb, xb);
+    for (int64_t i = 0; i < nb; i++) {
+        xb.id_array_.push_back(i);
+    }
+
+    stat = db_->InsertVectors(GetTableName(), "", xb);
+    ASSERT_TRUE(stat.ok());
+
+    int64_t index = nb / 2;
+    milvus::engine::VectorsData search;
+    search.vector_count_ = 1;
+    for (int64_t j = 0; j < TABLE_DIM; j++) {
+        search.float_data_.push_back(xb.float_data_[index * TABLE_DIM + j]);
+    }
+
+    int topk = 10, nprobe = 10;
+    std::vector<std::string> tags;
+    milvus::engine::ResultIds result_ids;
+    milvus::engine::ResultDistances result_distances;
+
+    // vectors in insert buffer are searchable before flush
+    stat = db_->Query(dummy_context_, GetTableName(), tags, topk, nprobe, search, result_ids, result_distances);
+    ASSERT_TRUE(stat.ok());
+    ASSERT_EQ(result_ids.size(), topk);
+    ASSERT_EQ(result_ids[0], index);
+    ASSERT_LT(result_distances[0], 1e-4);
+
+    // after flush, the same vectors are searched on disk only once
+    stat = db_->Flush();
+    ASSERT_TRUE(stat.ok());
+
+    stat = db_->Query(dummy_context_, GetTableName(), tags, topk, nprobe, search, result_ids, result_distances);
+    ASSERT_TRUE(stat.ok());
+    ASSERT_EQ(result_ids.size(), topk);
+    ASSERT_EQ(result_ids[0], index);
+    std::set<int64_t> unique_ids(result_ids.begin(), result_ids.end());
+    ASSERT_EQ(unique_ids.size(), result_ids.size());
+}
+
 TEST_F(MemManagerTest2, INSERT_TEST) {
     milvus::engine::meta::TableSchema table_info = BuildTableSchema();
     auto stat = db_->CreateTable(table_info);
@@ -360,6 +500,54 @@ TEST_F(MemManagerTest2, INSERT_BINARY_TEST) {
         ASSERT_TRUE(stat.ok());
     }
 }
+
+TEST_F(MemManagerTest2, CONCURRENT_TABLES_INSERT_TEST) {
+    const int64_t table_num = 4, insert_loop = 10, nb = 1000;
+    std::vector<std::string> table_ids;
+    for (int64_t t = 0; t < table_num; t++) {
+        milvus::engine::meta::TableSchema table_info = BuildTableSchema();
+        table_info.table_id_ = GetTableName() + "_" + std::to_string(t);
+        auto stat = db_->CreateTable(table_info);
+        ASSERT_TRUE(stat.ok());
+        table_ids.push_back(table_info.table_id_);
+    }
+
+    // every table is written by its own thread while one of the tables keeps being flushed
+    std::atomic<bool> inserting(true);
+    std::thread flusher([&]() {
+        while (inserting) {
+            ASSERT_TRUE(db_->Flush(table_ids[0]).ok());
+            std::this_thread::sleep_for(std::chrono::milliseconds(5));
+        }
+    });
+
+    std::vector<std::thread> writers;
+    for (auto& table_id : table_ids) {
+        writers.emplace_back([&, table_id]() {
+            for (int64_t i = 0; i < insert_loop; i++) {
+                milvus::engine::VectorsData xb;
+                BuildVectors(nb, xb);
+                for (int64_t j = 0; j < nb; j++) {
+                    xb.id_array_.push_back(i * nb + j);
+                }
+                ASSERT_TRUE(db_->InsertVectors(table_id, "", xb).ok());
+            }
+        });
+    }
+    for (auto& writer : writers) {
+        writer.join();
+    }
+    inserting = false;
+    flusher.join();
+
+    ASSERT_TRUE(db_->Flush().ok());
+    for (auto& table_id : table_ids) {
+        uint64_t row_count = 0;
+        ASSERT_TRUE(db_->GetTableRowCount(table_id, row_count).ok());
+        ASSERT_EQ(row_count, insert_loop * nb);
+    }
+}
+
 // TEST_F(MemManagerTest2, CONCURRENT_INSERT_SEARCH_TEST) {
 //    milvus::engine::meta::TableSchema table_info = BuildTableSchema();
 //    auto stat = db_->CreateTable(table_info);
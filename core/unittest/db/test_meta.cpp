@@ -12,6 +12,7 @@
 #include "db/Constants.h"
 #include "db/Utils.h"
 #include "db/meta/MetaConsts.h"
+#include "db/meta/SnapshotMetaImpl.h"
 #include "db/meta/SqliteMetaImpl.h"
 #include "db/utils.h"
 
@@ -700,3 +701,109 @@ TEST_F(MetaTest, LSN_TEST) {
     status = impl_->GetGlobalLastLSN(temp_lsb);
     ASSERT_EQ(temp_lsb, lsn);
 }
+
+TEST_F(MetaTest, SNAPSHOT_TEST) {
+    auto table_id = "snapshot_test";
+    auto options = GetOptions();
+    auto snapshot = std::make_shared<milvus::engine::meta::SnapshotMetaImpl>(options.meta_, impl_);
+
+    milvus::engine::meta::TableSchema table;
+    table.table_id_ = table_id;
+    auto status = snapshot->CreateTable(table);
+    ASSERT_TRUE(status.ok());
+
+    milvus::engine::meta::TableSchema table_info;
+    table_info.table_id_ = table_id;
+    status = snapshot->DescribeTable(table_info);
+    ASSERT_TRUE(status.ok());
+    ASSERT_EQ(table_info.id_, table.id_);
+
+    // reads are served from the snapshot, changes made behind its back are not seen
+    status = impl_->UpdateTableFlag(table_id, 1);
+    ASSERT_TRUE(status.ok());
+    status = snapshot->DescribeTable(table_info);
+    ASSERT_TRUE(status.ok());
+    ASSERT_EQ(table_info.flag_, 0);
+
+    // changes made through the snapshot are seen by the next read
+    status = snapshot->UpdateTableFlag(table_id, 2);
+    ASSERT_TRUE(status.ok());
+    status = snapshot->DescribeTable(table_info);
+    ASSERT_TRUE(status.ok());
+    ASSERT_EQ(table_info.flag_, 2);
+
+    bool has_table = false;
+    status = snapshot->HasTable(table_id, has_table);
+    ASSERT_TRUE(status.ok());
+    ASSERT_TRUE(has_table);
+
+    std::vector<milvus::engine::meta::TableSchema> partitions;
+    status = snapshot->ShowPartitions(table_id, partitions);
+    ASSERT_TRUE(status.ok());
+    ASSERT_TRUE(partitions.empty());
+
+    std::string partition_id = std::string(table_id) + "_p0";
+    status = snapshot->CreatePartition(table_id, partition_id, "p0", 0);
+    ASSERT_TRUE(status.ok());
+    status = snapshot->ShowPartitions(table_id, partitions);
+    ASSERT_TRUE(status.ok());
+    ASSERT_EQ(partitions.size(), 1u);
+
+    std::string partition_name;
+    status = snapshot->GetPartitionName(table_id, " p0 ", partition_name);
+    ASSERT_TRUE(status.ok());
+    ASSERT_EQ(partition_name, partition_id);
+    status = snapshot->GetPartitionName(table_id, "p1", partition_name);
+    ASSERT_FALSE(status.ok());
+
+    milvus::engine::meta::TableFileSchema table_file;
+    table_file.table_id_ = table_id;
+    status = snapshot->CreateTableFile(table_file);
+    ASSERT_TRUE(status.ok());
+
+    std::vector<size_t> ids;
+    milvus::engine::meta::TableFilesSchema files;
+    status = snapshot->FilesToSearch(table_id, ids, files);
+    ASSERT_TRUE(status.ok());
+    ASSERT_TRUE(files.empty());
+
+    table_file.file_type_ = milvus::engine::meta::TableFileSchema::RAW;
+    table_file.row_count_ = 1;
+    status = snapshot->UpdateTableFile(table_file);
+    ASSERT_TRUE(status.ok());
+    status = snapshot->FilesToSearch(table_id, ids, files);
+    ASSERT_TRUE(status.ok());
+    ASSERT_EQ(files.size(), 1u);
+    ASSERT_EQ(files[0].id_, table_file.id_);
+
+    ids = {table_file.id_ + 1};
+    status = snapshot->FilesToSearch(table_id, ids, files);
+    ASSERT_TRUE(status.ok());
+    ASSERT_TRUE(files.empty());
+    ids = {table_file.id_};
+    status = snapshot->FilesToSearch(table_id, ids, files);
+    ASSERT_TRUE(status.ok());
+    ASSERT_EQ(files.size(), 1u);
+
+    table_file.file_type_ = milvus::engine::meta::TableFileSchema::TO_DELETE;
+    status = snapshot->UpdateTableFile(table_file);
+    ASSERT_TRUE(status.ok());
+    status = snapshot->FilesToSearch(table_id, ids, files);
+    ASSERT_TRUE(status.ok());
+    ASSERT_TRUE(files.empty());
+
+    status = snapshot->DropPartition(partition_id);
+    ASSERT_TRUE(status.ok());
+    partitions.clear();
+    status = snapshot->ShowPartitions(table_id, partitions);
+    ASSERT_TRUE(status.ok());
+    ASSERT_TRUE(partitions.empty());
+
+    status = snapshot->DropTable(table_id);
+    ASSERT_TRUE(status.ok());
+    status = snapshot->DescribeTable(table_info);
+    ASSERT_FALSE(status.ok());
+    status = snapshot->HasTable(table_id, has_table);
+    ASSERT_TRUE(status.ok());
+    ASSERT_FALSE(has_table);
+}
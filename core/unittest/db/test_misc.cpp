@@ -11,16 +11,30 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <atomic>
 #include <boost/filesystem.hpp>
+#include <limits>
+#include <random>
 #include <thread>
 #include <vector>
 
+#include "cache/SegmentCacheMgr.h"
 #include "db/IndexFailedChecker.h"
 #include "db/OngoingFileChecker.h"
 #include "db/Options.h"
+#include "db/QueryCombiner.h"
 #include "db/Utils.h"
 #include "db/engine/EngineFactory.h"
 #include "db/meta/SqliteMetaImpl.h"
+#include "codecs/default/DefaultDeletedDocsFormat.h"
+#include "codecs/default/DefaultIdBloomFilterFormat.h"
+#include "codecs/default/DefaultVectorsFormat.h"
+#include "codecs/default/DefaultVectorsSummaryFormat.h"
+#include "segment/IdIndex.h"
+#include "segment/Uids.h"
+#include "segment/Vectors.h"
+#include "segment/VectorsSummary.h"
 #include "utils/Exception.h"
 #include "utils/Status.h"
 
@@ -28,6 +42,29 @@
 #include <fiu-control.h>
 #include "db/utils.h"
 
+namespace {
+
+// a scratch segment directory for the codec tests, removed even when an assertion fails
+class CodecTest : public ::testing::Test {
+ protected:
+    void
+    SetUp() override {
+        boost::filesystem::remove_all(dir_path_);
+        boost::filesystem::create_directories(dir_path_);
+        directory_ptr_ = std::make_shared<milvus::store::Directory>(dir_path_);
+    }
+
+    void
+    TearDown() override {
+        boost::filesystem::remove_all(dir_path_);
+    }
+
+    const std::string dir_path_ = "/tmp/milvus_test/codec";
+    milvus::store::DirectoryPtr directory_ptr_;
+};
+
+}  // namespace
+
 TEST(DBMiscTest, EXCEPTION_TEST) {
     milvus::Exception ex1(100, "error");
     std::string what = ex1.what();
@@ -161,6 +198,46 @@ TEST(DBMiscTest, UTILS_TEST) {
     status = milvus::engine::utils::DeleteSegment(options, file);
 }
 
+TEST(DBMiscTest, SEGMENT_CACHE_ERASE_TEST) {
+    milvus::engine::DBMetaOptions options;
+    options.path_ = "/tmp/milvus_test/main";
+
+    const std::string TABLE_NAME = "test_segment_cache";
+    auto segment_mgr = milvus::cache::SegmentCacheMgr::GetInstance();
+
+    auto cache_segment = [&](const std::string& segment_id) {
+        milvus::engine::meta::TableFileSchema file;
+        file.table_id_ = TABLE_NAME;
+        file.segment_id_ = segment_id;
+        file.file_id_ = segment_id;
+        auto status = milvus::engine::utils::CreateTableFilePath(options, file);
+        EXPECT_TRUE(status.ok());
+
+        std::string segment_dir;
+        milvus::engine::utils::GetParentPath(file.location_, segment_dir);
+        std::string key = milvus::cache::SegmentCacheMgr::UidsKey(segment_dir);
+        std::vector<milvus::segment::doc_id_t> uids(10, 1);
+        segment_mgr->InsertComponent(key, std::make_shared<milvus::segment::Uids>(uids), segment_mgr->Epoch());
+        EXPECT_TRUE(segment_mgr->ItemExists(key));
+        return key;
+    };
+
+    // dropping a table erases the components of its segments, the folders are removed later
+    auto key_1 = cache_segment("segment_1");
+    auto key_2 = cache_segment("segment_2");
+    milvus::engine::utils::EraseTableSegmentCache(options, TABLE_NAME);
+    ASSERT_FALSE(segment_mgr->ItemExists(key_1));
+    ASSERT_FALSE(segment_mgr->ItemExists(key_2));
+
+    // so does removing the table folder
+    key_1 = cache_segment("segment_1");
+    auto status = milvus::engine::utils::DeleteTablePath(options, TABLE_NAME);
+    ASSERT_TRUE(status.ok());
+    ASSERT_FALSE(segment_mgr->ItemExists(key_1));
+
+    boost::filesystem::remove_all("/tmp/milvus_test");
+}
+
 TEST(DBMiscTest, CHECKER_TEST) {
     {
         milvus::engine::IndexFailedChecker checker;
@@ -218,3 +295,379 @@ TEST(DBMiscTest, CHECKER_TEST) {
         ASSERT_FALSE(checker.IsIgnored(schema));
     }
 }
+
+TEST(DBMiscTest, QUERY_COMBINER_TEST) {
+    const int64_t dim = 4;
+    const int64_t topk = 2;
+
+    // fake search: every result id is the first element of its query vector
+    std::atomic<int64_t> call_count(0);
+    auto query_func = [&](const milvus::engine::VectorsData& vectors, milvus::engine::ResultIds& result_ids,
+                          milvus::engine::ResultDistances& result_distances) {
+        call_count++;
+        for (uint64_t i = 0; i < vectors.vector_count_; ++i) {
+            for (int64_t j = 0; j < topk; ++j) {
+                result_ids.push_back(static_cast<int64_t>(vectors.float_data_[i * dim]));
+                result_distances.push_back(static_cast<float>(j));
+            }
+        }
+        return milvus::Status::OK();
+    };
+
+    auto make_vectors = [&](int64_t value, uint64_t nq) {
+        milvus::engine::VectorsData vectors;
+        vectors.vector_count_ = nq;
+        vectors.float_data_.resize(nq * dim, static_cast<float>(value));
+        return vectors;
+    };
+
+    {
+        // combining disabled, every query is executed by itself
+        milvus::engine::QueryCombiner combiner(0, 100);
+        auto vectors = make_vectors(1, 2);
+        milvus::engine::ResultIds result_ids;
+        milvus::engine::ResultDistances result_distances;
+        auto status = combiner.Query("key", vectors, query_func, result_ids, result_distances);
+        ASSERT_TRUE(status.ok());
+        ASSERT_EQ(result_ids.size(), 2 * topk);
+        ASSERT_EQ(call_count, 1);
+    }
+
+    {
+        call_count = 0;
+        milvus::engine::QueryCombiner combiner(200000, 100);
+        const int64_t thread_count = 8;
+        std::vector<std::thread> threads;
+        std::vector<milvus::engine::ResultIds> all_ids(thread_count);
+        std::vector<milvus::Status> all_status(thread_count);
+        for (int64_t i = 0; i < thread_count; ++i) {
+            threads.emplace_back([&, i]() {
+                auto vectors = make_vectors(i, i % 3 + 1);
+                milvus::engine::ResultDistances result_distances;
+                all_status[i] = combiner.Query("key", vectors, query_func, all_ids[i], result_distances);
+            });
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+
+        ASSERT_LT(call_count, thread_count);
+        for (int64_t i = 0; i < thread_count; ++i) {
+            ASSERT_TRUE(all_status[i].ok());
+            ASSERT_EQ(all_ids[i].size(), (i % 3 + 1) * topk);
+            for (auto id : all_ids[i]) {
+                ASSERT_EQ(id, i);
+            }
+        }
+    }
+
+    {
+        // a failed batch is reported to all of its queries
+        milvus::engine::QueryCombiner combiner(1000, 100);
+        auto fail_func = [](const milvus::engine::VectorsData& vectors, milvus::engine::ResultIds& result_ids,
+                            milvus::engine::ResultDistances& result_distances) {
+            return milvus::Status(milvus::DB_ERROR, "fail");
+        };
+        auto vectors = make_vectors(1, 1);
+        milvus::engine::ResultIds result_ids;
+        milvus::engine::ResultDistances result_distances;
+        auto status = combiner.Query("key", vectors, fail_func, result_ids, result_distances);
+        ASSERT_FALSE(status.ok());
+    }
+}
+
+TEST(DBMiscTest, ID_INDEX_TEST) {
+    std::vector<milvus::segment::doc_id_t> uids;
+    for (int64_t i = 0; i < 10000; ++i) {
+        uids.push_back(i * 7 + 100);
+    }
+    uids.push_back(100);  // duplicated uid, the first offset wins
+
+    milvus::segment::IdIndex id_index(uids);
+    ASSERT_EQ(id_index.Count(), 10000);
+    ASSERT_GT(id_index.Size(), 0);
+
+    milvus::segment::offset_t offset;
+    for (int64_t i = 0; i < 10000; ++i) {
+        ASSERT_TRUE(id_index.Get(i * 7 + 100, offset));
+        ASSERT_EQ(offset, i);
+    }
+    ASSERT_FALSE(id_index.Get(101, offset));
+    ASSERT_FALSE(id_index.Get(-1, offset));
+
+    // deleted offsets are not indexed, a later live duplicate takes over
+    std::vector<milvus::segment::offset_t> deleted = {0, 5, 20000};
+    milvus::segment::IdIndex live_index(uids, deleted);
+    ASSERT_EQ(live_index.Count(), 9999);
+    ASSERT_TRUE(live_index.Get(100, offset));
+    ASSERT_EQ(offset, 10000);
+    ASSERT_FALSE(live_index.Get(5 * 7 + 100, offset));
+    ASSERT_TRUE(live_index.Get(6 * 7 + 100, offset));
+    ASSERT_EQ(offset, 6);
+
+    std::vector<milvus::segment::doc_id_t> empty_uids;
+    milvus::segment::IdIndex empty_index(empty_uids);
+    ASSERT_EQ(empty_index.Count(), 0);
+    ASSERT_FALSE(empty_index.Get(0, offset));
+}
+
+TEST(DBMiscTest, VECTORS_VIEW_TEST) {
+    const size_t code_length = 4;
+    std::vector<uint8_t> data(2 * code_length, 1);
+    std::vector<milvus::segment::doc_id_t> uids = {0, 1};
+    milvus::segment::Vectors vectors(data, uids, "raw");
+
+    auto view = vectors.GetView();
+    ASSERT_EQ(view.count_, 2);
+
+    // appends beyond the capacity and erases both leave the viewed rows unchanged
+    for (milvus::segment::doc_id_t i = 2; i < 1000; ++i) {
+        std::vector<uint8_t> row(code_length, 2);
+        vectors.AddData(row.data(), row.size());
+        vectors.AddUids(&i, 1);
+    }
+    vectors.Erase(0);
+    std::vector<int32_t> offsets = {0, 1, 2};
+    vectors.Erase(offsets);
+    ASSERT_EQ(vectors.GetCount(), 996);
+    ASSERT_EQ(vectors.GetUids()[0], 4);
+
+    ASSERT_EQ(view.uids_[0], 0);
+    ASSERT_EQ(view.uids_[1], 1);
+    ASSERT_TRUE(std::all_of(view.data_, view.data_ + 2 * code_length, [](uint8_t b) { return b == 1; }));
+
+    // unshared buffers are still changed in place
+    view = milvus::segment::Vectors::View();
+    auto& current_uids = vectors.GetUids();
+    vectors.Erase(0);
+    ASSERT_EQ(&current_uids, &vectors.GetUids());
+    ASSERT_EQ(current_uids[0], 5);
+}
+
+TEST_F(CodecTest, MAPPED_VECTORS_TEST) {
+    std::vector<float> floats;
+    std::vector<milvus::segment::doc_id_t> uids;
+    for (int64_t i = 0; i < 1000; ++i) {
+        floats.push_back(i * 0.5f);
+        uids.push_back(i);
+    }
+    std::vector<uint8_t> data(floats.size() * sizeof(float));
+    memcpy(data.data(), floats.data(), data.size());
+    auto vectors = std::make_shared<milvus::segment::Vectors>(data, uids, "raw");
+
+    milvus::codec::DefaultVectorsFormat format;
+    format.write(directory_ptr_, vectors);
+
+    milvus::segment::MappedVectorsPtr mapped_vectors;
+    format.read_vectors_mapped(directory_ptr_, mapped_vectors);
+    ASSERT_NE(mapped_vectors, nullptr);
+    ASSERT_EQ(mapped_vectors->GetNumBytes(), data.size());
+    ASSERT_EQ(memcmp(mapped_vectors->GetData(), data.data(), data.size()), 0);
+    mapped_vectors->ReleasePageCache();
+    ASSERT_EQ(reinterpret_cast<const float*>(mapped_vectors->GetData())[999], 999 * 0.5f);
+
+    auto empty_directory_ptr = std::make_shared<milvus::store::Directory>(dir_path_ + "/empty");
+    empty_directory_ptr->Create();
+    ASSERT_THROW(format.read_vectors_mapped(empty_directory_ptr, mapped_vectors), milvus::Exception);
+}
+
+TEST_F(CodecTest, DELETED_DOCS_FORMAT_TEST) {
+    // a legacy file of appended offsets with duplicates
+    std::vector<milvus::segment::offset_t> legacy = {7, 3, 7, 70000};
+    FILE* file = fopen((dir_path_ + "/deleted_docs").c_str(), "wb");
+    ASSERT_NE(file, nullptr);
+    fwrite(legacy.data(), sizeof(milvus::segment::offset_t), legacy.size(), file);
+    fclose(file);
+
+    milvus::codec::DefaultDeletedDocsFormat format;
+    milvus::segment::DeletedDocsPtr deleted_docs;
+    format.read(directory_ptr_, deleted_docs);
+    std::vector<milvus::segment::offset_t> expected = {3, 7, 70000};
+    ASSERT_EQ(deleted_docs->GetDeletedDocs(), expected);
+
+    // a dense range becomes a bitmap container, the legacy offsets are kept
+    auto new_docs = std::make_shared<milvus::segment::DeletedDocs>();
+    for (milvus::segment::offset_t i = 0; i < 10000; i += 2) {
+        new_docs->AddDeletedDoc(i);
+        expected.push_back(i);
+    }
+    new_docs->AddDeletedDoc(3);
+    format.write(directory_ptr_, new_docs);
+    std::sort(expected.begin(), expected.end());
+    expected.erase(std::unique(expected.begin(), expected.end()), expected.end());
+
+    format.read(directory_ptr_, deleted_docs);
+    ASSERT_EQ(deleted_docs->GetDeletedDocs(), expected);
+    ASSERT_LT(boost::filesystem::file_size(dir_path_ + "/deleted_docs"), expected.size() * sizeof(int32_t));
+
+    // an empty write keeps the offsets
+    format.write(directory_ptr_, std::make_shared<milvus::segment::DeletedDocs>());
+    format.read(directory_ptr_, deleted_docs);
+    ASSERT_EQ(deleted_docs->GetDeletedDocs(), expected);
+}
+
+TEST_F(CodecTest, BLOOM_FILTER_TEST) {
+    int64_t count = 100000;
+    milvus::codec::DefaultIdBloomFilterFormat format;
+    milvus::segment::IdBloomFilterPtr bloom_filter;
+    format.create(count, bloom_filter);
+    std::vector<milvus::segment::doc_id_t> uids;
+    for (int64_t i = 0; i < count; ++i) {
+        uids.push_back(i * 3);
+        bloom_filter->Add(i * 3);
+    }
+
+    auto false_positives = [](const milvus::segment::IdBloomFilterPtr& filter, int64_t count) {
+        int64_t positives = 0;
+        for (int64_t i = 0; i < count; ++i) {
+            positives += filter->Check(i * 3 + 1) ? 1 : 0;
+        }
+        return positives;
+    };
+
+    // no false negative, and about 0.5% false positive at 12 bits per id
+    for (auto uid : uids) {
+        ASSERT_TRUE(bloom_filter->Check(uid));
+    }
+    auto positives = false_positives(bloom_filter, count);
+    ASSERT_LT(positives, count / 50);
+
+    std::vector<milvus::segment::doc_id_t> ids = {0, 1, 3, 4, 299997, 299998};
+    std::vector<uint8_t> results;
+    bloom_filter->Check(ids.data(), ids.size(), results);
+    ASSERT_EQ(results.size(), ids.size());
+    for (size_t i = 0; i < ids.size(); ++i) {
+        ASSERT_EQ(results[i] != 0, bloom_filter->Check(ids[i]));
+    }
+
+    format.write(directory_ptr_, bloom_filter);
+    milvus::segment::IdBloomFilterPtr read_filter;
+    format.read(directory_ptr_, read_filter);
+    ASSERT_EQ(read_filter->GetBlocks(), bloom_filter->GetBlocks());
+
+    // a filter of the old format is rebuilt from the uids of the segment
+    std::vector<uint8_t> data(count * sizeof(float), 0);
+    auto vectors = std::make_shared<milvus::segment::Vectors>(data, uids, "raw");
+    milvus::codec::DefaultVectorsFormat vectors_format;
+    vectors_format.write(directory_ptr_, vectors);
+    FILE* file = fopen((dir_path_ + "/bloom_filter").c_str(), "wb");
+    ASSERT_NE(file, nullptr);
+    fwrite(data.data(), 1, 1024, file);
+    fclose(file);
+
+    format.read(directory_ptr_, read_filter);
+    for (auto uid : uids) {
+        ASSERT_TRUE(read_filter->Check(uid));
+    }
+    ASSERT_EQ(false_positives(read_filter, count), positives);
+}
+
+TEST_F(CodecTest, CODEC_CONCURRENT_READ_TEST) {
+    int64_t count = 10000;
+    std::vector<uint8_t> data(count * sizeof(int64_t));
+    std::vector<milvus::segment::doc_id_t> uids;
+    for (int64_t i = 0; i < count; ++i) {
+        memcpy(data.data() + i * sizeof(int64_t), &i, sizeof(int64_t));
+        uids.push_back(i * 2);
+    }
+    auto vectors = std::make_shared<milvus::segment::Vectors>(data, uids, "raw");
+    milvus::codec::DefaultVectorsFormat format;
+    format.write(directory_ptr_, vectors);
+
+    // range reads of many threads through one format object
+    std::atomic<int64_t> mismatch(0);
+    std::vector<std::thread> threads;
+    for (int64_t t = 0; t < 8; ++t) {
+        threads.emplace_back([&, t]() {
+            for (int64_t i = t; i < count; i += 8) {
+                std::vector<uint8_t> raw_vector;
+                format.read_vectors(directory_ptr_, i * sizeof(int64_t), sizeof(int64_t), raw_vector);
+                int64_t value;
+                memcpy(&value, raw_vector.data(), sizeof(int64_t));
+                if (value != i) {
+                    ++mismatch;
+                }
+                if (i % 1000 == t) {
+                    std::vector<milvus::segment::doc_id_t> read_uids;
+                    format.read_uids(directory_ptr_, read_uids);
+                    if (read_uids != uids) {
+                        ++mismatch;
+                    }
+                }
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    ASSERT_EQ(mismatch, 0);
+
+    std::vector<uint8_t> raw_vector;
+    ASSERT_THROW(format.read_vectors(directory_ptr_, count * sizeof(int64_t), sizeof(int64_t), raw_vector),
+                 milvus::Exception);
+}
+
+TEST_F(CodecTest, VECTORS_SUMMARY_TEST) {
+    const int64_t dimension = 8;
+    const int64_t count = 2000;
+    std::default_random_engine engine(42);
+    std::uniform_real_distribution<float> distribution(-1.0, 1.0);
+    std::vector<float> vectors(count * dimension);
+    for (int64_t i = 0; i < count; ++i) {
+        // two far apart groups
+        float offset = (i % 2 == 0) ? 10.0f : -10.0f;
+        for (int64_t d = 0; d < dimension; ++d) {
+            vectors[i * dimension + d] = offset + distribution(engine);
+        }
+    }
+
+    auto summary = milvus::segment::VectorsSummary::Build(vectors.data(), count, dimension);
+    ASSERT_FALSE(summary->Empty());
+    ASSERT_EQ(summary->GetRadiuses().size(), static_cast<size_t>(milvus::segment::VectorsSummary::MAX_CLUSTERS));
+
+    // at factor 1 the bound never beats a true distance
+    for (int64_t j = 0; j < 20; ++j) {
+        std::vector<float> query(dimension);
+        for (auto& value : query) {
+            value = distribution(engine) * 20;
+        }
+
+        float min_l2 = std::numeric_limits<float>::max();
+        float max_ip = std::numeric_limits<float>::lowest();
+        for (int64_t i = 0; i < count; ++i) {
+            float l2 = 0, ip = 0;
+            for (int64_t d = 0; d < dimension; ++d) {
+                float diff = query[d] - vectors[i * dimension + d];
+                l2 += diff * diff;
+                ip += query[d] * vectors[i * dimension + d];
+            }
+            min_l2 = std::min(min_l2, l2);
+            max_ip = std::max(max_ip, ip);
+        }
+        ASSERT_LE(summary->BestDistance(query.data(), false, 1.0f), min_l2);
+        ASSERT_GE(summary->BestDistance(query.data(), true, 1.0f), max_ip);
+        ASSERT_GE(summary->BestDistance(query.data(), false, 0.5f), summary->BestDistance(query.data(), false, 1.0f));
+    }
+
+    // a few vectors are their own centroids
+    auto small = milvus::segment::VectorsSummary::Build(vectors.data(), 3, dimension);
+    ASSERT_EQ(small->GetRadiuses().size(), 3u);
+    ASSERT_FLOAT_EQ(small->BestDistance(vectors.data() + dimension, false, 1.0f), 0.0f);
+
+    // a segment written without a summary can't be pruned
+    milvus::codec::DefaultVectorsSummaryFormat format;
+    milvus::segment::VectorsSummaryPtr read_summary;
+    format.read(directory_ptr_, read_summary);
+    ASSERT_TRUE(read_summary->Empty());
+    ASSERT_EQ(read_summary->BestDistance(vectors.data(), false, 1.0f), 0.0f);
+
+    format.write(directory_ptr_, summary);
+    format.read(directory_ptr_, read_summary);
+    ASSERT_EQ(read_summary->GetDimension(), dimension);
+    ASSERT_EQ(read_summary->GetCentroids(), summary->GetCentroids());
+    ASSERT_EQ(read_summary->GetRadiuses(), summary->GetRadiuses());
+
+    // a truncated file is rejected
+    boost::filesystem::resize_file(dir_path_ + "/vectors_summary", 20);
+    ASSERT_THROW(format.read(directory_ptr_, read_summary), milvus::Exception);
+}
@@ -400,6 +400,61 @@ TEST_F(GetVectorByIdTest, with_delete) {
     }
 }
 
+TEST_F(GetVectorByIdTest, batch) {
+    milvus::engine::meta::TableSchema table_info = BuildTableSchema();
+    auto stat = db_->CreateTable(table_info);
+    ASSERT_TRUE(stat.ok());
+
+    int64_t nb = 100000;
+    milvus::engine::VectorsData xb;
+    BuildVectors(nb, xb);
+
+    for (int64_t i = 0; i < nb; i++) {
+        xb.id_array_.push_back(i);
+    }
+
+    stat = db_->InsertVectors(GetTableName(), "", xb);
+    ASSERT_TRUE(stat.ok());
+
+    stat = db_->Flush();
+    ASSERT_TRUE(stat.ok());
+
+    milvus::engine::IDNumbers ids_to_delete = {3, 5};
+    stat = db_->DeleteVectors(GetTableName(), ids_to_delete);
+    ASSERT_TRUE(stat.ok());
+
+    stat = db_->Flush();
+    ASSERT_TRUE(stat.ok());
+
+    // existing, deleted, missing and duplicated ids in one request
+    milvus::engine::IDNumbers ids = {1, 3, nb - 1, 5, nb + 10, 1};
+    std::vector<milvus::engine::VectorsData> vectors;
+    stat = db_->GetVectorsByID(GetTableName(), ids, vectors);
+    ASSERT_TRUE(stat.ok());
+    ASSERT_EQ(vectors.size(), ids.size());
+
+    std::vector<bool> expect_found = {true, false, true, false, false, true};
+    for (size_t i = 0; i < ids.size(); ++i) {
+        if (!expect_found[i]) {
+            ASSERT_EQ(vectors[i].vector_count_, 0);
+            ASSERT_TRUE(vectors[i].float_data_.empty());
+            continue;
+        }
+
+        ASSERT_EQ(vectors[i].vector_count_, 1);
+        ASSERT_EQ(vectors[i].float_data_.size(), TABLE_DIM);
+        for (int64_t d = 0; d < TABLE_DIM; ++d) {
+            ASSERT_FLOAT_EQ(vectors[i].float_data_[d], xb.float_data_[ids[i] * TABLE_DIM + d]);
+        }
+    }
+
+    // the single id api returns the same vector
+    milvus::engine::VectorsData vector;
+    stat = db_->GetVectorByID(GetTableName(), nb - 1, vector);
+    ASSERT_TRUE(stat.ok());
+    ASSERT_EQ(vector.float_data_, vectors[2].float_data_);
+}
+
 TEST_F(SearchByIdTest, BINARY) {
     milvus::engine::meta::TableSchema table_info;
     table_info.dimension_ = TABLE_DIM;
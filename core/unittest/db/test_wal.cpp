@@ -182,14 +182,18 @@ TEST(WalTest, BUFFER_INIT_TEST) {
 
     FILE* fi = nullptr;
     char buff[128];
+    memset(buff, 0, sizeof(buff));
+    milvus::engine::wal::MXLogFileHeader header{milvus::engine::wal::MXLogFileMagic,
+                                                milvus::engine::wal::MXLogFileVersion};
+    memcpy(buff, &header, sizeof(header));
     milvus::engine::wal::MXLogBuffer buffer(WAL_GTEST_PATH, 32);
 
-    // start_lsn == end_lsn, start_lsn == 0
+    // start_lsn == end_lsn, start_lsn == 0, records of the new file follow its header
     ASSERT_TRUE(buffer.Init(0, 0));
     ASSERT_EQ(buffer.mxlog_buffer_reader_.file_no, 0);
-    ASSERT_EQ(buffer.mxlog_buffer_reader_.buf_offset, 0);
+    ASSERT_EQ(buffer.mxlog_buffer_reader_.buf_offset, milvus::engine::wal::SizeOfMXLogFileHeader);
     ASSERT_EQ(buffer.mxlog_buffer_writer_.file_no, 0);
-    ASSERT_EQ(buffer.mxlog_buffer_writer_.buf_offset, 0);
+    ASSERT_EQ(buffer.mxlog_buffer_writer_.buf_offset, milvus::engine::wal::SizeOfMXLogFileHeader);
     ASSERT_EQ(buffer.file_no_from_, 0);
 
     // start_lsn == end_lsn, start_lsn != 0
@@ -198,9 +202,9 @@ TEST(WalTest, BUFFER_INIT_TEST) {
     uint64_t lsn = (uint64_t)file_no << 32 | buf_off;
     ASSERT_TRUE(buffer.Init(lsn, lsn));
     ASSERT_EQ(buffer.mxlog_buffer_reader_.file_no, file_no + 1);
-    ASSERT_EQ(buffer.mxlog_buffer_reader_.buf_offset, 0);
+    ASSERT_EQ(buffer.mxlog_buffer_reader_.buf_offset, milvus::engine::wal::SizeOfMXLogFileHeader);
     ASSERT_EQ(buffer.mxlog_buffer_writer_.file_no, file_no + 1);
-    ASSERT_EQ(buffer.mxlog_buffer_writer_.buf_offset, 0);
+    ASSERT_EQ(buffer.mxlog_buffer_writer_.buf_offset, milvus::engine::wal::SizeOfMXLogFileHeader);
     ASSERT_EQ(buffer.file_no_from_, file_no + 1);
 
     // start_lsn != end_lsn, start_file == end_file
@@ -214,11 +218,11 @@ TEST(WalTest, BUFFER_INIT_TEST) {
     ASSERT_FALSE(buffer.Init(start_lsn, end_lsn)); // file not exist
     fi = fopen(WAL_GTEST_PATH "3.wal", "w");
     fclose(fi);
-    ASSERT_FALSE(buffer.Init(start_lsn, end_lsn));  // file size zero
+    ASSERT_TRUE(buffer.Init(start_lsn, end_lsn));  // file size zero, a torn tail is caught by the record checksum
     fi = fopen(WAL_GTEST_PATH "3.wal", "w");
     fwrite(buff, 1, end_buf_off - 1, fi);
     fclose(fi);
-    ASSERT_FALSE(buffer.Init(start_lsn, end_lsn));  // file size error
+    ASSERT_TRUE(buffer.Init(start_lsn, end_lsn));  // file size short, a torn tail too
     fi = fopen(WAL_GTEST_PATH "3.wal", "w");
     fwrite(buff, 1, end_buf_off, fi);
     fclose(fi);
@@ -229,6 +233,12 @@ TEST(WalTest, BUFFER_INIT_TEST) {
     ASSERT_EQ(buffer.mxlog_buffer_writer_.buf_offset, end_buf_off);
     ASSERT_EQ(buffer.file_no_from_, start_file_no);
 
+    // a file of the format without record checksums is refused, not taken for a torn tail
+    fi = fopen(WAL_GTEST_PATH "3.wal", "r+");
+    fputc(0, fi);
+    fclose(fi);
+    ASSERT_FALSE(buffer.Init(start_lsn, end_lsn));
+
     // start_lsn != end_lsn, start_file != end_file
     start_file_no = 4;
     start_buf_off = 32;
@@ -243,7 +253,7 @@ TEST(WalTest, BUFFER_INIT_TEST) {
     ASSERT_FALSE(buffer.Init(start_lsn, end_lsn));  // file 5 not exist
     fi = fopen(WAL_GTEST_PATH "5.wal", "w");
     fclose(fi);
-    ASSERT_FALSE(buffer.Init(start_lsn, end_lsn));  // file 5 size error
+    ASSERT_TRUE(buffer.Init(start_lsn, end_lsn));  // file 5 size zero, a torn tail
     fi = fopen(WAL_GTEST_PATH "5.wal", "w");
     fwrite(buff, 1, end_buf_off, fi);
     fclose(fi);
@@ -541,9 +551,9 @@ TEST(WalTest, MANAGER_RECOVERY_TEST) {
     // error happen and reset
     ASSERT_EQ(manager->GetNextRecovery(record), milvus::WAL_SUCCESS);
     ASSERT_EQ(manager->p_buffer_->mxlog_buffer_reader_.file_no, write_file_no);
-    ASSERT_EQ(manager->p_buffer_->mxlog_buffer_reader_.buf_offset, 0);
+    ASSERT_EQ(manager->p_buffer_->mxlog_buffer_reader_.buf_offset, milvus::engine::wal::SizeOfMXLogFileHeader);
     ASSERT_EQ(manager->p_buffer_->mxlog_buffer_writer_.file_no, write_file_no);
-    ASSERT_EQ(manager->p_buffer_->mxlog_buffer_writer_.buf_offset, 0);
+    ASSERT_EQ(manager->p_buffer_->mxlog_buffer_writer_.buf_offset, milvus::engine::wal::SizeOfMXLogFileHeader);
 }
 
 TEST(WalTest, MANAGER_TEST) {
@@ -637,6 +647,150 @@ TEST(WalTest, MANAGER_TEST) {
     ASSERT_TRUE(record.table_id.empty());
 }
 
+TEST(WalTest, MANAGER_GROUP_COMMIT_TEST) {
+    std::vector<milvus::engine::wal::MXLogSyncMode> modes = {milvus::engine::wal::MXLogSyncMode::None,
+                                                             milvus::engine::wal::MXLogSyncMode::Batch,
+                                                             milvus::engine::wal::MXLogSyncMode::Interval};
+    for (auto mode : modes) {
+        MakeEmptyTestPath();
+
+        milvus::engine::wal::MXLogConfiguration wal_config;
+        wal_config.mxlog_path = WAL_GTEST_PATH;
+        wal_config.buffer_size = 64;
+        wal_config.recovery_error_ignore = false;
+        wal_config.sync_mode = mode;
+        wal_config.sync_interval = 10;
+
+        milvus::engine::wal::WalManager manager(wal_config);
+        ASSERT_EQ(manager.Init(nullptr), milvus::WAL_SUCCESS);
+        manager.CreateTable("table1");
+
+        // shrink the buffer to 64KB, far below the ~600KB inserted below, so that inserts switch wal files
+        manager.mxlog_config_.buffer_size = 1 << 16;
+        manager.p_buffer_->mxlog_buffer_size_ = 1 << 16;
+
+        const int64_t thread_num = 8, insert_num = 100, batch = 10, dim = 16;
+        std::vector<std::thread> threads;
+        for (int64_t t = 0; t < thread_num; t++) {
+            threads.emplace_back([&, t]() {
+                for (int64_t i = 0; i < insert_num; i++) {
+                    milvus::engine::IDNumbers ids;
+                    for (int64_t j = 0; j < batch; j++) {
+                        ids.push_back(t * insert_num * batch + i * batch + j);
+                    }
+                    std::vector<float> vectors(batch * dim, (float)t);
+                    ASSERT_TRUE(manager.Insert("table1", "", ids, vectors));
+                }
+            });
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+
+        int64_t wal_file_count = 0;
+        for (uint32_t i = 0; i <= manager.p_buffer_->mxlog_buffer_writer_.file_no; i++) {
+            std::string file_path = WAL_GTEST_PATH + std::to_string(i) + ".wal";
+            if (access(file_path.c_str(), 0) == 0) {
+                wal_file_count++;
+            }
+        }
+        ASSERT_GT(wal_file_count, 1);
+
+        // every record is readable and is not mixed up with records of other threads
+        int64_t total = 0;
+        milvus::engine::wal::MXLogRecord record;
+        while (true) {
+            ASSERT_EQ(manager.GetNextRecord(record), milvus::WAL_SUCCESS);
+            if (record.type == milvus::engine::wal::MXLogType::None) {
+                break;
+            }
+            auto vectors = (const float*)record.data;
+            for (uint32_t k = 0; k < record.length; k++) {
+                ASSERT_EQ(vectors[k * dim], (float)(record.ids[k] / (insert_num * batch)));
+            }
+            total += record.length;
+        }
+        ASSERT_EQ(total, thread_num * insert_num * batch);
+    }
+}
+
+TEST(WalTest, MANAGER_TORN_TAIL_TEST) {
+    MakeEmptyTestPath();
+
+    milvus::engine::wal::MXLogConfiguration wal_config;
+    wal_config.mxlog_path = WAL_GTEST_PATH;
+    wal_config.buffer_size = 64;
+    wal_config.recovery_error_ignore = false;
+
+    const int64_t record_num = 10, batch = 10, dim = 16;
+    auto insert = [&](milvus::engine::wal::WalManager& manager, int64_t i) {
+        milvus::engine::IDNumbers ids(batch, i);
+        std::vector<float> vectors(batch * dim, (float)i);
+        ASSERT_TRUE(manager.Insert("table1", "", ids, vectors));
+    };
+    auto recover = [&](std::vector<int64_t>& record_ids) {
+        milvus::engine::wal::WalManager manager(wal_config);
+        ASSERT_EQ(manager.Init(nullptr), milvus::WAL_SUCCESS);
+        // no meta here, records of unknown tables are skipped by recovery
+        manager.tables_["table1"] = {0, manager.last_applied_lsn_};
+        milvus::engine::wal::MXLogRecord record;
+        while (true) {
+            ASSERT_EQ(manager.GetNextRecovery(record), milvus::WAL_SUCCESS);
+            if (record.type == milvus::engine::wal::MXLogType::None) {
+                break;
+            }
+            ASSERT_EQ(record.length, batch);
+            record_ids.push_back(record.ids[0]);
+        }
+    };
+
+    std::string file_path;
+    uint64_t record_lsn[record_num];
+    {
+        milvus::engine::wal::WalManager manager(wal_config);
+        ASSERT_EQ(manager.Init(nullptr), milvus::WAL_SUCCESS);
+        manager.CreateTable("table1");
+        for (int64_t i = 0; i < record_num; i++) {
+            insert(manager, i);
+            record_lsn[i] = manager.p_buffer_->GetWriteLsn();
+        }
+        file_path = WAL_GTEST_PATH + manager.p_buffer_->mxlog_writer_.GetFileName();
+    }
+
+    // crash in the middle of writing the last record
+    uint32_t file_size = uint32_t(record_lsn[record_num - 1] & LSN_OFFSET_MASK);
+    ASSERT_EQ(truncate(file_path.c_str(), file_size - 7), 0);
+
+    std::vector<int64_t> record_ids;
+    recover(record_ids);
+    ASSERT_EQ(record_ids.size(), record_num - 1);
+    uint32_t truncated_size = uint32_t(record_lsn[record_num - 2] & LSN_OFFSET_MASK);
+    milvus::engine::wal::MXLogFileHandler file_handler(WAL_GTEST_PATH);
+    file_handler.SetFileName(file_path.substr(strlen(WAL_GTEST_PATH)));
+    ASSERT_EQ(file_handler.GetFileSize(), truncated_size);
+
+    // flip a byte in the body of record 5, the records from it on are dropped
+    FILE* fi = fopen(file_path.c_str(), "r+");
+    fseek(fi, (record_lsn[4] & LSN_OFFSET_MASK) + 100, SEEK_SET);
+    fputc(0x5a, fi);
+    fclose(fi);
+
+    record_ids.clear();
+    recover(record_ids);
+    ASSERT_EQ(record_ids, std::vector<int64_t>({0, 1, 2, 3, 4}));
+
+    // new records follow the truncated tail
+    {
+        milvus::engine::wal::WalManager manager(wal_config);
+        ASSERT_EQ(manager.Init(nullptr), milvus::WAL_SUCCESS);
+        manager.CreateTable("table1");
+        insert(manager, 100);
+    }
+    record_ids.clear();
+    recover(record_ids);
+    ASSERT_EQ(record_ids, std::vector<int64_t>({0, 1, 2, 3, 4, 100}));
+}
+
 #if 0
 TEST(WalTest, LargeScaleRecords) {
     std::string data_path = "/home/zilliz/workspace/data/";
@@ -213,6 +213,14 @@ DBTest2::GetOptions() {
     return options;
 }
 
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+milvus::engine::DBOptions
+DBTestBackendMeta::GetOptions() {
+    auto options = DBTest::GetOptions();
+    options.mode_ = milvus::engine::DBOptions::MODE::CLUSTER_WRITABLE;
+    return options;
+}
+
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 milvus::engine::DBOptions
 DBTestWAL::GetOptions() {
@@ -297,6 +305,14 @@ MySqlDBTest:: GetOptions() {
     return options;
 }
 
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+milvus::engine::DBOptions
+MySqlDBTestBackendMeta::GetOptions() {
+    auto options = MySqlDBTest::GetOptions();
+    options.mode_ = milvus::engine::DBOptions::MODE::CLUSTER_WRITABLE;
+    return options;
+}
+
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 void
 MySqlMetaTest::SetUp() {
@@ -81,6 +81,15 @@ class DBTest2 : public DBTest {
     GetOptions() override;
 };
 
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// a writable cluster node reads the meta directly instead of through the snapshot,
+// so failures injected into the backing meta reach the db on every read
+class DBTestBackendMeta : public DBTest {
+ protected:
+    milvus::engine::DBOptions
+    GetOptions() override;
+};
+
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 class DBTestWAL : public DBTest {
  protected:
@@ -126,6 +135,13 @@ class MySqlDBTest : public DBTest {
     GetOptions() override;
 };
 
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+class MySqlDBTestBackendMeta : public MySqlDBTest {
+ protected:
+    milvus::engine::DBOptions
+    GetOptions() override;
+};
+
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 class MySqlMetaTest : public BaseTest {
  protected:
@@ -11,6 +11,12 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <random>
+#include <thread>
+#include <utility>
+#include <vector>
+
 #include "scheduler/job/Job.h"
 #include "scheduler/job/BuildIndexJob.h"
 #include "scheduler/job/DeleteJob.h"
@@ -41,5 +47,74 @@ TEST(JobTest, TestJob) {
     search_ptr->AddIndexFile(nullptr);
 }
 
+TEST(JobTest, SearchJobReduceTopk) {
+    const uint64_t nq = 37, topk = 10, file_count = 64, thread_count = 4;
+    engine::VectorsData vectors;
+    vectors.vector_count_ = nq;
+
+    for (bool ascending : {true, false}) {
+        std::default_random_engine gen(42);
+        std::uniform_real_distribution<float> dis(0.0f, 100.0f);
+        std::uniform_int_distribution<uint64_t> row_dis(0, topk + 5);
+
+        // build per file results, laid out as nq * topk and sorted per query
+        std::vector<ResultIds> file_ids(file_count);
+        std::vector<ResultDistances> file_distances(file_count);
+        std::vector<uint64_t> file_k(file_count);
+        std::vector<std::vector<std::pair<float, int64_t>>> expect(nq);
+        for (uint64_t f = 0; f < file_count; ++f) {
+            file_k[f] = std::min(row_dis(gen), topk);
+            file_ids[f].resize(nq * topk, -1);
+            file_distances[f].resize(nq * topk, 0.0f);
+            for (uint64_t q = 0; q < nq; ++q) {
+                std::vector<std::pair<float, int64_t>> items;
+                for (uint64_t j = 0; j < file_k[f]; ++j) {
+                    items.emplace_back(dis(gen), (int64_t)(f * topk + j));
+                }
+                std::sort(items.begin(), items.end());
+                if (!ascending) {
+                    std::reverse(items.begin(), items.end());
+                }
+                for (uint64_t j = 0; j < file_k[f]; ++j) {
+                    file_distances[f][q * topk + j] = items[j].first;
+                    file_ids[f][q * topk + j] = items[j].second;
+                    expect[q].push_back(items[j]);
+                }
+            }
+        }
+
+        auto search_job = std::make_shared<SearchJob>(nullptr, topk, 1, vectors);
+        std::vector<std::thread> threads;
+        for (uint64_t t = 0; t < thread_count; ++t) {
+            threads.emplace_back([&, t]() {
+                for (uint64_t f = t; f < file_count; f += thread_count) {
+                    search_job->ReduceTopk(file_ids[f], file_distances[f], file_k[f], ascending);
+                }
+            });
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+        search_job->WaitResult();
+
+        auto& result_ids = search_job->GetResultIds();
+        auto& result_distances = search_job->GetResultDistances();
+        uint64_t result_k = result_ids.size() / nq;
+        ASSERT_EQ(result_ids.size(), result_distances.size());
+        for (uint64_t q = 0; q < nq; ++q) {
+            auto& items = expect[q];
+            std::sort(items.begin(), items.end());
+            if (!ascending) {
+                std::reverse(items.begin(), items.end());
+            }
+            ASSERT_EQ(result_k, std::min(topk, (uint64_t)items.size()));
+            for (uint64_t j = 0; j < result_k; ++j) {
+                ASSERT_EQ(result_ids[q * result_k + j], items[j].second);
+                ASSERT_FLOAT_EQ(result_distances[q * result_k + j], items[j].first);
+            }
+        }
+    }
+}
+
 }  // namespace scheduler
 }  // namespace milvus
@@ -11,6 +11,11 @@
 
 #include <gtest/gtest.h>
 
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <utility>
+
 #include "scheduler/ResourceFactory.h"
 #include "scheduler/resource/CpuResource.h"
 #include "scheduler/resource/DiskResource.h"
@@ -274,6 +279,87 @@ TEST_F(ResourceAdvanceTest, TEST_RESOURCE_TEST) {
     ASSERT_EQ(null_resource, nullptr);
 }
 
+// records how many tasks execute at the same time
+class ConcurrencyTask : public TestTask {
+ public:
+    ConcurrencyTask(const std::shared_ptr<server::Context>& context, TableFileSchemaPtr& file, TaskLabelPtr label,
+                    std::atomic<int64_t>& running, std::atomic<int64_t>& max_running)
+        : TestTask(context, file, std::move(label)), running_(running), max_running_(max_running) {
+    }
+
+    void
+    Execute() override {
+        int64_t now = ++running_;
+        int64_t max = max_running_.load();
+        while (now > max && !max_running_.compare_exchange_weak(max, now)) {
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        --running_;
+        TestTask::Execute();
+    }
+
+ private:
+    std::atomic<int64_t>& running_;
+    std::atomic<int64_t>& max_running_;
+};
+
+TEST(ResourceThreadTest, EXECUTOR_THREAD_CONCURRENCY_TEST) {
+    const uint64_t NUM = 16;
+    for (uint64_t thread_num : {1, 4}) {
+        auto resource = std::make_shared<TestResource>("test", 0, true);
+        resource->SetThreadNum(1, thread_num);
+
+        std::mutex mutex;
+        std::condition_variable cv;
+        uint64_t finish_count = 0;
+        Resource* res = resource.get();
+        resource->RegisterSubscriber([&, res](EventPtr event) {
+            if (event->Type() == EventType::LOAD_COMPLETED) {
+                res->WakeupExecutor();
+            } else if (event->Type() == EventType::FINISH_TASK) {
+                {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    ++finish_count;
+                }
+                cv.notify_one();
+                res->WakeupLoader();
+            }
+        });
+        resource->Start();
+
+        std::atomic<int64_t> running(0);
+        std::atomic<int64_t> max_running(0);
+        std::vector<std::shared_ptr<ConcurrencyTask>> tasks;
+        TableFileSchemaPtr dummy = nullptr;
+        for (uint64_t i = 0; i < NUM; ++i) {
+            auto label = std::make_shared<SpecResLabel>(resource);
+            auto context = std::make_shared<server::Context>("dummy_request_id");
+            auto task = std::make_shared<ConcurrencyTask>(context, dummy, label, running, max_running);
+            std::vector<std::string> path{resource->name()};
+            task->path() = Path(path, 0);
+            tasks.push_back(task);
+            resource->task_table().Put(task);
+        }
+
+        resource->WakeupLoader();
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            cv.wait(lock, [&] { return finish_count == NUM; });
+        }
+        resource->Stop();
+
+        for (auto& task : tasks) {
+            ASSERT_EQ(task->exec_count_, 1);
+        }
+        ASSERT_LE(max_running.load(), static_cast<int64_t>(thread_num));
+        if (thread_num == 1) {
+            ASSERT_EQ(max_running.load(), 1);
+        } else {
+            ASSERT_GT(max_running.load(), 1);
+        }
+    }
+}
+
 TEST(Connection_Test, CONNECTION_TEST) {
     std::string connection_name = "cpu";
     uint64_t speed = 982;
@@ -17,6 +17,9 @@
 
 #include "cache/CpuCacheMgr.h"
 #include "cache/GpuCacheMgr.h"
+#include "cache/SegmentCacheMgr.h"
+#include "segment/DeletedDocs.h"
+#include "segment/Uids.h"
 
 namespace {
 
@@ -33,6 +36,20 @@ class LessItemCacheMgr : public milvus::cache::CacheMgr<milvus::cache::DataObjPt
     }
 };
 
+class MockDataObj : public milvus::cache::DataObj {
+ public:
+    explicit MockDataObj(int64_t size) : size_(size) {
+    }
+
+    int64_t
+    Size() override {
+        return size_;
+    }
+
+ private:
+    int64_t size_;
+};
+
 class MockVecIndex : public milvus::engine::VecIndex {
  public:
     MockVecIndex(int64_t dim, int64_t total) : dimension_(dim), ntotal_(total) {
@@ -187,6 +204,41 @@ TEST(CacheTest, CPU_CACHE_TEST) {
 //    delete cpu_cache_mgr;
 }
 
+TEST(CacheTest, SEGMENT_CACHE_TEST) {
+    auto segment_mgr = milvus::cache::SegmentCacheMgr::GetInstance();
+    segment_mgr->ClearCache();
+
+    const std::string segment_dir = "/tmp/milvus_test/tables/test/segment_1";
+    std::string uids_key = milvus::cache::SegmentCacheMgr::UidsKey(segment_dir);
+    std::string deleted_key = milvus::cache::SegmentCacheMgr::DeletedDocsKey(segment_dir);
+    ASSERT_NE(uids_key, deleted_key);
+
+    std::vector<milvus::segment::doc_id_t> uids(1000, 1);
+    auto uids_ptr = std::make_shared<milvus::segment::Uids>(uids);
+    ASSERT_EQ(uids_ptr->Size(), 1000 * sizeof(milvus::segment::doc_id_t));
+
+    uint64_t epoch = segment_mgr->Epoch();
+    segment_mgr->InsertComponent(uids_key, uids_ptr, epoch);
+    ASSERT_TRUE(segment_mgr->ItemExists(uids_key));
+    ASSERT_EQ(segment_mgr->CacheUsage(), uids_ptr->Size());
+
+    // a component read before an invalidation must not be inserted
+    epoch = segment_mgr->Epoch();
+    segment_mgr->EraseComponent(deleted_key);
+    std::vector<milvus::segment::offset_t> offsets = {1, 2};
+    auto deleted_docs_ptr = std::make_shared<milvus::segment::DeletedDocs>(offsets);
+    segment_mgr->InsertComponent(deleted_key, deleted_docs_ptr, epoch);
+    ASSERT_FALSE(segment_mgr->ItemExists(deleted_key));
+
+    segment_mgr->InsertComponent(deleted_key, deleted_docs_ptr, segment_mgr->Epoch());
+    ASSERT_TRUE(segment_mgr->ItemExists(deleted_key));
+
+    segment_mgr->EraseSegment(segment_dir);
+    ASSERT_FALSE(segment_mgr->ItemExists(uids_key));
+    ASSERT_FALSE(segment_mgr->ItemExists(deleted_key));
+    ASSERT_EQ(segment_mgr->CacheUsage(), 0);
+}
+
 #ifdef MILVUS_GPU_VERSION
 TEST(CacheTest, GPU_CACHE_TEST) {
     auto gpu_mgr = milvus::cache::GpuCacheMgr::GetInstance(0);
@@ -251,6 +303,68 @@ TEST(CacheTest, INVALID_TEST) {
     }
 }
 
+TEST(CacheTest, SCAN_RESISTANT_TEST) {
+    // room for 10 items
+    milvus::cache::Cache<milvus::cache::DataObjPtr> cache(10 * 1000, 1UL << 32);
+    cache.insert("/db/tables/hot/1/1", std::make_shared<MockDataObj>(1000));
+    ASSERT_NE(cache.get("/db/tables/hot/1/1"), nullptr);
+
+    // a scan touches every item once, it must not push out the item which is hit twice
+    for (int i = 0; i < 100; i++) {
+        cache.insert("/db/tables/scan/1/" + std::to_string(i), std::make_shared<MockDataObj>(1000));
+    }
+    ASSERT_TRUE(cache.exists("/db/tables/hot/1/1"));
+    ASSERT_FALSE(cache.exists("/db/tables/scan/1/0"));
+    ASSERT_TRUE(cache.exists("/db/tables/scan/1/99"));
+    ASSERT_LE(cache.usage(), cache.capacity());
+    ASSERT_EQ(cache.size() * 1000, cache.usage());
+
+    // the protected segment is bounded, the oldest hot items fall back to probation and get evicted
+    for (int i = 0; i < 20; i++) {
+        std::string key = "/db/tables/hot/2/" + std::to_string(i);
+        cache.insert(key, std::make_shared<MockDataObj>(1000));
+        cache.get(key);
+    }
+    ASSERT_LE(cache.usage(), cache.capacity());
+    ASSERT_FALSE(cache.exists("/db/tables/hot/1/1"));
+    ASSERT_TRUE(cache.exists("/db/tables/hot/2/19"));
+
+    // an item larger than the whole cache is kept until the next insert
+    cache.insert("huge", std::make_shared<MockDataObj>(20 * 1000));
+    ASSERT_TRUE(cache.exists("huge"));
+    ASSERT_EQ(cache.size(), 1);
+
+    cache.erase("huge");
+    ASSERT_EQ(cache.size(), 0);
+    ASSERT_EQ(cache.usage(), 0);
+
+    ASSERT_EQ(milvus::cache::CacheKeyTableId("/db/tables/tbl/1/2"), "tbl");
+    ASSERT_EQ(milvus::cache::CacheKeyTableId("/db/tables/tbl"), "tbl");
+    ASSERT_EQ(milvus::cache::CacheKeyTableId("huge"), "");
+}
+
+TEST(CacheTest, HOT_KEYS_TEST) {
+    milvus::cache::Cache<milvus::cache::DataObjPtr> cache(10 * 1000, 1UL << 32);
+    std::vector<std::string> keys;
+    cache.hot_keys(keys);
+    ASSERT_TRUE(keys.empty());
+
+    cache.insert("/db/tables/tbl/1/1", std::make_shared<MockDataObj>(1000));
+    cache.insert("/db/tables/tbl/1/2", std::make_shared<MockDataObj>(1000));
+    cache.insert("/db/tables/tbl/1/3", std::make_shared<MockDataObj>(1000));
+    cache.get("/db/tables/tbl/1/1");
+
+    // items hit more than once come first, then the others, the most recent first
+    cache.hot_keys(keys);
+    std::vector<std::string> expected = {"/db/tables/tbl/1/1", "/db/tables/tbl/1/3", "/db/tables/tbl/1/2"};
+    ASSERT_EQ(keys, expected);
+
+    cache.erase("/db/tables/tbl/1/3");
+    cache.hot_keys(keys);
+    expected = {"/db/tables/tbl/1/1", "/db/tables/tbl/1/2"};
+    ASSERT_EQ(keys, expected);
+}
+
 TEST(CacheTest, PARTIAL_LRU_TEST) {
     constexpr int MAX_SIZE = 5;
     milvus::cache::LRU<int, int> lru(MAX_SIZE);
@@ -157,6 +157,21 @@ TEST_F(ConfigTest, SERVER_CONFIG_VALID_TEST) {
     ASSERT_TRUE(config.GetServerConfigWebPort(str_val).ok());
     ASSERT_TRUE(str_val == web_port);
 
+    int64_t dql_thread_num = 2;
+    ASSERT_TRUE(config.SetServerConfigDqlThreadNum(std::to_string(dql_thread_num)).ok());
+    ASSERT_TRUE(config.GetServerConfigDqlThreadNum(int64_val).ok());
+    ASSERT_TRUE(int64_val == dql_thread_num);
+
+    int64_t request_queue_depth = 128;
+    ASSERT_TRUE(config.SetServerConfigRequestQueueDepth(std::to_string(request_queue_depth)).ok());
+    ASSERT_TRUE(config.GetServerConfigRequestQueueDepth(int64_val).ok());
+    ASSERT_TRUE(int64_val == request_queue_depth);
+
+    int64_t dql_queue_depth = 64;
+    ASSERT_TRUE(config.SetServerConfigDqlQueueDepth(std::to_string(dql_queue_depth)).ok());
+    ASSERT_TRUE(config.GetServerConfigDqlQueueDepth(int64_val).ok());
+    ASSERT_TRUE(int64_val == dql_queue_depth);
+
     std::string server_mode = "cluster_readonly";
     ASSERT_TRUE(config.SetServerConfigDeployMode(server_mode).ok());
     ASSERT_TRUE(config.GetServerConfigDeployMode(str_val).ok());
@@ -183,6 +198,16 @@ TEST_F(ConfigTest, SERVER_CONFIG_VALID_TEST) {
     ASSERT_TRUE(config.GetDBConfigArchiveDaysThreshold(int64_val).ok());
     ASSERT_TRUE(int64_val == db_archive_days_threshold);
 
+    int64_t search_combine_max_wait = 1000;
+    ASSERT_TRUE(config.SetDBConfigSearchCombineMaxWait(std::to_string(search_combine_max_wait)).ok());
+    ASSERT_TRUE(config.GetDBConfigSearchCombineMaxWait(int64_val).ok());
+    ASSERT_TRUE(int64_val == search_combine_max_wait);
+
+    int64_t search_combine_max_nq = 4096;
+    ASSERT_TRUE(config.SetDBConfigSearchCombineMaxNq(std::to_string(search_combine_max_nq)).ok());
+    ASSERT_TRUE(config.GetDBConfigSearchCombineMaxNq(int64_val).ok());
+    ASSERT_TRUE(int64_val == search_combine_max_nq);
+
     /* storage config */
     std::string storage_primary_path = "/home/zilliz";
     ASSERT_TRUE(config.SetStorageConfigPrimaryPath(storage_primary_path).ok());
@@ -251,6 +276,11 @@ TEST_F(ConfigTest, SERVER_CONFIG_VALID_TEST) {
     ASSERT_TRUE(config.GetCacheConfigCpuCacheThreshold(float_val).ok());
     ASSERT_TRUE(float_val == cache_cpu_cache_threshold);
 
+    int64_t cache_segment_cache_capacity = 2;
+    ASSERT_TRUE(config.SetCacheConfigSegmentCacheCapacity(std::to_string(cache_segment_cache_capacity)).ok());
+    ASSERT_TRUE(config.GetCacheConfigSegmentCacheCapacity(int64_val).ok());
+    ASSERT_TRUE(int64_val == cache_segment_cache_capacity);
+
     int64_t cache_insert_buffer_size = 2;
     ASSERT_TRUE(config.SetCacheConfigInsertBufferSize(std::to_string(cache_insert_buffer_size)).ok());
     ASSERT_TRUE(config.GetCacheConfigInsertBufferSize(int64_val).ok());
@@ -261,6 +291,12 @@ TEST_F(ConfigTest, SERVER_CONFIG_VALID_TEST) {
     ASSERT_TRUE(config.GetCacheConfigCacheInsertData(bool_val).ok());
     ASSERT_TRUE(bool_val == cache_insert_data);
 
+    int64_t cache_cpu_cache_snapshot_interval = 30;
+    ASSERT_TRUE(
+        config.SetCacheConfigCpuCacheSnapshotInterval(std::to_string(cache_cpu_cache_snapshot_interval)).ok());
+    ASSERT_TRUE(config.GetCacheConfigCpuCacheSnapshotInterval(int64_val).ok());
+    ASSERT_TRUE(int64_val == cache_cpu_cache_snapshot_interval);
+
     /* engine config */
     int64_t engine_use_blas_threshold = 50;
     ASSERT_TRUE(config.SetEngineConfigUseBlasThreshold(std::to_string(engine_use_blas_threshold)).ok());
@@ -272,11 +308,26 @@ TEST_F(ConfigTest, SERVER_CONFIG_VALID_TEST) {
     ASSERT_TRUE(config.GetEngineConfigOmpThreadNum(int64_val).ok());
     ASSERT_TRUE(int64_val == engine_omp_thread_num);
 
+    int64_t engine_cpu_executor_thread_num = 4;
+    ASSERT_TRUE(config.SetEngineConfigCpuExecutorThreadNum(std::to_string(engine_cpu_executor_thread_num)).ok());
+    ASSERT_TRUE(config.GetEngineConfigCpuExecutorThreadNum(int64_val).ok());
+    ASSERT_TRUE(int64_val == engine_cpu_executor_thread_num);
+
+    int64_t engine_cpu_loader_thread_num = 2;
+    ASSERT_TRUE(config.SetEngineConfigCpuLoaderThreadNum(std::to_string(engine_cpu_loader_thread_num)).ok());
+    ASSERT_TRUE(config.GetEngineConfigCpuLoaderThreadNum(int64_val).ok());
+    ASSERT_TRUE(int64_val == engine_cpu_loader_thread_num);
+
     bool engine_use_avx512 = false;
     ASSERT_TRUE(config.SetEngineConfigUseAVX512(std::to_string(engine_use_avx512)).ok());
     ASSERT_TRUE(config.GetEngineConfigUseAVX512(bool_val).ok());
     ASSERT_TRUE(bool_val == engine_use_avx512);
 
+    float engine_segment_pruning_factor = 0.5;
+    ASSERT_TRUE(config.SetEngineConfigSegmentPruningFactor(std::to_string(engine_segment_pruning_factor)).ok());
+    ASSERT_TRUE(config.GetEngineConfigSegmentPruningFactor(float_val).ok());
+    ASSERT_TRUE(float_val == engine_segment_pruning_factor);
+
 #ifdef MILVUS_GPU_VERSION
     int64_t engine_gpu_search_threshold = 800;
     ASSERT_TRUE(config.SetEngineConfigGpuSearchThreshold(std::to_string(engine_gpu_search_threshold)).ok());
@@ -536,6 +587,16 @@ TEST_F(ConfigTest, SERVER_CONFIG_INVALID_TEST) {
     ASSERT_FALSE(config.SetServerConfigWebPort("99999").ok());
     ASSERT_FALSE(config.SetServerConfigWebPort("-1").ok());
 
+    ASSERT_FALSE(config.SetServerConfigDqlThreadNum("a").ok());
+    ASSERT_FALSE(config.SetServerConfigDqlThreadNum("-1").ok());
+    ASSERT_FALSE(config.SetServerConfigDqlThreadNum("10000").ok());
+
+    ASSERT_FALSE(config.SetServerConfigRequestQueueDepth("a").ok());
+    ASSERT_FALSE(config.SetServerConfigRequestQueueDepth("0").ok());
+
+    ASSERT_FALSE(config.SetServerConfigDqlQueueDepth("a").ok());
+    ASSERT_FALSE(config.SetServerConfigDqlQueueDepth("0").ok());
+
     ASSERT_FALSE(config.SetServerConfigDeployMode("cluster").ok());
 
     ASSERT_FALSE(config.SetServerConfigTimeZone("GM").ok());
@@ -551,6 +612,11 @@ TEST_F(ConfigTest, SERVER_CONFIG_INVALID_TEST) {
 
     ASSERT_FALSE(config.SetDBConfigArchiveDaysThreshold("0x10").ok());
 
+    ASSERT_FALSE(config.SetDBConfigSearchCombineMaxWait("-1").ok());
+
+    ASSERT_FALSE(config.SetDBConfigSearchCombineMaxNq("0").ok());
+    ASSERT_FALSE(config.SetDBConfigSearchCombineMaxNq("a").ok());
+
     /* storage config */
     ASSERT_FALSE(config.SetStorageConfigPrimaryPath("").ok());
 
@@ -586,6 +652,9 @@ TEST_F(ConfigTest, SERVER_CONFIG_INVALID_TEST) {
     ASSERT_FALSE(config.SetCacheConfigCpuCacheThreshold("1.0").ok());
     ASSERT_FALSE(config.SetCacheConfigCpuCacheThreshold("-0.1").ok());
 
+    ASSERT_FALSE(config.SetCacheConfigSegmentCacheCapacity("a").ok());
+    ASSERT_FALSE(config.SetCacheConfigSegmentCacheCapacity("-1").ok());
+
     ASSERT_FALSE(config.SetCacheConfigInsertBufferSize("a").ok());
     ASSERT_FALSE(config.SetCacheConfigInsertBufferSize("0").ok());
     ASSERT_FALSE(config.SetCacheConfigInsertBufferSize("2048").ok());
@@ -593,6 +662,9 @@ TEST_F(ConfigTest, SERVER_CONFIG_INVALID_TEST) {
 
     ASSERT_FALSE(config.SetCacheConfigCacheInsertData("N").ok());
 
+    ASSERT_FALSE(config.SetCacheConfigCpuCacheSnapshotInterval("a").ok());
+    ASSERT_FALSE(config.SetCacheConfigCpuCacheSnapshotInterval("-1").ok());
+
     /* engine config */
     ASSERT_FALSE(config.SetEngineConfigUseBlasThreshold("0xff").ok());
 
@@ -600,8 +672,17 @@ TEST_F(ConfigTest, SERVER_CONFIG_INVALID_TEST) {
     ASSERT_FALSE(config.SetEngineConfigOmpThreadNum("10000").ok());
     ASSERT_FALSE(config.SetEngineConfigOmpThreadNum("-10").ok());
 
+    ASSERT_FALSE(config.SetEngineConfigCpuExecutorThreadNum("0").ok());
+    ASSERT_FALSE(config.SetEngineConfigCpuExecutorThreadNum("a").ok());
+
+    ASSERT_FALSE(config.SetEngineConfigCpuLoaderThreadNum("0").ok());
+    ASSERT_FALSE(config.SetEngineConfigCpuLoaderThreadNum("-1").ok());
+
     ASSERT_FALSE(config.SetEngineConfigUseAVX512("N").ok());
 
+    ASSERT_FALSE(config.SetEngineConfigSegmentPruningFactor("a").ok());
+    ASSERT_FALSE(config.SetEngineConfigSegmentPruningFactor("1.5").ok());
+
 #ifdef MILVUS_GPU_VERSION
     ASSERT_FALSE(config.SetEngineConfigGpuSearchThreshold("-1").ok());
 #endif
@@ -13,6 +13,9 @@
 #include <opentracing/mocktracer/tracer.h>
 
 #include <boost/filesystem.hpp>
+#include <algorithm>
+#include <atomic>
+#include <future>
 #include <thread>
 
 #include "server/Server.h"
@@ -336,6 +339,62 @@ TEST_F(RpcHandlerTest, INSERT_TEST) {
     ASSERT_EQ(vector_ids.status().error_code(), ::milvus::grpc::ILLEGAL_ROWRECORD);
 }
 
+TEST_F(RpcHandlerTest, GET_VECTORS_BY_ID_TEST) {
+    ::grpc::ServerContext context;
+    handler->SetContext(&context, dummy_context);
+    handler->RegisterRequestHandler(milvus::server::RequestHandler());
+    ::milvus::grpc::InsertParam insert_param;
+    ::milvus::grpc::VectorIds vector_ids;
+
+    insert_param.set_table_name(TABLE_NAME);
+    std::vector<std::vector<float>> record_array;
+    BuildVectors(0, VECTOR_COUNT, record_array);
+    for (auto& record : record_array) {
+        ::milvus::grpc::RowRecord* grpc_record = insert_param.add_row_record_array();
+        CopyRowRecord(grpc_record, record);
+    }
+    handler->Insert(&context, &insert_param, &vector_ids);
+    ASSERT_EQ(vector_ids.vector_id_array_size(), VECTOR_COUNT);
+
+    ::milvus::grpc::FlushParam flush_param;
+    ::milvus::grpc::Status status;
+    flush_param.add_table_name_array(TABLE_NAME);
+    handler->Flush(&context, &flush_param, &status);
+    ASSERT_EQ(status.error_code(), ::milvus::grpc::SUCCESS);
+
+    // a batch of existing ids followed by one id that was never inserted
+    const int64_t batch = 10;
+    ::milvus::grpc::VectorsIdentity request;
+    ::milvus::grpc::VectorsData response;
+    request.set_table_name(TABLE_NAME);
+    for (int64_t i = 0; i < batch; ++i) {
+        request.add_id_array(vector_ids.vector_id_array(i));
+    }
+    request.add_id_array(-1);
+    handler->GetVectorsByID(&context, &request, &response);
+    ASSERT_EQ(response.status().error_code(), ::milvus::grpc::SUCCESS);
+    ASSERT_EQ(response.vectors_data_size(), batch + 1);
+    for (int64_t i = 0; i < batch; ++i) {
+        auto& float_data = response.vectors_data(i).float_data();
+        ASSERT_EQ(float_data.size(), TABLE_DIM);
+        ASSERT_TRUE(std::equal(float_data.begin(), float_data.end(), record_array[i].begin()));
+    }
+    ASSERT_EQ(response.vectors_data(batch).float_data_size(), 0);
+
+    // empty id array
+    request.clear_id_array();
+    response.Clear();
+    handler->GetVectorsByID(&context, &request, &response);
+    ASSERT_NE(response.status().error_code(), ::milvus::grpc::SUCCESS);
+
+    // table does not exist
+    request.set_table_name("not_exist_table");
+    request.add_id_array(vector_ids.vector_id_array(0));
+    response.Clear();
+    handler->GetVectorsByID(&context, &request, &response);
+    ASSERT_NE(response.status().error_code(), ::milvus::grpc::SUCCESS);
+}
+
 TEST_F(RpcHandlerTest, SEARCH_TEST) {
     ::grpc::ServerContext context;
     handler->SetContext(&context, dummy_context);
@@ -689,6 +748,10 @@ TEST_F(RpcHandlerTest, CMD_TEST) {
     command.set_cmd("build_commit_id");
     handler->Cmd(&context, &command, &reply);
 
+    command.set_cmd("preload_progress");
+    handler->Cmd(&context, &command, &reply);
+    ASSERT_FALSE(reply.string_reply().empty());
+
     command.set_cmd("set_config");
     handler->Cmd(&context, &command, &reply);
     command.set_cmd("get_config");
@@ -809,6 +872,86 @@ TEST_F(RpcSchedulerTest, BASE_TASK_TEST) {
     milvus::server::RequestScheduler::GetInstance().Stop();
 }
 
+namespace {
+// a search request which runs until it is released
+class BlockingDqlRequest : public milvus::server::BaseRequest {
+ public:
+    BlockingDqlRequest(std::atomic<int64_t>& running, std::shared_future<void> release)
+        : BaseRequest(context_holder_, milvus::server::DQL_REQUEST_GROUP, true),
+          running_(running),
+          release_(std::move(release)) {
+    }
+
+    milvus::Status
+    OnExecute() override {
+        ++running_;
+        release_.wait();
+        return milvus::Status::OK();
+    }
+
+ private:
+    static std::shared_ptr<milvus::server::Context> context_holder_;
+    std::atomic<int64_t>& running_;
+    std::shared_future<void> release_;
+};
+
+std::shared_ptr<milvus::server::Context> BlockingDqlRequest::context_holder_ =
+    std::make_shared<milvus::server::Context>("blocking_dql_request");
+}  // namespace
+
+TEST_F(RpcSchedulerTest, DQL_QUEUE_TEST) {
+    auto& scheduler = milvus::server::RequestScheduler::GetInstance();
+    milvus::server::Config& config = milvus::server::Config::GetInstance();
+    ASSERT_TRUE(config.SetServerConfigDqlThreadNum("2").ok());
+    ASSERT_TRUE(config.SetServerConfigDqlQueueDepth("1").ok());
+    scheduler.Stop();  // the dql group is created again with the config above
+    scheduler.Start();
+
+    // declared before the promise, whose destruction releases the requests if an assertion fails
+    std::atomic<int64_t> running(0);
+    std::vector<milvus::server::BaseRequestPtr> requests;
+    std::promise<void> release;
+    std::shared_future<void> release_future = release.get_future().share();
+    auto execute = [&]() {
+        requests.push_back(std::make_shared<BlockingDqlRequest>(running, release_future));
+        return scheduler.ExecuteRequest(requests.back());
+    };
+    auto wait_running = [&](int64_t count) {
+        for (int64_t i = 0; i < 100 && running < count; ++i) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        }
+        return running.load();
+    };
+
+    // two workers run two searches at the same time
+    ASSERT_TRUE(execute().ok());
+    ASSERT_EQ(wait_running(1), 1);
+    ASSERT_TRUE(execute().ok());
+    ASSERT_EQ(wait_running(2), 2);
+
+    // the third one fills the queue, the fourth one is rejected at once
+    ASSERT_TRUE(execute().ok());
+    auto status = execute();
+    ASSERT_EQ(status.code(), milvus::SERVER_REQUEST_QUEUE_FULL);
+    ASSERT_EQ(requests[3]->WaitToFinish().code(), milvus::SERVER_REQUEST_QUEUE_FULL);
+
+    // stopping with a full queue doesn't wait for the queued request, it ends once the running ones do
+    std::thread stop_thread([&scheduler]() { scheduler.Stop(); });
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    release.set_value();
+    stop_thread.join();
+    for (auto& request : requests) {
+        request->WaitToFinish();
+    }
+    ASSERT_TRUE(requests[0]->status().ok());
+    ASSERT_TRUE(requests[1]->status().ok());
+    ASSERT_FALSE(requests[2]->status().ok());
+
+    ASSERT_TRUE(config.SetServerConfigDqlThreadNum(milvus::server::CONFIG_SERVER_DQL_THREAD_NUM_DEFAULT).ok());
+    ASSERT_TRUE(config.SetServerConfigDqlQueueDepth(milvus::server::CONFIG_SERVER_DQL_QUEUE_DEPTH_DEFAULT).ok());
+    scheduler.Start();
+}
+
 TEST(RpcTest, RPC_SERVER_TEST) {
     using GrpcServer =  milvus::server::grpc::GrpcServer;
     GrpcServer& server = GrpcServer::GetInstance();